@@ -6,6 +6,8 @@
 
 // -- c++ library headers
 #include <themachinethatgoesping/tools/helper/container_intersection.hpp>
+#include <themachinethatgoesping/tools/helper/section_tracker.hpp>
+#include <themachinethatgoesping/tools_nanobind/classhelper.hpp>
 
 // -- include nanobind headers
 #include <nanobind/nanobind.h>
@@ -17,6 +19,69 @@
 namespace nb        = nanobind;
 namespace pingtools = themachinethatgoesping::tools;
 
+template<typename T>
+void bind_section_tracker(nb::module_& m, const std::string& name)
+{
+    using t_SectionTracker = pingtools::helper::SectionTracker<T>;
+
+    nb::class_<t_SectionTracker>(
+        m,
+        name.c_str(),
+        DOC(themachinethatgoesping, tools, helper, SectionTracker))
+        .def(nb::init<double>(),
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, SectionTracker),
+             nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN())
+        .def("__eq__",
+             &t_SectionTracker::operator==,
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, operator_eq),
+             nb::arg("other"))
+        .def("append",
+             &t_SectionTracker::append,
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, append),
+             nb::arg("value"))
+        .def("extend",
+             &t_SectionTracker::template extend<xt::nanobind::pytensor<T, 1>>,
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, extend),
+             nb::arg("values"))
+        .def("clear",
+             &t_SectionTracker::clear,
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, clear))
+        .def("get_max_gap",
+             &t_SectionTracker::get_max_gap,
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, get_max_gap))
+        .def("size",
+             &t_SectionTracker::size,
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, size))
+        .def("empty",
+             &t_SectionTracker::empty,
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, empty))
+        .def("get_sections",
+             &t_SectionTracker::get_sections,
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, get_sections))
+        .def("get_open_section",
+             &t_SectionTracker::get_open_section,
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, get_open_section))
+        .def("get_shared_sections",
+             nb::overload_cast<const t_SectionTracker&>(&t_SectionTracker::get_shared_sections,
+                                                        nb::const_),
+             DOC(themachinethatgoesping, tools, helper, SectionTracker, get_shared_sections),
+             nb::arg("other"))
+        .def_static(
+            "get_shared_sections",
+            nb::overload_cast<const std::vector<t_SectionTracker>&>(
+                &t_SectionTracker::get_shared_sections),
+            DOC(themachinethatgoesping, tools, helper, SectionTracker, get_shared_sections_2),
+            nb::arg("trackers"))
+        // default copy functions
+        __PYCLASS_DEFAULT_COPY__(t_SectionTracker)
+        // default binary functions
+        __PYCLASS_DEFAULT_BINARY__(t_SectionTracker)
+        // default printing functions
+        __PYCLASS_DEFAULT_PRINTING__(t_SectionTracker)
+        // end SectionTracker
+        ;
+}
+
 void init_m_container_intersection(nb::module_& m)
 {
     auto m_helper = m.def_submodule("helper");
@@ -104,6 +169,36 @@ max : float
             return "RangeFloat(" + std::to_string(self.min) + ", " + std::to_string(self.max) + ")";
         });
 
+    // Bind SectionTracker<double> and SectionTracker<float>
+    bind_section_tracker<double>(m_helper, "SectionTrackerDouble");
+    bind_section_tracker<float>(m_helper, "SectionTrackerFloat");
+
+    // Bind IndexSlice
+    nb::class_<pingtools::helper::IndexSlice>(
+        m_helper,
+        "IndexSlice",
+        R"doc(Half-open index range [start, stop) into a container.
+
+Use ``array[s.start:s.stop]`` to access the elements of the slice
+without copying.
+
+Attributes
+----------
+start : int
+    First index of the slice
+stop : int
+    One past the last index of the slice
+)doc")
+        .def_ro("start", &pingtools::helper::IndexSlice::start, "First index of the slice")
+        .def_ro(
+            "stop", &pingtools::helper::IndexSlice::stop, "One past the last index of the slice")
+        .def("__len__", &pingtools::helper::IndexSlice::size, "Number of elements within the slice")
+        .def("__eq__", &pingtools::helper::IndexSlice::operator==, nb::arg("other"))
+        .def("__repr__", [](const pingtools::helper::IndexSlice& self) {
+            return "IndexSlice(" + std::to_string(self.start) + ", " + std::to_string(self.stop) +
+                   ")";
+        });
+
     // Bind get_sections for pytensor<double, 1>
     m_helper.def(
         "get_sections",
@@ -160,14 +255,18 @@ list
     // Bind get_shared_sections for list of pytensor<double, 1>
     m_helper.def(
         "get_shared_sections",
-        [](const std::vector<xt::nanobind::pytensor<double, 1>>& containers, double max_gap) {
+        [](const std::vector<xt::nanobind::pytensor<double, 1>>& containers,
+           double                                                max_gap,
+           int                                                   mp_cores) {
             std::vector<xt::xtensor<double, 1>> containers_copy;
             containers_copy.reserve(containers.size());
             for (const auto& c : containers)
             {
                 containers_copy.push_back(c);
             }
-            return pingtools::helper::get_shared_sections(containers_copy, max_gap);
+            // the containers are copied, so the computation can run without the GIL
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_shared_sections(containers_copy, max_gap, mp_cores);
         },
         R"doc(Find shared sections across multiple sorted containers.
 
@@ -180,6 +279,9 @@ containers : list of numpy.ndarray
     List of sorted 1D arrays
 max_gap : float
     Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
 
 Returns
 -------
@@ -187,19 +289,23 @@ list
     List of Range objects representing shared sections
 )doc",
         nb::arg("containers"),
-        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
 
     // Bind get_shared_sections for list of pytensor<float, 1>
     m_helper.def(
         "get_shared_sections",
-        [](const std::vector<xt::nanobind::pytensor<float, 1>>& containers, double max_gap) {
+        [](const std::vector<xt::nanobind::pytensor<float, 1>>& containers,
+           double                                               max_gap,
+           int                                                  mp_cores) {
             std::vector<xt::xtensor<float, 1>> containers_copy;
             containers_copy.reserve(containers.size());
             for (const auto& c : containers)
             {
                 containers_copy.push_back(c);
             }
-            return pingtools::helper::get_shared_sections(containers_copy, max_gap);
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_shared_sections(containers_copy, max_gap, mp_cores);
         },
         R"doc(Find shared sections across multiple sorted containers.
 
@@ -209,6 +315,9 @@ containers : list of numpy.ndarray
     List of sorted 1D arrays (float32)
 max_gap : float
     Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
 
 Returns
 -------
@@ -216,19 +325,23 @@ list
     List of Range objects representing shared sections
 )doc",
         nb::arg("containers"),
-        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
 
     // Bind cut_to_shared_sections for list of pytensor<double, 1>
     m_helper.def(
         "cut_to_shared_sections",
-        [](const std::vector<xt::nanobind::pytensor<double, 1>>& containers, double max_gap) {
+        [](const std::vector<xt::nanobind::pytensor<double, 1>>& containers,
+           double                                                max_gap,
+           int                                                   mp_cores) {
             std::vector<xt::xtensor<double, 1>> containers_copy;
             containers_copy.reserve(containers.size());
             for (const auto& c : containers)
             {
                 containers_copy.push_back(c);
             }
-            return pingtools::helper::cut_to_shared_sections(containers_copy, max_gap);
+            nb::gil_scoped_release release;
+            return pingtools::helper::cut_to_shared_sections(containers_copy, max_gap, mp_cores);
         },
         R"doc(Cut multiple containers to only include values within shared sections.
 
@@ -241,6 +354,9 @@ containers : list of numpy.ndarray
     List of sorted 1D arrays
 max_gap : float
     Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
 
 Returns
 -------
@@ -248,19 +364,23 @@ list of numpy.ndarray
     Filtered containers containing only values within shared sections
 )doc",
         nb::arg("containers"),
-        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
 
     // Bind cut_to_shared_sections for list of pytensor<float, 1>
     m_helper.def(
         "cut_to_shared_sections",
-        [](const std::vector<xt::nanobind::pytensor<float, 1>>& containers, double max_gap) {
+        [](const std::vector<xt::nanobind::pytensor<float, 1>>& containers,
+           double                                               max_gap,
+           int                                                  mp_cores) {
             std::vector<xt::xtensor<float, 1>> containers_copy;
             containers_copy.reserve(containers.size());
             for (const auto& c : containers)
             {
                 containers_copy.push_back(c);
             }
-            return pingtools::helper::cut_to_shared_sections(containers_copy, max_gap);
+            nb::gil_scoped_release release;
+            return pingtools::helper::cut_to_shared_sections(containers_copy, max_gap, mp_cores);
         },
         R"doc(Cut multiple containers to only include values within shared sections.
 
@@ -270,6 +390,9 @@ containers : list of numpy.ndarray
     List of sorted 1D arrays (float32)
 max_gap : float
     Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
 
 Returns
 -------
@@ -277,19 +400,24 @@ list of numpy.ndarray
     Filtered containers containing only values within shared sections
 )doc",
         nb::arg("containers"),
-        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
 
     // Bind get_shared_section_indices for list of pytensor<double, 1>
     m_helper.def(
         "get_shared_section_indices",
-        [](const std::vector<xt::nanobind::pytensor<double, 1>>& containers, double max_gap) {
+        [](const std::vector<xt::nanobind::pytensor<double, 1>>& containers,
+           double                                                max_gap,
+           int                                                   mp_cores) {
             std::vector<xt::xtensor<double, 1>> containers_copy;
             containers_copy.reserve(containers.size());
             for (const auto& c : containers)
             {
                 containers_copy.push_back(c);
             }
-            return pingtools::helper::get_shared_section_indices(containers_copy, max_gap);
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_shared_section_indices(
+                containers_copy, max_gap, mp_cores);
         },
         R"doc(Get indices of elements within shared sections for each container.
 
@@ -299,6 +427,9 @@ containers : list of numpy.ndarray
     List of sorted 1D arrays
 max_gap : float
     Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
 
 Returns
 -------
@@ -306,19 +437,24 @@ list of numpy.ndarray
     For each container, indices of elements within shared sections
 )doc",
         nb::arg("containers"),
-        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
 
     // Bind get_shared_section_indices for list of pytensor<float, 1>
     m_helper.def(
         "get_shared_section_indices",
-        [](const std::vector<xt::nanobind::pytensor<float, 1>>& containers, double max_gap) {
+        [](const std::vector<xt::nanobind::pytensor<float, 1>>& containers,
+           double                                               max_gap,
+           int                                                  mp_cores) {
             std::vector<xt::xtensor<float, 1>> containers_copy;
             containers_copy.reserve(containers.size());
             for (const auto& c : containers)
             {
                 containers_copy.push_back(c);
             }
-            return pingtools::helper::get_shared_section_indices(containers_copy, max_gap);
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_shared_section_indices(
+                containers_copy, max_gap, mp_cores);
         },
         R"doc(Get indices of elements within shared sections for each container.
 
@@ -328,6 +464,9 @@ containers : list of numpy.ndarray
     List of sorted 1D arrays (float32)
 max_gap : float
     Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
 
 Returns
 -------
@@ -335,19 +474,173 @@ list of numpy.ndarray
     For each container, indices of elements within shared sections
 )doc",
         nb::arg("containers"),
-        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
+
+    // Bind get_shared_section_slices for list of pytensor<double, 1>
+    m_helper.def(
+        "get_shared_section_slices",
+        [](const std::vector<xt::nanobind::pytensor<double, 1>>& containers,
+           double                                                max_gap,
+           int                                                   mp_cores) {
+            std::vector<xt::xtensor<double, 1>> containers_copy;
+            containers_copy.reserve(containers.size());
+            for (const auto& c : containers)
+            {
+                containers_copy.push_back(c);
+            }
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_shared_section_slices(containers_copy, max_gap, mp_cores);
+        },
+        R"doc(Get the index slices of the shared sections for each container.
+
+One IndexSlice [start, stop) is returned per shared section and container.
+Use array[s.start:s.stop] to access the values without an index array.
+
+Parameters
+----------
+containers : list of numpy.ndarray
+    List of sorted 1D arrays
+max_gap : float
+    Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
+
+Returns
+-------
+list of list of IndexSlice
+    For each container, one slice per shared section
+)doc",
+        nb::arg("containers"),
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
+
+    // Bind get_shared_section_slices for list of pytensor<float, 1>
+    m_helper.def(
+        "get_shared_section_slices",
+        [](const std::vector<xt::nanobind::pytensor<float, 1>>& containers,
+           double                                               max_gap,
+           int                                                  mp_cores) {
+            std::vector<xt::xtensor<float, 1>> containers_copy;
+            containers_copy.reserve(containers.size());
+            for (const auto& c : containers)
+            {
+                containers_copy.push_back(c);
+            }
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_shared_section_slices(containers_copy, max_gap, mp_cores);
+        },
+        R"doc(Get the index slices of the shared sections for each container.
+
+One IndexSlice [start, stop) is returned per shared section and container.
+Use array[s.start:s.stop] to access the values without an index array.
+
+Parameters
+----------
+containers : list of numpy.ndarray
+    List of sorted 1D arrays (float32)
+max_gap : float
+    Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
+
+Returns
+-------
+list of list of IndexSlice
+    For each container, one slice per shared section
+)doc",
+        nb::arg("containers"),
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
+
+    // Bind get_shared_section_mask for list of pytensor<double, 1>
+    m_helper.def(
+        "get_shared_section_mask",
+        [](const std::vector<xt::nanobind::pytensor<double, 1>>& containers,
+           double                                                max_gap,
+           int                                                   mp_cores) {
+            std::vector<xt::xtensor<double, 1>> containers_copy;
+            containers_copy.reserve(containers.size());
+            for (const auto& c : containers)
+            {
+                containers_copy.push_back(c);
+            }
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_shared_section_mask(containers_copy, max_gap, mp_cores);
+        },
+        R"doc(Get boolean masks of the elements within shared sections.
+
+Parameters
+----------
+containers : list of numpy.ndarray
+    List of sorted 1D arrays
+max_gap : float
+    Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
+
+Returns
+-------
+list of numpy.ndarray
+    For each container, a boolean mask with the container's size
+)doc",
+        nb::arg("containers"),
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
+
+    // Bind get_shared_section_mask for list of pytensor<float, 1>
+    m_helper.def(
+        "get_shared_section_mask",
+        [](const std::vector<xt::nanobind::pytensor<float, 1>>& containers,
+           double                                               max_gap,
+           int                                                  mp_cores) {
+            std::vector<xt::xtensor<float, 1>> containers_copy;
+            containers_copy.reserve(containers.size());
+            for (const auto& c : containers)
+            {
+                containers_copy.push_back(c);
+            }
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_shared_section_mask(containers_copy, max_gap, mp_cores);
+        },
+        R"doc(Get boolean masks of the elements within shared sections.
+
+Parameters
+----------
+containers : list of numpy.ndarray
+    List of sorted 1D arrays (float32)
+max_gap : float
+    Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
+
+Returns
+-------
+list of numpy.ndarray
+    For each container, a boolean mask with the container's size
+)doc",
+        nb::arg("containers"),
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
 
     // Bind get_shared_section_values for list of pytensor<double, 1>
     m_helper.def(
         "get_shared_section_values",
-        [](const std::vector<xt::nanobind::pytensor<double, 1>>& containers, double max_gap) {
+        [](const std::vector<xt::nanobind::pytensor<double, 1>>& containers,
+           double                                                max_gap,
+           int                                                   mp_cores) {
             std::vector<xt::xtensor<double, 1>> containers_copy;
             containers_copy.reserve(containers.size());
             for (const auto& c : containers)
             {
                 containers_copy.push_back(c);
             }
-            return pingtools::helper::get_shared_section_values(containers_copy, max_gap);
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_shared_section_values(containers_copy, max_gap, mp_cores);
         },
         R"doc(Get unique values from all containers within shared sections.
 
@@ -360,6 +653,9 @@ containers : list of numpy.ndarray
     List of sorted 1D arrays
 max_gap : float
     Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
 
 Returns
 -------
@@ -367,19 +663,23 @@ numpy.ndarray
     Sorted array of unique values within shared sections
 )doc",
         nb::arg("containers"),
-        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
 
     // Bind get_shared_section_values for list of pytensor<float, 1>
     m_helper.def(
         "get_shared_section_values",
-        [](const std::vector<xt::nanobind::pytensor<float, 1>>& containers, double max_gap) {
+        [](const std::vector<xt::nanobind::pytensor<float, 1>>& containers,
+           double                                               max_gap,
+           int                                                  mp_cores) {
             std::vector<xt::xtensor<float, 1>> containers_copy;
             containers_copy.reserve(containers.size());
             for (const auto& c : containers)
             {
                 containers_copy.push_back(c);
             }
-            return pingtools::helper::get_shared_section_values(containers_copy, max_gap);
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_shared_section_values(containers_copy, max_gap, mp_cores);
         },
         R"doc(Get unique values from all containers within shared sections.
 
@@ -389,6 +689,9 @@ containers : list of numpy.ndarray
     List of sorted 1D arrays (float32)
 max_gap : float
     Maximum allowed gap between consecutive elements within a section.
+mp_cores : int, optional
+    Number of threads used to process the containers in parallel
+    (default 1)
 
 Returns
 -------
@@ -396,5 +699,6 @@ numpy.ndarray
     Sorted array of unique values within shared sections
 )doc",
         nb::arg("containers"),
-        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
 }
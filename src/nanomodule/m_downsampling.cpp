@@ -10,6 +10,7 @@
 // -- include nanobind headers
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
 #include <nanobind/stl/vector.h>
 
 #include <xtensor-python/nanobind/pytensor.hpp>
@@ -17,6 +18,85 @@
 namespace nb        = nanobind;
 namespace pingtools = themachinethatgoesping::tools;
 
+template<typename TX, typename TY>
+void bind_xy_downsampling(nb::module_& m_helper)
+{
+    m_helper.def(
+        "get_minmax_downsampling",
+        [](const xt::nanobind::pytensor<TX, 1>& x,
+           const xt::nanobind::pytensor<TY, 1>& y,
+           double                               downsample_interval,
+           double                               max_gap) {
+            xt::xtensor<TX, 1> x_copy = x;
+            xt::xtensor<TY, 1> y_copy = y;
+
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_minmax_downsampling(
+                x_copy, y_copy, downsample_interval, max_gap);
+        },
+        DOC(themachinethatgoesping, tools, helper, get_minmax_downsampling),
+        nb::arg("x"),
+        nb::arg("y"),
+        nb::arg("downsample_interval"),
+        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+
+    m_helper.def(
+        "get_mean_downsampling",
+        [](const xt::nanobind::pytensor<TX, 1>& x,
+           const xt::nanobind::pytensor<TY, 1>& y,
+           double                               downsample_interval,
+           double                               max_gap) {
+            xt::xtensor<TX, 1> x_copy = x;
+            xt::xtensor<TY, 1> y_copy = y;
+
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_mean_downsampling(
+                x_copy, y_copy, downsample_interval, max_gap);
+        },
+        DOC(themachinethatgoesping, tools, helper, get_mean_downsampling),
+        nb::arg("x"),
+        nb::arg("y"),
+        nb::arg("downsample_interval"),
+        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+
+    m_helper.def(
+        "get_lttb_downsampling",
+        [](const xt::nanobind::pytensor<TX, 1>& x,
+           const xt::nanobind::pytensor<TY, 1>& y,
+           double                               downsample_interval,
+           double                               max_gap) {
+            xt::xtensor<TX, 1> x_copy = x;
+            xt::xtensor<TY, 1> y_copy = y;
+
+            nb::gil_scoped_release release;
+            return pingtools::helper::get_lttb_downsampling(
+                x_copy, y_copy, downsample_interval, max_gap);
+        },
+        DOC(themachinethatgoesping, tools, helper, get_lttb_downsampling),
+        nb::arg("x"),
+        nb::arg("y"),
+        nb::arg("downsample_interval"),
+        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+}
+
+template<typename T, size_t N>
+void bind_gather(nb::module_& m_helper)
+{
+    m_helper.def(
+        "gather",
+        [](const xt::nanobind::pytensor<T, N>&      data,
+           const xt::nanobind::pytensor<size_t, 1>& indices) {
+            xt::xtensor<T, N>      data_copy    = data;
+            xt::xtensor<size_t, 1> indices_copy = indices;
+
+            nb::gil_scoped_release release;
+            return pingtools::helper::gather(data_copy, indices_copy);
+        },
+        DOC(themachinethatgoesping, tools, helper, gather),
+        nb::arg("data"),
+        nb::arg("indices"));
+}
+
 void init_m_downsampling(nb::module_& m)
 {
     auto m_helper = m.def_submodule("helper");
@@ -26,32 +106,40 @@ void init_m_downsampling(nb::module_& m)
         "get_index_downsampling",
         [](const xt::nanobind::pytensor<double, 1>& data,
            double                                   downsample_interval,
-           double                                   max_gap) {
+           double                                   max_gap,
+           int                                      mp_cores) {
             // Adapt the pytensor to work with our template function
             xt::xtensor<double, 1> data_copy = data;
+
+            nb::gil_scoped_release release;
             return pingtools::helper::get_index_downsampling(
-                data_copy, downsample_interval, max_gap);
+                data_copy, downsample_interval, max_gap, mp_cores);
         },
         DOC(themachinethatgoesping, tools, helper, get_index_downsampling),
         nb::arg("data"),
         nb::arg("downsample_interval"),
-        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
 
     // Bind get_index_downsampling for pytensor<float, 1>
     m_helper.def(
         "get_index_downsampling",
         [](const xt::nanobind::pytensor<float, 1>& data,
            double                                  downsample_interval,
-           double                                  max_gap) {
+           double                                  max_gap,
+           int                                     mp_cores) {
             // Adapt the pytensor to work with our template function
             xt::xtensor<float, 1> data_copy = data;
+
+            nb::gil_scoped_release release;
             return pingtools::helper::get_index_downsampling(
-                data_copy, downsample_interval, max_gap);
+                data_copy, downsample_interval, max_gap, mp_cores);
         },
         DOC(themachinethatgoesping, tools, helper, get_index_downsampling),
         nb::arg("data"),
         nb::arg("downsample_interval"),
-        nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN());
+        nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+        nb::arg("mp_cores") = 1);
 
     // Bind get_value_downsampling for pytensor<double, 1>
     m_helper.def(
@@ -84,4 +172,16 @@ void init_m_downsampling(nb::module_& m)
         nb::arg("data"),
         nb::arg("downsample_interval"),
         nb::arg("max_gap")             = std::numeric_limits<double>::quiet_NaN());
+
+    // envelope, mean and LTTB downsampling of x / y series
+    bind_xy_downsampling<double, double>(m_helper);
+    bind_xy_downsampling<double, float>(m_helper);
+    bind_xy_downsampling<float, float>(m_helper);
+
+    // gather values / rows (channels) at downsampled indices
+    bind_gather<double, 1>(m_helper);
+    bind_gather<float, 1>(m_helper);
+    bind_gather<int64_t, 1>(m_helper);
+    bind_gather<double, 2>(m_helper);
+    bind_gather<float, 2>(m_helper);
 }
@@ -6,7 +6,11 @@
 
 #include <themachinethatgoesping/tools/math/simd.hpp>
 
+#include <stdexcept>
+
+#include <fmt/core.h>
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/vector.h>
 #include <xtensor-python/nanobind/pytensor.hpp>
 
 namespace nb        = nanobind;
@@ -20,13 +24,50 @@ void bind_fma(nb::module_& m)
         "fma_dispatch",
         [](xt::nanobind::pytensor<T, 1>& x,
            T slope,
-           T base) {
-            pingtools::math::fma_dispatch(x.data(), x.data(), slope, base, x.shape(0));
+           T base,
+           int mp_cores) {
+            pingtools::math::fma_dispatch(x.data(),
+                                          x.data(),
+                                          slope,
+                                          base,
+                                          x.shape(0),
+                                          pingtools::math::t_store_mode::automatic,
+                                          mp_cores);
         },
         "Compute x[:] = x * slope + base in-place using runtime SIMD dispatch",
         nb::arg("x"),
         nb::arg("slope"),
-        nb::arg("base"));
+        nb::arg("base"),
+        nb::arg("mp_cores") = 1,
+        nb::call_guard<nb::gil_scoped_release>());
+
+    // fmab_dispatch — runtime SIMD dispatch with array base, in-place
+    m.def(
+        "fmab_dispatch",
+        [](xt::nanobind::pytensor<T, 1>&       x,
+           T                                   slope,
+           const xt::nanobind::pytensor<T, 1>& base,
+           int                                 mp_cores) {
+            if (base.shape(0) != x.shape(0))
+                throw std::invalid_argument(
+                    fmt::format("ERROR[fmab_dispatch]: base has {} elements but x has {}",
+                                base.shape(0),
+                                x.shape(0)));
+
+            pingtools::math::fmab_dispatch(x.data(),
+                                           x.data(),
+                                           slope,
+                                           base.data(),
+                                           x.shape(0),
+                                           pingtools::math::t_store_mode::automatic,
+                                           mp_cores);
+        },
+        "Compute x[:] = x * slope + base[:] in-place using runtime SIMD dispatch",
+        nb::arg("x"),
+        nb::arg("slope"),
+        nb::arg("base"),
+        nb::arg("mp_cores") = 1,
+        nb::call_guard<nb::gil_scoped_release>());
 
     // fma_xtensor — xt::fma, in-place
     m.def(
@@ -40,6 +81,91 @@ void bind_fma(nb::module_& m)
         nb::arg("x"),
         nb::arg("slope"),
         nb::arg("base"));
+
+    // find_gaps_dispatch — gap positions of a sorted series
+    m.def(
+        "find_gaps_dispatch",
+        [](const xt::nanobind::pytensor<T, 1>& x, double max_gap) {
+            return pingtools::math::find_gaps_dispatch(
+                x.data(), pingtools::math::gap_threshold<T>(max_gap), size_t(x.shape(0)));
+        },
+        "Return all positions i with x[i] - x[i-1] > max_gap using runtime SIMD dispatch",
+        nb::arg("x"),
+        nb::arg("max_gap"),
+        nb::call_guard<nb::gil_scoped_release>());
+}
+
+static void check_same_size(const char* function_name, size_t out_size, size_t x_size)
+{
+    if (out_size != x_size)
+        throw std::invalid_argument(fmt::format(
+            "ERROR[{}]: out has {} elements but x has {}", function_name, out_size, x_size));
+}
+
+template <typename TOut, typename TIn>
+void bind_fma_convert(nb::module_& m)
+{
+    // fma_convert_dispatch — decode raw samples and calibrate in one pass
+    m.def(
+        "fma_convert_dispatch",
+        [](xt::nanobind::pytensor<TOut, 1>&      out,
+           const xt::nanobind::pytensor<TIn, 1>& x,
+           TOut                                  slope,
+           TOut                                  base) {
+            check_same_size("fma_convert_dispatch", out.shape(0), x.shape(0));
+            pingtools::math::fma_convert_dispatch(out.data(), x.data(), slope, base, x.shape(0));
+        },
+        "Compute out[:] = x * slope + base with x converted to the output precision",
+        nb::arg("out"),
+        nb::arg("x"),
+        nb::arg("slope"),
+        nb::arg("base"));
+}
+
+static void bind_mixed_precision(nb::module_& m)
+{
+    bind_fma_convert<float, int16_t>(m);
+    bind_fma_convert<float, uint16_t>(m);
+    bind_fma_convert<double, int16_t>(m);
+    bind_fma_convert<double, uint16_t>(m);
+    bind_fma_convert<double, float>(m);
+
+    m.def(
+        "fmab_convert_dispatch",
+        [](xt::nanobind::pytensor<double, 1>&       out,
+           const xt::nanobind::pytensor<float, 1>&  x,
+           double                                   slope,
+           const xt::nanobind::pytensor<double, 1>& base) {
+            check_same_size("fmab_convert_dispatch", out.shape(0), x.shape(0));
+            check_same_size("fmab_convert_dispatch", base.shape(0), x.shape(0));
+            pingtools::math::fmab_convert_dispatch(
+                out.data(), x.data(), slope, base.data(), x.shape(0));
+        },
+        "Compute out[:] = x * slope + base[:] with float x accumulated in double precision",
+        nb::arg("out"),
+        nb::arg("x"),
+        nb::arg("slope"),
+        nb::arg("base"));
+
+    m.def(
+        "float_to_half_dispatch",
+        [](xt::nanobind::pytensor<uint16_t, 1>& out, const xt::nanobind::pytensor<float, 1>& x) {
+            check_same_size("float_to_half_dispatch", out.shape(0), x.shape(0));
+            pingtools::math::float_to_half_dispatch(out.data(), x.data(), x.shape(0));
+        },
+        "Convert float32 values to float16 bit patterns (use out.view(numpy.float16))",
+        nb::arg("out"),
+        nb::arg("x"));
+
+    m.def(
+        "half_to_float_dispatch",
+        [](xt::nanobind::pytensor<float, 1>& out, const xt::nanobind::pytensor<uint16_t, 1>& x) {
+            check_same_size("half_to_float_dispatch", out.shape(0), x.shape(0));
+            pingtools::math::half_to_float_dispatch(out.data(), x.data(), x.shape(0));
+        },
+        "Convert float16 bit patterns (numpy.float16 array .view(numpy.uint16)) to float32",
+        nb::arg("out"),
+        nb::arg("x"));
 }
 
 void init_m_simd(nb::module_& m)
@@ -52,4 +178,6 @@ void init_m_simd(nb::module_& m)
 
     bind_fma<float>(m_math);
     bind_fma<double>(m_math);
+
+    bind_mixed_precision(m_math);
 }
@@ -5,6 +5,7 @@
 
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
 #include <nanobind/stl/vector.h>
 
 #include <sstream>
@@ -64,6 +65,42 @@ void init_akimainterpolator(nanobind::module_& m, const std::string& name)
              DOC(themachinethatgoesping, tools, vectorinterpolators, I_Interpolator, get_sampled_X),
              nb::arg("downsample_interval"),
              nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN())
+        .def("set_sampling_pyramid",
+             &t_AkimaInterpolator::set_sampling_pyramid,
+             DOC(themachinethatgoesping,
+                 tools,
+                 vectorinterpolators,
+                 I_Interpolator,
+                 set_sampling_pyramid),
+             nb::arg("base_interval"),
+             nb::arg("n_levels") = 16)
+        .def("get_sampling_pyramid_base_interval",
+             &t_AkimaInterpolator::get_sampling_pyramid_base_interval,
+             DOC(themachinethatgoesping,
+                 tools,
+                 vectorinterpolators,
+                 I_Interpolator,
+                 get_sampling_pyramid_base_interval))
+        .def("get_sampled_indices",
+             &t_AkimaInterpolator::get_sampled_indices,
+             DOC(themachinethatgoesping,
+                 tools,
+                 vectorinterpolators,
+                 I_Interpolator,
+                 get_sampled_indices),
+             nb::arg("downsample_interval"),
+             nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+             nb::arg("mp_cores") = 1)
+        .def("get_sampled_XY",
+             &t_AkimaInterpolator::get_sampled_XY,
+             DOC(themachinethatgoesping,
+                 tools,
+                 vectorinterpolators,
+                 I_Interpolator,
+                 get_sampled_XY),
+             nb::arg("downsample_interval"),
+             nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+             nb::arg("mp_cores") = 1)
         .def("empty",
              &t_AkimaInterpolator::empty,
              DOC(themachinethatgoesping, tools, vectorinterpolators, AkimaInterpolator, empty))
@@ -5,6 +5,7 @@
 
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
 #include <nanobind/stl/vector.h>
 
 #include <sstream>
@@ -94,6 +95,32 @@ void init_nearestinterpolator(nanobind::module_& m, const std::string& name)
            DOC(themachinethatgoesping, tools, vectorinterpolators, I_Interpolator, get_sampled_X),
            nb::arg("downsample_interval"),
            nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN())
+        .def("set_sampling_pyramid",
+             &t_NearestInterpolator::set_sampling_pyramid,
+             DOC(themachinethatgoesping,
+                 tools,
+                 vectorinterpolators,
+                 I_Interpolator,
+                 set_sampling_pyramid),
+             nb::arg("base_interval"),
+             nb::arg("n_levels") = 16)
+        .def("get_sampling_pyramid_base_interval",
+             &t_NearestInterpolator::get_sampling_pyramid_base_interval,
+             DOC(themachinethatgoesping,
+                 tools,
+                 vectorinterpolators,
+                 I_Interpolator,
+                 get_sampling_pyramid_base_interval))
+        .def("get_sampled_indices",
+             &t_NearestInterpolator::get_sampled_indices,
+             DOC(themachinethatgoesping,
+                 tools,
+                 vectorinterpolators,
+                 I_Interpolator,
+                 get_sampled_indices),
+             nb::arg("downsample_interval"),
+             nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+             nb::arg("mp_cores") = 1)
         .def("empty",
              &t_NearestInterpolator::empty,
              DOC(themachinethatgoesping, tools, vectorinterpolators, I_PairInterpolator, empty))
@@ -155,6 +182,21 @@ void init_nearestinterpolator(nanobind::module_& m, const std::string& name)
         __PYCLASS_DEFAULT_PRINTING__(t_NearestInterpolator)
         // end t_NearestInterpolator
         ;
+
+    // fused sampling is only available for scalar y values
+    if constexpr (is_xtensor_compatible_ytype<YType>())
+    {
+        cls.def("get_sampled_XY",
+                &t_NearestInterpolator::get_sampled_XY,
+                DOC(themachinethatgoesping,
+                    tools,
+                    vectorinterpolators,
+                    I_Interpolator,
+                    get_sampled_XY),
+                nb::arg("downsample_interval"),
+                nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+                nb::arg("mp_cores") = 1);
+    }
 }
 
 void init_c_nearestinterpolator(nanobind::module_& m)
@@ -123,6 +123,32 @@ void init_slerpinterpolator(nanobind::module_& m, const std::string& name)
             DOC(themachinethatgoesping, tools, vectorinterpolators, I_Interpolator, get_sampled_X),
             nb::arg("downsample_interval"),
             nb::arg("max_gap") = std::numeric_limits<double>::quiet_NaN())
+        .def("set_sampling_pyramid",
+             &t_SlerpInterpolator::set_sampling_pyramid,
+             DOC(themachinethatgoesping,
+                 tools,
+                 vectorinterpolators,
+                 I_Interpolator,
+                 set_sampling_pyramid),
+             nb::arg("base_interval"),
+             nb::arg("n_levels") = 16)
+        .def("get_sampling_pyramid_base_interval",
+             &t_SlerpInterpolator::get_sampling_pyramid_base_interval,
+             DOC(themachinethatgoesping,
+                 tools,
+                 vectorinterpolators,
+                 I_Interpolator,
+                 get_sampling_pyramid_base_interval))
+        .def("get_sampled_indices",
+             &t_SlerpInterpolator::get_sampled_indices,
+             DOC(themachinethatgoesping,
+                 tools,
+                 vectorinterpolators,
+                 I_Interpolator,
+                 get_sampled_indices),
+             nb::arg("downsample_interval"),
+             nb::arg("max_gap")  = std::numeric_limits<double>::quiet_NaN(),
+             nb::arg("mp_cores") = 1)
         .def("get_data_YPR",
              &t_SlerpInterpolator::get_data_YPR,
              DOC(themachinethatgoesping,
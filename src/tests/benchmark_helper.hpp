@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+// Shared timing helper for the *.benchmark.cpp files
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace benchmark_helper {
+
+/**
+ * @brief Measure the time of a single call of f in ns.
+ *
+ * f is repeated until at least min_time has passed; the best of `repetitions`
+ * such measurements is returned, which is the most stable estimate for
+ * throughput numbers.
+ */
+template<typename t_function>
+double measure_ns_per_call(t_function&& f, int repetitions = 5)
+{
+    using clock                     = std::chrono::steady_clock;
+    constexpr auto min_time         = std::chrono::milliseconds(20);
+    double         best_ns_per_call = std::numeric_limits<double>::max();
+
+    f(); // warm up (page faults, caches)
+
+    for (int r = 0; r < repetitions; ++r)
+    {
+        size_t calls = 0;
+        auto   start = clock::now();
+        auto   stop  = start;
+        do
+        {
+            f();
+            ++calls;
+            stop = clock::now();
+        } while (stop - start < min_time);
+
+        double ns = std::chrono::duration<double, std::nano>(stop - start).count() / double(calls);
+        best_ns_per_call = std::min(best_ns_per_call, ns);
+    }
+    return best_ns_per_call;
+}
+
+} // namespace benchmark_helper
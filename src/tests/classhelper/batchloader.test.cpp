@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <themachinethatgoesping/tools/classhelper/batchloader.hpp>
+
+#include "test_helper.hpp"
+
+using namespace std;
+using namespace themachinethatgoesping::tools;
+using classhelper::BatchLoader;
+using classhelper_test_helper::Tracker;
+
+#define TESTTAG "[classhelper]"
+
+namespace {
+struct TestFiles
+{
+    classhelper_test_helper::TemporaryDirectory directory{ "batchloader" };
+    std::vector<std::filesystem::path>          paths;
+    std::vector<Tracker>                        trackers;
+
+    explicit TestFiles(size_t n)
+        : trackers(classhelper_test_helper::make_trackers(n))
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            paths.push_back(directory / fmt::format("tracker_{}.bin", i));
+            std::ofstream ofs(paths.back(), std::ios::binary);
+            const auto    buffer = trackers[i].to_binary();
+            ofs.write(buffer.data(), std::streamsize(buffer.size()));
+        }
+    }
+};
+} // namespace
+
+TEST_CASE("BatchLoader loads serialized objects asynchronously", TESTTAG)
+{
+    TestFiles   files(50);
+    BatchLoader loader(4);
+    REQUIRE(loader.get_io_threads() == 4);
+
+    // futures
+    auto futures = loader.load_async<Tracker>(files.paths);
+    REQUIRE(futures.size() == files.paths.size());
+    for (size_t i = 0; i < futures.size(); ++i)
+        REQUIRE(futures[i].get() == files.trackers[i]);
+
+    // blocking batch load (file order)
+    REQUIRE(loader.load<Tracker>(files.paths) == files.trackers);
+
+    // callback in completion order
+    std::vector<Tracker> loaded(files.paths.size());
+    size_t               calls = 0;
+    loader.load<Tracker>(files.paths, [&](size_t index, Tracker&& tracker) {
+        loaded[index] = std::move(tracker);
+        ++calls;
+    });
+    REQUIRE(calls == files.paths.size());
+    REQUIRE(loaded == files.trackers);
+
+    // byte ranges and raw reads
+    const auto buffer = files.trackers[3].to_binary();
+    REQUIRE(loader.read_async(files.paths[3]).get() == buffer);
+    REQUIRE(loader.read_async(files.paths[3], 2, 5).get() == buffer.substr(2, 5));
+    REQUIRE(loader.load_async<Tracker>(files.paths[3], 0, buffer.size()).get() ==
+            files.trackers[3]);
+}
+
+TEST_CASE("BatchLoader reports read and deserialization errors", TESTTAG)
+{
+    TestFiles   files(5);
+    BatchLoader loader(2);
+
+    // missing file / range outside of the file
+    REQUIRE_THROWS_AS(loader.load_async<Tracker>(files.directory / "missing.bin").get(),
+                      std::runtime_error);
+    REQUIRE_THROWS_AS(loader.read_async(files.paths[0], 0, 1000000).get(), std::runtime_error);
+
+    // corrupt file
+    {
+        std::ofstream ofs(files.paths[2], std::ios::binary | std::ios::trunc);
+        ofs << "not a tracker";
+    }
+    REQUIRE_THROWS_AS(loader.load<Tracker>(files.paths), std::runtime_error);
+
+    size_t calls = 0;
+    REQUIRE_THROWS_AS(
+        loader.load<Tracker>(files.paths, [&](size_t, Tracker&&) { ++calls; }),
+        std::runtime_error);
+    REQUIRE(calls < files.paths.size());
+
+    // the loader is still usable
+    REQUIRE(loader.load_async<Tracker>(files.paths[1]).get() == files.trackers[1]);
+}
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <themachinethatgoesping/tools/classhelper/bytecursor.hpp>
+#include <themachinethatgoesping/tools/classhelper/classversion.hpp>
+#include <themachinethatgoesping/tools/classhelper/stream.hpp>
+#include <themachinethatgoesping/tools/helper/isviewstream.hpp>
+#include <themachinethatgoesping/tools/helper/osstream.hpp>
+#include <themachinethatgoesping/tools/helper/section_tracker.hpp>
+
+using namespace std;
+using namespace themachinethatgoesping::tools;
+using classhelper::ByteCursor;
+
+#define TESTTAG "[classhelper]"
+
+TEST_CASE("ByteCursor reads the stream layout", TESTTAG)
+{
+    std::vector<double>  values = { 1.5, -2.25, 3.0, 1e300 };
+    std::vector<int16_t> empty;
+
+    std::string buffer;
+    {
+        helper::osstream os(buffer);
+        classhelper::write_version(os, "Test_V1");
+        uint8_t flag = 7;
+        os.write(reinterpret_cast<const char*>(&flag), sizeof(flag)); // unaligns the payloads
+        classhelper::stream::container_to_stream(os, values);
+        classhelper::stream::container_to_stream(os, empty);
+        classhelper::stream::container_to_stream(os, values);
+    }
+
+    ByteCursor cursor(buffer);
+    cursor.read_version("Test_V1", "Test");
+    REQUIRE(cursor.read<uint8_t>() == 7);
+
+    // borrowed view into the buffer (no copy)
+    auto view = cursor.read_container_view<double>();
+    REQUIRE(view.size() == values.size());
+    REQUIRE(view.bytes().data() == buffer.data() + 7 + 1 + sizeof(size_t));
+    for (size_t i = 0; i < values.size(); ++i)
+        REQUIRE(view[i] == values[i]);
+    REQUIRE(view.to_vector() == values);
+    REQUIRE_THROWS_AS(view.at(values.size()), std::out_of_range);
+    if (!view.is_aligned())
+        REQUIRE_THROWS_AS(view.as_span(), std::runtime_error);
+
+    REQUIRE(cursor.read_container<std::vector<int16_t>>().empty());
+
+    // owning copy, same result as container_from_stream
+    REQUIRE(cursor.read_container<std::vector<double>>() == values);
+    REQUIRE(cursor.at_end());
+    REQUIRE_NOTHROW(cursor.check_at_end());
+
+    // reading past the end
+    REQUIRE_THROWS_AS(cursor.read<uint8_t>(), std::runtime_error);
+    ByteCursor truncated(std::string_view(buffer).substr(0, buffer.size() - 1));
+    truncated.skip(7 + 1 + 2 * sizeof(size_t) + sizeof(double) * values.size());
+    REQUIRE_THROWS_AS(truncated.read_container_view<double>(), std::runtime_error);
+
+    // wrong version
+    ByteCursor wrong_version(buffer);
+    REQUIRE_THROWS_AS(wrong_version.read_version("Test_V2", "Test"), std::runtime_error);
+}
+
+TEST_CASE("ByteCursor: from_binary matches from_stream", TESTTAG)
+{
+    helper::SectionTracker<float> tracker(1.5);
+    tracker.extend(std::vector<float>{ 0.f, 1.f, 2.f, 10.f, 10.5f, 20.f });
+
+    const std::string buffer = tracker.to_binary();
+
+    helper::isviewstream is(buffer);
+    auto                 from_stream = helper::SectionTracker<float>::from_stream(is);
+    auto                 from_binary = helper::SectionTracker<float>::from_binary(buffer, true);
+    REQUIRE(from_binary == from_stream);
+    REQUIRE(from_binary == tracker);
+
+    // trailing bytes are only an error when requested
+    REQUIRE(helper::SectionTracker<float>::from_binary(buffer + "xx") == tracker);
+    REQUIRE_THROWS_AS(helper::SectionTracker<float>::from_binary(buffer + "xx", true),
+                      std::runtime_error);
+
+    // truncated buffers throw instead of reading garbage
+    REQUIRE_THROWS_AS(
+        helper::SectionTracker<float>::from_binary(buffer.substr(0, buffer.size() - 1)),
+        std::runtime_error);
+}
@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <themachinethatgoesping/tools/classhelper/compression.hpp>
+#include <themachinethatgoesping/tools/classhelper/stream.hpp>
+#include <themachinethatgoesping/tools/helper/isviewstream.hpp>
+#include <themachinethatgoesping/tools/helper/osstream.hpp>
+
+using namespace std;
+using namespace themachinethatgoesping::tools;
+using namespace themachinethatgoesping::tools::classhelper::stream;
+namespace compression = classhelper::compression;
+
+#define TESTTAG "[classhelper]"
+
+namespace {
+template<typename T_container>
+T_container roundtrip(const T_container& container, size_t* encoded_size = nullptr)
+{
+    std::string buffer;
+    {
+        helper::osstream os(buffer);
+        compressed_container_to_stream(os, container);
+    }
+    if (encoded_size)
+        *encoded_size = buffer.size();
+
+    // stream and cursor readers must agree
+    helper::isviewstream is(buffer);
+    auto                 from_stream = compressed_container_from_stream<T_container>(is);
+
+    classhelper::ByteCursor cursor(buffer);
+    auto                    from_cursor = compressed_container_from_cursor<T_container>(cursor);
+    REQUIRE(cursor.at_end());
+    REQUIRE(from_cursor == from_stream);
+
+    return from_stream;
+}
+} // namespace
+
+TEST_CASE("compression: encode / decode round trip", TESTTAG)
+{
+    // empty, single value, short runs and literals
+    REQUIRE(roundtrip(std::vector<double>{}).empty());
+    REQUIRE(roundtrip(std::vector<double>{ 1.5 }) == std::vector<double>{ 1.5 });
+    REQUIRE(roundtrip(std::vector<uint8_t>{ 1, 1, 2, 3, 3, 3, 4, 4, 4, 4, 5 }) ==
+            std::vector<uint8_t>{ 1, 1, 2, 3, 3, 3, 4, 4, 4, 4, 5 });
+
+    // long runs and long literal blocks (> 128 bytes)
+    std::vector<uint8_t> bytes(1000, 7);
+    for (size_t i = 300; i < 700; ++i)
+        bytes[i] = uint8_t(i * 31);
+    REQUIRE(roundtrip(bytes) == bytes);
+
+    // structs (element size > 8)
+    std::vector<std::array<float, 3>> vectors;
+    for (size_t i = 0; i < 500; ++i)
+        vectors.push_back({ float(i), 1.f, float(i % 7) });
+    REQUIRE(roundtrip(vectors) == vectors);
+}
+
+TEST_CASE("compression: sorted timestamps shrink", TESTTAG)
+{
+    std::vector<double> timestamps;
+    for (size_t i = 0; i < 10000; ++i)
+        timestamps.push_back(1.7e9 + double(i) * 0.25);
+
+    size_t encoded_size = 0;
+    REQUIRE(roundtrip(timestamps, &encoded_size) == timestamps);
+    REQUIRE(encoded_size < timestamps.size() * sizeof(double) / 4);
+
+    // constant values compress to (almost) nothing
+    std::vector<float> constant(10000, 42.f);
+    REQUIRE(roundtrip(constant, &encoded_size) == constant);
+    REQUIRE(encoded_size < 1000);
+}
+
+TEST_CASE("compression: corrupt data throws", TESTTAG)
+{
+    std::vector<double> values(100, 1.);
+
+    // truncated encoded payload
+    const auto encoded = compression::encode(values.data(), values.size(), sizeof(double));
+    std::vector<double> decoded(values.size());
+    REQUIRE_THROWS_AS(compression::decode(std::string_view(encoded).substr(0, encoded.size() - 1),
+                                          decoded.data(),
+                                          decoded.size(),
+                                          sizeof(double)),
+                      std::runtime_error);
+
+    // wrong element count
+    REQUIRE_THROWS_AS(
+        compression::decode(encoded, decoded.data(), decoded.size() - 1, sizeof(double)),
+        std::runtime_error);
+
+    // truncated stream
+    std::stringstream ss;
+    compressed_container_to_stream(ss, values);
+    std::stringstream truncated(ss.str().substr(0, ss.str().size() - 1));
+    REQUIRE_THROWS_AS(compressed_container_from_stream<std::vector<double>>(truncated),
+                      std::runtime_error);
+
+    // corrupt sizes throw before anything is allocated (no std::bad_alloc)
+    const auto corrupt_header = [](size_t size, size_t encoded_size) {
+        std::string buffer;
+        const auto  codec = compression::t_codec::xor_shuffle_rle;
+        buffer.append(reinterpret_cast<const char*>(&size), sizeof(size));
+        buffer.append(reinterpret_cast<const char*>(&codec), sizeof(codec));
+        buffer.append(reinterpret_cast<const char*>(&encoded_size), sizeof(encoded_size));
+        buffer.append(16, '\0');
+        return buffer;
+    };
+    for (const auto& buffer : { corrupt_header(size_t(1) << 60, 16),
+                                corrupt_header(10, size_t(1) << 60),
+                                corrupt_header(size_t(-1), size_t(-1)) })
+    {
+        std::stringstream is(buffer);
+        REQUIRE_THROWS_AS(compressed_container_from_stream<std::vector<double>>(is),
+                          std::runtime_error);
+
+        classhelper::ByteCursor cursor(buffer);
+        REQUIRE_THROWS_AS(compressed_container_from_cursor<std::vector<double>>(cursor),
+                          std::runtime_error);
+    }
+}
+
+TEST_CASE("compression: large containers are written in hashed chunks", TESTTAG)
+{
+    // 3 chunks (the last one partial)
+    const size_t        chunk_elements = classhelper::hash_chunk_elements<double>();
+    std::vector<double> values;
+    for (size_t i = 0; i < 2 * chunk_elements + 1000; ++i)
+        values.push_back(1.7e9 + double(i) * 0.1);
+
+    std::string buffer;
+    {
+        helper::osstream          os(buffer);
+        classhelper::BinaryHasher hasher;
+        compressed_container_to_stream(os, values, 4, &hasher);
+
+        // the hash computed while writing equals the hash of update_container
+        classhelper::BinaryHasher reference;
+        reference.update_container(values);
+        REQUIRE(hasher.digest() == reference.digest());
+    }
+    REQUIRE(buffer.size() < values.size() * sizeof(double) / 2);
+
+    classhelper::ByteCursor cursor(buffer);
+    REQUIRE(compressed_container_from_cursor<std::vector<double>>(cursor, 4) == values);
+    REQUIRE(cursor.at_end());
+
+    helper::isviewstream is(buffer);
+    REQUIRE(compressed_container_from_stream<std::vector<double>>(is, 1) == values);
+
+    // the chunk table stores the chunk hashes
+    const auto hashes = classhelper::chunk_hashes(values, 2);
+    REQUIRE(hashes.size() == 3);
+    REQUIRE(hashes[0] == xxh::xxhash3<64>(values.data(), chunk_elements * sizeof(double)));
+    REQUIRE(std::string_view(buffer).substr(4 * sizeof(size_t) + 1, sizeof(uint64_t)) ==
+            std::string_view(reinterpret_cast<const char*>(hashes.data()), sizeof(uint64_t)));
+
+    // large containers are still hashed like container_to_stream (not as chunk hashes)
+    std::string raw;
+    {
+        helper::osstream os(raw);
+        container_to_stream(os, values);
+    }
+    classhelper::BinaryHasher hasher;
+    hasher.update_container(values);
+    REQUIRE(hasher.digest() == xxh::xxhash3<64>(raw.data(), raw.size()));
+
+    // a corrupt chunk size must not produce an empty chunk table (overflow of the chunk count)
+    {
+        std::string  corrupt;
+        const size_t size           = 10;
+        const auto   codec          = compression::t_codec::chunked;
+        const size_t encoded_size   = 2 * sizeof(size_t);
+        const size_t chunk_elements = std::numeric_limits<size_t>::max();
+        const size_t n_chunks       = 0;
+        for (const auto* value : { &size, &encoded_size, &chunk_elements, &n_chunks })
+        {
+            corrupt.append(reinterpret_cast<const char*>(value), sizeof(size_t));
+            if (value == &size)
+                corrupt.append(reinterpret_cast<const char*>(&codec), sizeof(codec));
+        }
+
+        classhelper::ByteCursor corrupt_cursor(corrupt);
+        REQUIRE_THROWS_AS(compressed_container_from_cursor<std::vector<double>>(corrupt_cursor),
+                          std::runtime_error);
+    }
+
+    // a corrupted chunk is detected by its hash
+    buffer[buffer.size() - 10] ^= 0x01;
+    classhelper::ByteCursor corrupted(buffer);
+    REQUIRE_THROWS_AS(compressed_container_from_cursor<std::vector<double>>(corrupted, 4),
+                      std::runtime_error);
+}
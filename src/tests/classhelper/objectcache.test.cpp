@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <themachinethatgoesping/tools/classhelper/objectcache.hpp>
+
+#include "test_helper.hpp"
+
+using namespace std;
+using namespace themachinethatgoesping::tools;
+using classhelper::ObjectCache;
+using classhelper_test_helper::Tracker;
+
+#define TESTTAG "[classhelper]"
+
+namespace {
+Tracker make_tracker(size_t i)
+{
+    return classhelper_test_helper::make_tracker(i, 100 + i);
+}
+} // namespace
+
+TEST_CASE("ObjectCache caches objects by key", TESTTAG)
+{
+    const size_t tracker_size = make_tracker(0).to_binary().size();
+    ObjectCache  cache(10 * tracker_size);
+
+    size_t computations = 0;
+    auto   compute      = [&](size_t i) {
+        return [&, i]() {
+            ++computations;
+            return make_tracker(i);
+        };
+    };
+
+    REQUIRE(cache.get_or_compute<Tracker>(1, compute(1)) == make_tracker(1));
+    REQUIRE(cache.get_or_compute<Tracker>(1, compute(1)) == make_tracker(1));
+    REQUIRE(computations == 1);
+    REQUIRE(cache.get<Tracker>(1) == make_tracker(1));
+    REQUIRE_FALSE(cache.get<Tracker>(2).has_value());
+
+    // different keys with the same result share one buffer
+    cache.get_or_compute<Tracker>(2, compute(1));
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.get_number_of_buffers() == 1);
+
+    auto statistics = cache.get_statistics();
+    REQUIRE(statistics.hits == 2);
+    REQUIRE(statistics.misses == 2);
+    REQUIRE(statistics.lookup_misses == 1);
+    REQUIRE(statistics.evictions == 0);
+
+    // least recently used buffers are evicted
+    for (size_t i = 10; i < 30; ++i)
+        cache.put(i, make_tracker(i));
+    REQUIRE(cache.get_memory_bytes() <= cache.get_max_memory_bytes());
+    REQUIRE(cache.get_statistics().evictions > 0);
+    REQUIRE_FALSE(cache.contains(1));
+    REQUIRE(cache.contains(29));
+
+    // failed computations are not cached
+    REQUIRE_THROWS_AS(cache.get_or_compute<Tracker>(
+                          3, []() -> Tracker { throw std::runtime_error("failed"); }),
+                      std::runtime_error);
+    REQUIRE_FALSE(cache.contains(3));
+
+    cache.clear();
+    REQUIRE(cache.size() == 0);
+    REQUIRE(cache.get_memory_bytes() == 0);
+    cache.reset_statistics();
+    REQUIRE(cache.get_statistics().hits == 0);
+}
+
+TEST_CASE("ObjectCache computes concurrent requests only once", TESTTAG)
+{
+    ObjectCache         cache(1 << 20);
+    std::atomic<size_t> computations = 0;
+
+    std::vector<std::thread> threads;
+    std::vector<Tracker>     results(8);
+    for (size_t t = 0; t < results.size(); ++t)
+        threads.emplace_back([&, t]() {
+            results[t] = cache.get_or_compute<Tracker>(42, [&]() {
+                ++computations;
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                return make_tracker(42);
+            });
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(computations == 1);
+    for (const auto& result : results)
+        REQUIRE(result == make_tracker(42));
+
+    const auto statistics = cache.get_statistics();
+    REQUIRE(statistics.misses == 1);
+    REQUIRE(statistics.hits + statistics.waits == results.size() - 1);
+}
+
+TEST_CASE("ObjectCache spills evicted objects to disk", TESTTAG)
+{
+    const classhelper_test_helper::TemporaryDirectory directory("objectcache");
+    const auto                                        spill_file = directory / "spill.bin";
+
+    const size_t tracker_size = make_tracker(0).to_binary().size();
+    {
+        ObjectCache cache(3 * tracker_size, spill_file);
+        REQUIRE(cache.has_spill_file());
+
+        for (size_t i = 0; i < 10; ++i)
+            cache.put(i, make_tracker(i));
+        cache.put(100, make_tracker(0)); // same content as key 0
+        REQUIRE(cache.get_statistics().spills > 0);
+
+        // evicted keys are loaded from disk
+        REQUIRE(cache.contains(0));
+        REQUIRE(cache.get<Tracker>(0) == make_tracker(0));
+        REQUIRE(cache.get_statistics().disk_hits == 1);
+
+        cache.flush();
+    }
+
+    // another cache (e.g. a later process) reuses the spilled results
+    ObjectCache cache(3 * tracker_size, spill_file);
+    size_t      computations = 0;
+    for (size_t i = 0; i < 10; ++i)
+        REQUIRE(cache.get_or_compute<Tracker>(i, [&]() {
+            ++computations;
+            return make_tracker(i);
+        }) == make_tracker(i));
+    REQUIRE(cache.get<Tracker>(100) == make_tracker(0));
+    REQUIRE(computations == 0);
+    REQUIRE(cache.get_statistics().disk_hits > 0);
+}
+
+TEST_CASE("ObjectCache spills objects keyed by their own binary_hash", TESTTAG)
+{
+    const classhelper_test_helper::TemporaryDirectory directory("objectcache");
+    const auto                                        spill_file = directory / "spill.bin";
+
+    // keys are equal to content hashes (key and content records must not collide)
+    const size_t tracker_size = make_tracker(0).to_binary().size();
+    {
+        ObjectCache cache(2 * tracker_size, spill_file);
+        for (size_t i = 0; i < 5; ++i)
+            cache.put(make_tracker(i).binary_hash(), make_tracker(i));
+        // key of tracker 1 maps to tracker 0
+        cache.put(make_tracker(1).binary_hash() + 1, make_tracker(0));
+        REQUIRE(cache.get_statistics().spills > 0);
+
+        REQUIRE(cache.contains(make_tracker(0).binary_hash()));
+        REQUIRE(cache.get<Tracker>(make_tracker(0).binary_hash()) == make_tracker(0));
+        REQUIRE(cache.get_statistics().disk_hits == 1);
+
+        cache.flush();
+    }
+
+    ObjectCache cache(2 * tracker_size, spill_file);
+    for (size_t i = 0; i < 5; ++i)
+    {
+        REQUIRE(cache.contains(make_tracker(i).binary_hash()));
+        REQUIRE(cache.get<Tracker>(make_tracker(i).binary_hash()) == make_tracker(i));
+    }
+    REQUIRE(cache.get<Tracker>(make_tracker(1).binary_hash() + 1) == make_tracker(0));
+    REQUIRE(cache.get_statistics().lookup_misses == 0);
+}
+
+TEST_CASE("ObjectCache spills to disk while other threads read", TESTTAG)
+{
+    const classhelper_test_helper::TemporaryDirectory directory("objectcache");
+    const auto                                        spill_file = directory / "spill.bin";
+
+    // memory for 4 buffers: most requests evict (and spill) or load from disk
+    const size_t tracker_size = make_tracker(0).to_binary().size();
+    {
+        ObjectCache cache(4 * tracker_size, spill_file);
+
+        std::vector<std::thread> threads;
+        std::atomic<size_t>      wrong_results = 0;
+        for (size_t t = 0; t < 4; ++t)
+            threads.emplace_back([&, t]() {
+                for (size_t round = 0; round < 3; ++round)
+                    for (size_t i = 0; i < 20; ++i)
+                    {
+                        const size_t key = (i + 5 * t) % 20;
+                        if (cache.get_or_compute<Tracker>(key, [key]() {
+                                return make_tracker(key);
+                            }) != make_tracker(key))
+                            ++wrong_results;
+                    }
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(wrong_results == 0);
+        REQUIRE(cache.get_memory_bytes() <= cache.get_max_memory_bytes());
+        REQUIRE(cache.get_statistics().disk_hits > 0);
+        cache.flush();
+    }
+
+    ObjectCache cache(4 * tracker_size, spill_file);
+    for (size_t key = 0; key < 20; ++key)
+        REQUIRE(cache.get<Tracker>(key) == make_tracker(key));
+    REQUIRE(cache.get_statistics().lookup_misses == 0);
+}
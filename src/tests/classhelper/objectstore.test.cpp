@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include <themachinethatgoesping/tools/classhelper/objectstore.hpp>
+
+#include "test_helper.hpp"
+
+using namespace std;
+using namespace themachinethatgoesping::tools;
+using classhelper::ObjectStore;
+using classhelper_test_helper::make_trackers;
+using classhelper_test_helper::Tracker;
+
+#define TESTTAG "[classhelper]"
+
+TEST_CASE("ObjectStore stores and maps objects by binary_hash", TESTTAG)
+{
+    const classhelper_test_helper::TemporaryDirectory directory("objectstore");
+    const auto                                        file_path = directory / "store.bin";
+
+    const auto            trackers = make_trackers(20);
+    std::vector<uint64_t> hashes;
+    {
+        ObjectStore store(file_path);
+        REQUIRE(store.empty());
+
+        hashes.push_back(store.add(trackers[0]));
+        REQUIRE(hashes[0] == trackers[0].binary_hash());
+        REQUIRE(store.get<Tracker>(hashes[0]) == trackers[0]);
+
+        // batch add, duplicates are only stored once
+        auto batch_hashes = store.add(std::vector<Tracker>(trackers.begin(), trackers.end()));
+        REQUIRE(batch_hashes.size() == trackers.size());
+        REQUIRE(store.size() == trackers.size());
+        REQUIRE_FALSE(store.add_buffer(hashes[0], trackers[0].to_binary()));
+        hashes = batch_hashes;
+    }
+
+    // reopen: the index is rebuilt from the file
+    ObjectStore store(file_path);
+    REQUIRE(store.size() == trackers.size());
+    REQUIRE(store.get_keys() == hashes);
+    REQUIRE(store.get_file_size() == std::filesystem::file_size(file_path));
+
+    for (size_t i = 0; i < trackers.size(); ++i)
+        REQUIRE(store.get<Tracker>(hashes[i]) == trackers[i]);
+
+    REQUIRE(store.get<Tracker>(hashes) == trackers);
+    REQUIRE(store.get_all<Tracker>(4) == trackers);
+
+    // zero copy access to the stored buffers
+    REQUIRE(store.get_buffer(hashes[3]) == trackers[3].to_binary());
+    auto cursor = store.get_cursor(hashes[3]);
+    REQUIRE(Tracker::from_cursor(cursor) == trackers[3]);
+    REQUIRE(cursor.at_end());
+
+    REQUIRE_THROWS_AS(store.get_buffer(12345), std::out_of_range);
+    store.close();
+
+    // an interrupted (or still running) write is ignored when opening the store, the file is only
+    // truncated by repair
+    const auto complete_size = std::filesystem::file_size(file_path);
+    {
+        std::ofstream ofs(file_path, std::ios::binary | std::ios::app);
+        uint64_t      hash = 1, size = 1000;
+        ofs.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+        ofs.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        ofs.write("abc", 3);
+    }
+    ObjectStore recovered(file_path);
+    REQUIRE(recovered.size() == trackers.size());
+    REQUIRE(recovered.get_file_size() == complete_size);
+    REQUIRE(std::filesystem::file_size(file_path) == complete_size + 19);
+    REQUIRE(recovered.get_all<Tracker>() == trackers);
+    REQUIRE_THROWS_AS(recovered.add(make_trackers(21).back()), std::runtime_error);
+    REQUIRE(recovered.size() == trackers.size());
+
+    recovered.repair();
+    REQUIRE(std::filesystem::file_size(file_path) == complete_size);
+    REQUIRE(recovered.add(make_trackers(21).back()) != 0);
+    REQUIRE(recovered.get_all<Tracker>().back() == make_trackers(21).back());
+    recovered.close();
+
+    // not a store file
+    {
+        std::ofstream ofs(file_path, std::ios::binary | std::ios::trunc);
+        ofs << "something else";
+    }
+    REQUIRE_THROWS_AS(ObjectStore(file_path), std::runtime_error);
+}
+
+TEST_CASE("ObjectStore indexes records appended by another store", TESTTAG)
+{
+    const classhelper_test_helper::TemporaryDirectory directory("objectstore");
+    const auto                                        file_path = directory / "store.bin";
+
+    const auto  trackers = make_trackers(4);
+    ObjectStore writer1(file_path);
+    ObjectStore writer2(file_path);
+
+    // e.g. two processes that append one after the other
+    const auto hash0 = writer1.add(trackers[0]);
+    const auto hash1 = writer2.add(trackers[1]);
+    REQUIRE(writer2.contains(hash0));
+    REQUIRE(writer2.get<Tracker>(hash0) == trackers[0]);
+    REQUIRE(writer2.get<Tracker>(hash1) == trackers[1]);
+
+    // already stored by the other store: not appended again
+    REQUIRE_FALSE(writer1.add_buffer(hash1, trackers[1].to_binary()));
+    REQUIRE(writer1.get<Tracker>(hash1) == trackers[1]);
+
+    const auto hashes = writer1.add(std::vector<Tracker>{ trackers[2], trackers[3], trackers[2] });
+    REQUIRE(hashes[0] == hashes[2]);
+    REQUIRE(writer1.size() == 4);
+    REQUIRE(writer1.get_file_size() == std::filesystem::file_size(file_path));
+
+    ObjectStore reader(file_path);
+    REQUIRE(reader.get_all<Tracker>() == trackers);
+}
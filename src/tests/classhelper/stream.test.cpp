@@ -0,0 +1,230 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <themachinethatgoesping/tools/classhelper/compression.hpp>
+#include <themachinethatgoesping/tools/classhelper/option.hpp>
+#include <themachinethatgoesping/tools/classhelper/stream.hpp>
+#include <themachinethatgoesping/tools/helper/isviewstream.hpp>
+#include <themachinethatgoesping/tools/helper/osstream.hpp>
+#include <themachinethatgoesping/tools/helper/section_tracker.hpp>
+#include <themachinethatgoesping/tools/vectorinterpolators/linearinterpolator.hpp>
+
+using namespace std;
+using namespace themachinethatgoesping::tools;
+using namespace themachinethatgoesping::tools::classhelper::stream;
+
+#define TESTTAG "[classhelper]"
+
+namespace {
+struct TestData
+{
+    std::vector<double>                        values;
+    std::map<int32_t, double>                  map;
+    std::map<uint16_t, std::vector<float>>     map_container;
+    std::set<int64_t>                          set;
+    std::vector<std::vector<std::vector<int>>> nested;
+    std::optional<double>                      optional;
+    std::optional<std::vector<uint8_t>>        optional_container;
+    std::optional<std::set<char>>              optional_set;
+
+    bool operator==(const TestData&) const = default;
+
+    // writes through the static stream type (std::ostream, helper::osstream, ...)
+    template<typename T_ostream>
+    void write(T_ostream& os) const
+    {
+        container_to_stream(os, values);
+        map_to_stream(os, map);
+        map_container_to_stream(os, map_container);
+        set_to_stream(os, set);
+        container_container_to_stream<2>(os, nested);
+        optional_to_stream(os, optional);
+        optional_container_to_stream(os, optional_container);
+        optional_set_to_stream(os, optional_set);
+    }
+
+    template<typename T_istream>
+    static TestData read(T_istream& is)
+    {
+        TestData data;
+        data.values             = container_from_stream<decltype(values)>(is);
+        data.map                = map_from_stream<decltype(map)>(is);
+        data.map_container      = map_container_from_stream<decltype(map_container)>(is);
+        data.set                = set_from_stream<int64_t>(is);
+        data.nested             = container_container_from_stream<2, decltype(nested)>(is);
+        data.optional           = optional_from_stream<double>(is);
+        data.optional_container = optional_container_from_stream<std::vector<uint8_t>>(is);
+        data.optional_set       = optional_set_from_stream<char>(is);
+        return data;
+    }
+};
+
+/**
+ * osstream / ospanstream that drops every write that goes through the std::streambuf interface
+ * (the stream goes bad), so only writes through write_direct reach the buffer
+ */
+template<typename T_base>
+class direct_only_stream : public T_base
+{
+  public:
+    using T_base::T_base;
+
+  protected:
+    std::streamsize xsputn(const char*, std::streamsize) override { return 0; }
+
+    std::streambuf::int_type overflow(std::streambuf::int_type) override
+    {
+        return std::streambuf::traits_type::eof();
+    }
+};
+
+TestData make_test_data(size_t n)
+{
+    TestData data;
+    for (size_t i = 0; i < n; ++i)
+    {
+        data.values.push_back(double(i) * 0.5);
+        data.map[int32_t(i) - 7] = double(i) / 3;
+        data.map_container[uint16_t(i)].assign(i % 5, float(i));
+        data.set.insert(int64_t(i * i) - 100);
+        data.nested.push_back(
+            std::vector<std::vector<int>>(i % 3, std::vector<int>(i % 4, int(i))));
+    }
+    data.optional           = 1.25;
+    data.optional_container = std::vector<uint8_t>{ 1, 2, 3 };
+    data.optional_set       = std::set<char>{ 'a', 'z' };
+    return data;
+}
+} // namespace
+
+TEST_CASE("stream functions produce the same layout for all stream types", TESTTAG)
+{
+    // small data and data larger than the write block of StreamWriter
+    for (size_t n : { 0, 3, 2000 })
+    {
+        const auto data = make_test_data(n);
+
+        // generic std::ostream (buffered) / std::istream
+        std::stringstream ss;
+        data.write(static_cast<std::ostream&>(ss));
+        const std::string reference = ss.str();
+
+        // osstream fast path
+        std::string      buffer;
+        helper::osstream os(buffer);
+        data.write(os);
+        REQUIRE(buffer == reference);
+
+        // reading with the generic path and the isviewstream fast path
+        REQUIRE(TestData::read(static_cast<std::istream&>(ss)) == data);
+        helper::isviewstream is(buffer);
+        REQUIRE(TestData::read(is) == data);
+        REQUIRE(is.good());
+        REQUIRE(is.tellg() == std::streampos(buffer.size()));
+    }
+
+    // empty optionals
+    TestData empty;
+    std::string      buffer;
+    helper::osstream os(buffer);
+    empty.write(os);
+    helper::isviewstream is(buffer);
+    REQUIRE(TestData::read(is) == empty);
+}
+
+TEST_CASE("stream functions: reading past the end sets the stream state", TESTTAG)
+{
+    std::string      buffer;
+    helper::osstream os(buffer);
+    container_to_stream(os, std::vector<double>{ 1, 2, 3 });
+
+    helper::isviewstream is(std::string_view(buffer).substr(0, buffer.size() - 1));
+    container_from_stream<std::vector<double>>(is);
+    REQUIRE(is.fail());
+    REQUIRE(is.eof());
+
+    // reading from a failed stream only sets failbit
+    helper::isviewstream failed(buffer);
+    failed.setstate(std::ios_base::failbit);
+    char value;
+    failed.read_direct(&value, sizeof(value));
+    REQUIRE(failed.fail());
+    REQUIRE_FALSE(failed.eof());
+}
+
+TEST_CASE("ospanstream writes into a fixed size buffer", TESTTAG)
+{
+    const auto  data = make_test_data(100);
+    std::string reference;
+    {
+        helper::osstream os(reference);
+        data.write(os);
+    }
+
+    // same bytes as osstream
+    std::vector<char>   buffer(reference.size());
+    helper::ospanstream os(buffer);
+    data.write(os);
+    REQUIRE(os.good());
+    REQUIRE(os.size() == reference.size());
+    REQUIRE(std::string(buffer.begin(), buffer.end()) == reference);
+
+    // writing past the end sets badbit and does not write outside the buffer
+    std::vector<char>   small(reference.size() + 8, 'x');
+    helper::ospanstream os_small(std::span<char>(small.data(), reference.size() - 1));
+    data.write(os_small);
+    REQUIRE(os_small.bad());
+    REQUIRE(os_small.size() <= reference.size() - 1);
+    REQUIRE(small.back() == 'x');
+    REQUIRE(small[reference.size() - 1] == 'x');
+}
+
+TEST_CASE("to_binary and to_binary_into write through write_direct", TESTTAG)
+{
+    // the static stream type reaches the stream functions: the streambuf interface is never used
+    const auto check = [](const auto& object, auto... encoding) {
+        const std::string reference = object.to_binary(true, encoding...);
+
+        std::string                          buffer;
+        direct_only_stream<helper::osstream> os(buffer);
+        object.to_stream(os, encoding...);
+        REQUIRE(os.good());
+        REQUIRE(buffer == reference);
+
+        std::vector<char>                       span_buffer(reference.size());
+        direct_only_stream<helper::ospanstream> span_os(span_buffer);
+        object.to_stream(span_os, encoding...);
+        REQUIRE(span_os.good());
+        REQUIRE(std::string(span_buffer.begin(), span_buffer.end()) == reference);
+        REQUIRE(object.to_binary_into(span_buffer, encoding...) == reference.size());
+    };
+
+    helper::SectionTracker<double> tracker(1.5);
+    tracker.extend(std::vector<double>{ 1, 2, 5, 6, 7 });
+    check(tracker);
+    check(tracker.__printer__(3, false));
+    check(classhelper::Option<classhelper::t_binary_encoding>(
+        classhelper::t_binary_encoding::compressed));
+
+    std::vector<double> X(5000), Y(5000);
+    for (size_t i = 0; i < X.size(); ++i)
+    {
+        X[i] = double(i);
+        Y[i] = double(i % 7);
+    }
+    vectorinterpolators::LinearInterpolator<double, double> interpolator(X, Y);
+    check(interpolator, classhelper::t_binary_encoding::raw);
+    check(interpolator, classhelper::t_binary_encoding::compressed);
+}
@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <themachinethatgoesping/tools/classhelper/taggedfields.hpp>
+#include <themachinethatgoesping/tools/helper/isviewstream.hpp>
+#include <themachinethatgoesping/tools/helper/osstream.hpp>
+
+using namespace std;
+using namespace themachinethatgoesping::tools;
+using classhelper::TaggedFields;
+
+#define TESTTAG "[classhelper]"
+
+namespace {
+struct Record
+{
+    double              value  = 1.5;
+    int32_t             count  = 7;
+    std::vector<double> values = { 1, 2, 3, 4 };
+
+    template<typename T_fields>
+    void visit_fields(T_fields& fields) const
+    {
+        fields.write_value(1, value);
+        fields.write_container(2, values);
+        fields.write_value(3, count);
+        fields.finish();
+    }
+
+    std::string to_binary() const
+    {
+        std::string      buffer;
+        helper::osstream os(buffer);
+        {
+            classhelper::TaggedFieldWriter fields(os);
+            visit_fields(fields);
+        }
+        return buffer;
+    }
+};
+} // namespace
+
+TEST_CASE("TaggedFields: write and read records", TESTTAG)
+{
+    const Record record;
+    const auto   buffer = record.to_binary();
+
+    // the sizer and the hasher see the same bytes as the writer
+    classhelper::TaggedFieldSizer sizer;
+    record.visit_fields(sizer);
+    REQUIRE(sizer.size() == buffer.size());
+
+    classhelper::BinaryHasher      hasher;
+    classhelper::TaggedFieldHasher field_hasher(hasher);
+    record.visit_fields(field_hasher);
+    classhelper::BinaryHasher reference;
+    reference.update(buffer.data(), buffer.size());
+    REQUIRE(hasher.digest() == reference.digest());
+
+    // zero copy index
+    classhelper::ByteCursor cursor(buffer);
+    const auto              fields = TaggedFields::from_cursor(cursor);
+    REQUIRE(cursor.at_end());
+    REQUIRE(fields.get_tags() == std::vector<classhelper::t_field_tag>{ 1, 2, 3 });
+    REQUIRE(fields.read_value<double>(1) == record.value);
+    REQUIRE(fields.read_value<int32_t>(3) == record.count);
+    REQUIRE(fields.read_container<std::vector<double>>(2) == record.values);
+    REQUIRE(fields.read_container_view<double>(2).size() == record.values.size());
+    REQUIRE(fields.get_bytes(2).data() > buffer.data());
+    REQUIRE(fields.get_bytes(2).data() < buffer.data() + buffer.size());
+
+    // stream reading (all fields)
+    std::stringstream ss(buffer);
+    const auto        stream_fields = TaggedFields::from_stream(ss);
+    REQUIRE(stream_fields.get_tags() == fields.get_tags());
+    REQUIRE(stream_fields.read_container<std::vector<double>>(2) == record.values);
+
+    // missing fields, wrong sizes
+    REQUIRE_FALSE(fields.has(4));
+    REQUIRE(fields.read_value<int64_t>(4, -1) == -1);
+    REQUIRE_THROWS_AS(fields.read_value<int64_t>(4), std::runtime_error);
+    REQUIRE_THROWS_AS(fields.read_value<float>(1), std::runtime_error);
+
+    // the end of fields tag is reserved
+    std::string      invalid;
+    helper::osstream os(invalid);
+    REQUIRE_THROWS_AS(classhelper::TaggedFieldWriter(os).write_value(0, 1.0),
+                      std::invalid_argument);
+}
+
+TEST_CASE("TaggedFields: unknown and unneeded fields are skipped", TESTTAG)
+{
+    // a "newer" writer adds fields the reader does not know, followed by more data
+    std::string buffer;
+    {
+        helper::osstream               os(buffer);
+        classhelper::TaggedFieldWriter fields(os);
+        fields.write_value(1, 2.5);
+        fields.write_container(100, std::vector<float>(1000, 1.f));
+        fields.write_bytes(101, "opaque nested object");
+        fields.write_value(3, int32_t(42));
+        fields.finish();
+    }
+    buffer += "trailing";
+
+    classhelper::ByteCursor cursor(buffer);
+    const auto              fields = TaggedFields::from_cursor(cursor);
+    REQUIRE(fields.read_value<double>(1) == 2.5);
+    REQUIRE(fields.read_value<int32_t>(3) == 42);
+    REQUIRE(fields.get_bytes(101) == "opaque nested object");
+    REQUIRE(cursor.read_bytes(cursor.remaining()) == "trailing");
+
+    // lazy stream reading: only the requested payloads are copied
+    helper::isviewstream is(buffer);
+    const auto           selected = TaggedFields::from_stream(is, { 1, 3 });
+    REQUIRE(selected.get_tags() == std::vector<classhelper::t_field_tag>{ 1, 3 });
+    REQUIRE(selected.read_value<int32_t>(3) == 42);
+
+    std::string trailing(8, '\0');
+    is.read(trailing.data(), 8);
+    REQUIRE(trailing == "trailing");
+}
+
+TEST_CASE("TaggedFields: corrupt records throw", TESTTAG)
+{
+    const auto buffer = Record().to_binary();
+
+    // truncated record
+    const auto              truncated = buffer.substr(0, buffer.size() - 1);
+    classhelper::ByteCursor cursor(truncated);
+    REQUIRE_THROWS_AS(TaggedFields::from_cursor(cursor), std::runtime_error);
+
+    std::stringstream ss(truncated);
+    REQUIRE_THROWS_AS(TaggedFields::from_stream(ss), std::runtime_error);
+
+    // field size larger than the buffer
+    auto corrupted = buffer;
+    corrupted[sizeof(classhelper::t_field_tag) + 7] = char(0x7f);
+    classhelper::ByteCursor corrupted_cursor(corrupted);
+    REQUIRE_THROWS_AS(TaggedFields::from_cursor(corrupted_cursor), std::runtime_error);
+
+    // stream reading does not allocate the corrupt size up front (read and skipped fields)
+    std::stringstream corrupted_stream(corrupted);
+    REQUIRE_THROWS_AS(TaggedFields::from_stream(corrupted_stream), std::runtime_error);
+    std::stringstream corrupted_skipped(corrupted);
+    REQUIRE_THROWS_AS(TaggedFields::from_stream(corrupted_skipped, { 3 }), std::runtime_error);
+
+    // a container field that does not match the payload size
+    classhelper::ByteCursor record_cursor(buffer);
+    const auto              fields = TaggedFields::from_cursor(record_cursor);
+    REQUIRE_THROWS_AS(fields.read_container<std::vector<float>>(2), std::runtime_error);
+}
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+// Shared test objects and temporary files for the classhelper storage tests
+
+#pragma once
+
+#include <filesystem>
+#include <random>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <themachinethatgoesping/tools/helper/section_tracker.hpp>
+
+namespace classhelper_test_helper {
+
+using Tracker = themachinethatgoesping::tools::helper::SectionTracker<double>;
+
+/**
+ * @brief Deterministic SectionTracker with n_values values (sections and gaps depend on i)
+ *
+ * Different i produce different objects (and different binary_hash values).
+ */
+inline Tracker make_tracker(size_t i, size_t n_values)
+{
+    Tracker tracker(1.5);
+    double  value = double(i);
+    for (size_t j = 0; j < n_values; ++j)
+        tracker.append(value += (j % 4 == 0 ? 3 : 1));
+    return tracker;
+}
+
+/**
+ * @brief n trackers, tracker i has base_values + i values
+ */
+inline std::vector<Tracker> make_trackers(size_t n, size_t base_values = 10)
+{
+    std::vector<Tracker> trackers;
+    trackers.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+        trackers.push_back(make_tracker(i, base_values + i));
+    return trackers;
+}
+
+/**
+ * @brief Uniquely named directory in temp_directory_path(), removed with its content on
+ * destruction
+ *
+ * Concurrent test runs (or tests of different processes) never share files.
+ */
+class TemporaryDirectory
+{
+    std::filesystem::path _path;
+
+  public:
+    explicit TemporaryDirectory(std::string_view name)
+    {
+        std::random_device                      seed;
+        std::mt19937_64                         generator((uint64_t(seed()) << 32) | seed());
+        std::uniform_int_distribution<uint64_t> distribution;
+
+        // create_directory fails if the directory exists, so the name is claimed atomically
+        do
+            _path = std::filesystem::temp_directory_path() /
+                    fmt::format("tools_{}_{:016x}", name, distribution(generator));
+        while (!std::filesystem::create_directory(_path));
+    }
+    ~TemporaryDirectory()
+    {
+        std::error_code error;
+        std::filesystem::remove_all(_path, error);
+    }
+
+    TemporaryDirectory(const TemporaryDirectory&)            = delete;
+    TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+
+    const std::filesystem::path& path() const { return _path; }
+
+    /**
+     * @brief Path of a file in the directory
+     */
+    std::filesystem::path operator/(std::string_view file_name) const { return _path / file_name; }
+};
+
+} // namespace classhelper_test_helper
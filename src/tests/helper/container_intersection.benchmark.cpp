@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+// Benchmarks for helper/container_intersection.
+//
+// Several sorted containers (like timestamps of different sensors) are split
+// into an increasing number of gap separated sections. The runtime per element
+// should stay (roughly) constant with the section count, because all functions
+// sweep elements and sections together in O(N + S).
+// A naive O(N * S) classification is printed for comparison for the smaller
+// section counts.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "../benchmark_helper.hpp"
+#include "../themachinethatgoesping/tools/helper/container_intersection.hpp"
+
+using namespace themachinethatgoesping::tools::helper;
+using benchmark_helper::measure_ns_per_call;
+
+#define TESTTAG "[container_intersection][benchmark]"
+
+namespace {
+
+/**
+ * @brief n_containers containers of n elements (spacing 1) with n_sections sections each.
+ * The gap positions are shifted per container, so that the shared sections are
+ * fragmented further (up to n_containers * n_sections shared sections).
+ */
+std::vector<std::vector<double>> make_containers(size_t n_containers,
+                                                 size_t n,
+                                                 size_t n_sections)
+{
+    std::vector<std::vector<double>> containers(n_containers);
+
+    const size_t section_length = std::max<size_t>(1, n / n_sections);
+    for (size_t c = 0; c < n_containers; ++c)
+    {
+        auto& container = containers[c];
+        container.resize(n);
+
+        const size_t phase  = c * section_length / n_containers;
+        double       offset = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (i > 0 && (i + phase) % section_length == 0)
+                offset += 10; // gap larger than max_gap
+            container[i] = double(i) * 1.0 + offset * (1 + double(c) * 1e-3);
+        }
+    }
+    return containers;
+}
+
+/// naive classification: every element against every shared section (old implementation)
+size_t naive_count_in_sections(const std::vector<std::vector<double>>& containers,
+                               const std::vector<Range<double>>&       sections)
+{
+    size_t count = 0;
+    for (const auto& container : containers)
+        for (double v : container)
+            for (const auto& section : sections)
+                if (section.contains(v))
+                {
+                    ++count;
+                    break;
+                }
+    return count;
+}
+
+void print_header(const std::string& title)
+{
+    fmt::print("\n{}\n", title);
+    fmt::print("{:<28} {:>10} {:>10} {:>14} {:>10}\n",
+               "function",
+               "sections",
+               "shared",
+               "ns/call",
+               "ns/elem");
+}
+
+void print_row(const std::string& function,
+               size_t             n_sections,
+               size_t             n_shared,
+               size_t             n_elements,
+               double             ns_per_call)
+{
+    fmt::print("{:<28} {:>10} {:>10} {:>14.0f} {:>10.3f}\n",
+               function,
+               n_sections,
+               n_shared,
+               ns_per_call,
+               ns_per_call / double(n_elements));
+}
+
+} // namespace
+
+TEST_CASE("benchmark container_intersection: scaling with section count", TESTTAG)
+{
+    const size_t n_containers = 10;
+    const size_t n            = 100'000;
+    const double max_gap      = 5.0;
+
+    print_header(fmt::format("{} containers x {} elements", n_containers, n));
+
+    for (size_t n_sections : { 1, 10, 100, 1000, 10000 })
+    {
+        const auto   containers = make_containers(n_containers, n, n_sections);
+        const auto   shared     = get_shared_sections(containers, max_gap);
+        const size_t n_elements = n_containers * n;
+
+        print_row("get_shared_sections",
+                  n_sections,
+                  shared.size(),
+                  n_elements,
+                  measure_ns_per_call([&] { return get_shared_sections(containers, max_gap); }));
+        print_row("cut_to_shared_sections",
+                  n_sections,
+                  shared.size(),
+                  n_elements,
+                  measure_ns_per_call([&] { return cut_to_shared_sections(containers, max_gap); }));
+        print_row(
+            "get_shared_section_indices",
+            n_sections,
+            shared.size(),
+            n_elements,
+            measure_ns_per_call([&] { return get_shared_section_indices(containers, max_gap); }));
+        print_row(
+            "get_shared_section_slices",
+            n_sections,
+            shared.size(),
+            n_elements,
+            measure_ns_per_call([&] { return get_shared_section_slices(containers, max_gap); }));
+        print_row(
+            "get_shared_section_mask",
+            n_sections,
+            shared.size(),
+            n_elements,
+            measure_ns_per_call([&] { return get_shared_section_mask(containers, max_gap); }));
+        print_row(
+            "get_shared_section_values",
+            n_sections,
+            shared.size(),
+            n_elements,
+            measure_ns_per_call([&] { return get_shared_section_values(containers, max_gap); }));
+
+        if (n_sections <= 1000)
+            print_row("naive classification",
+                      n_sections,
+                      shared.size(),
+                      n_elements,
+                      measure_ns_per_call(
+                          [&] { return naive_count_in_sections(containers, shared); }, 1));
+
+        // sanity check: both classifications agree
+        auto indices = get_shared_section_indices(containers, max_gap);
+        if (n_sections <= 100)
+        {
+            size_t n_indices = 0;
+            for (const auto& index : indices)
+                n_indices += index.size();
+            REQUIRE(n_indices == naive_count_in_sections(containers, shared));
+        }
+    }
+}
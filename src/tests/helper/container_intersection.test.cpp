@@ -5,8 +5,11 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <random>
+#include <set>
 #include <type_traits>
 #include <vector>
 
@@ -658,3 +661,266 @@ TEST_CASE("get_sections: consecutive identical values", TESTTAG)
     REQUIRE(result[1].min == 5.0);
     REQUIRE(result[1].max == 5.0);
 }
+
+// ============================================================================
+// get_shared_section_slices / get_shared_section_mask tests
+// ============================================================================
+
+TEST_CASE("get_shared_section_slices: one slice per shared section", TESTTAG)
+{
+    std::vector<std::vector<double>> containers = {
+        { 0.0, 1.0, 2.0, 10.0, 11.0, 12.0 },
+        { 1.5, 2.0, 2.5, 11.5, 12.0, 13.0 },
+    };
+
+    auto shared = get_shared_sections(containers, 2.0);
+    REQUIRE(shared.size() == 2);
+
+    auto slices = get_shared_section_slices(containers, 2.0);
+    REQUIRE(slices.size() == 2);
+    REQUIRE(slices[0] == std::vector<IndexSlice>{ { 2, 3 }, { 5, 6 } });
+    REQUIRE(slices[1] == std::vector<IndexSlice>{ { 0, 2 }, { 3, 5 } });
+    REQUIRE(slices[1][1].size() == 2);
+
+    auto mask = get_shared_section_mask(containers, 2.0);
+    REQUIRE(mask.size() == 2);
+    REQUIRE(mask[0].size() == 6);
+    REQUIRE(std::vector<bool>(mask[0].begin(), mask[0].end()) ==
+            std::vector<bool>{ false, false, true, false, false, true });
+    REQUIRE(std::vector<bool>(mask[1].begin(), mask[1].end()) ==
+            std::vector<bool>{ true, true, false, true, true, false });
+}
+
+TEST_CASE("get_shared_section_slices: empty containers and no overlap", TESTTAG)
+{
+    std::vector<std::vector<double>> empty;
+    REQUIRE(get_shared_section_slices(empty).empty());
+    REQUIRE(get_shared_section_mask(empty).empty());
+
+    std::vector<std::vector<double>> containers = { { 0.0, 1.0 }, { 5.0, 6.0 } };
+
+    auto slices = get_shared_section_slices(containers);
+    REQUIRE(slices.size() == 2);
+    REQUIRE(slices[0].empty());
+    REQUIRE(slices[1].empty());
+
+    auto mask = get_shared_section_mask(containers);
+    REQUIRE(mask.size() == 2);
+    REQUIRE(mask[0].size() == 2);
+    REQUIRE(std::none_of(mask[0].begin(), mask[0].end(), [](bool b) { return b; }));
+}
+
+// ============================================================================
+// Fragmented containers: compare against a brute force reference
+// ============================================================================
+
+namespace {
+/// random sorted container over [0, 1000) with many gap separated sections
+std::vector<double> make_fragmented_container(std::mt19937& gen)
+{
+    std::uniform_real_distribution<double> step(0.1, 1.0);
+    std::uniform_int_distribution<int>     gap(0, 29);
+
+    std::vector<double> data;
+    for (double t = step(gen) * 10; t < 1000.0;)
+    {
+        data.push_back(t);
+        t += gap(gen) == 0 ? 2.0 + step(gen) * 5 : step(gen);
+    }
+    return data;
+}
+
+/// O(R1 * R2) reference for the shared sections
+std::vector<Range<double>> reference_shared_sections(
+    const std::vector<std::vector<double>>& containers,
+    double                                  max_gap)
+{
+    auto result = get_sections(containers[0], max_gap);
+    for (size_t c = 1; c < containers.size(); ++c)
+    {
+        std::vector<Range<double>> next;
+        for (const auto& r1 : result)
+            for (const auto& r2 : get_sections(containers[c], max_gap))
+                if (r1.overlaps(r2))
+                    next.push_back(r1.intersection(r2));
+        result = next;
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("container_intersection: fragmented containers match brute force reference", TESTTAG)
+{
+    std::mt19937 gen(42);
+
+    for (size_t n_containers : { 2, 3, 7 })
+    {
+        std::vector<std::vector<double>> containers;
+        for (size_t c = 0; c < n_containers; ++c)
+            containers.push_back(make_fragmented_container(gen));
+
+        const double max_gap = 2.0;
+
+        auto reference = reference_shared_sections(containers, max_gap);
+        auto shared    = get_shared_sections(containers, max_gap);
+        REQUIRE(reference.size() > 10);
+        REQUIRE(shared.size() == reference.size());
+        for (size_t i = 0; i < shared.size(); ++i)
+        {
+            REQUIRE(shared[i].min == reference[i].min);
+            REQUIRE(shared[i].max == reference[i].max);
+        }
+
+        auto in_reference = [&](double v) {
+            for (const auto& r : reference)
+                if (r.contains(v))
+                    return true;
+            return false;
+        };
+
+        auto indices = get_shared_section_indices(containers, max_gap);
+        auto cut     = cut_to_shared_sections(containers, max_gap);
+        auto slices  = get_shared_section_slices(containers, max_gap);
+        auto mask    = get_shared_section_mask(containers, max_gap);
+        REQUIRE(indices.size() == n_containers);
+        REQUIRE(cut.size() == n_containers);
+
+        std::set<double> reference_values;
+        for (size_t c = 0; c < n_containers; ++c)
+        {
+            std::vector<size_t> reference_indices;
+            for (size_t i = 0; i < containers[c].size(); ++i)
+                if (in_reference(containers[c][i]))
+                {
+                    reference_indices.push_back(i);
+                    reference_values.insert(containers[c][i]);
+                }
+
+            REQUIRE(indices[c].size() == reference_indices.size());
+            REQUIRE(mask[c].size() == containers[c].size());
+            for (size_t i = 0; i < containers[c].size(); ++i)
+                REQUIRE(mask[c](i) == in_reference(containers[c][i]));
+
+            std::vector<size_t> slice_indices;
+            for (const auto& slice : slices[c])
+                for (size_t i = slice.start; i < slice.stop; ++i)
+                    slice_indices.push_back(i);
+            REQUIRE(slices[c].size() == reference.size());
+            REQUIRE(slice_indices == reference_indices);
+
+            REQUIRE(cut[c].size() == reference_indices.size());
+            for (size_t i = 0; i < reference_indices.size(); ++i)
+            {
+                REQUIRE(indices[c](i) == reference_indices[i]);
+                REQUIRE(cut[c](i) == containers[c][reference_indices[i]]);
+            }
+        }
+
+        auto values = get_shared_section_values(containers, max_gap);
+        REQUIRE(values.size() == reference_values.size());
+        REQUIRE(std::equal(values.begin(), values.end(), reference_values.begin()));
+    }
+}
+
+TEST_CASE("get_shared_section_values: duplicates within and across containers", TESTTAG)
+{
+    std::vector<std::vector<double>> containers = {
+        { 0.0, 1.0, 1.0, 1.0, 2.0, 3.0 },
+        { 0.5, 1.0, 2.0, 2.0, 3.0 },
+        { 1.0, 1.0, 2.0, 2.5, 3.0, 3.0 },
+        { 0.0, 1.0, 2.0, 3.0 },
+        { 1.0, 3.0 },
+    };
+
+    for (int mp_cores : { 1, 2, 4 })
+    {
+        auto values = get_shared_section_values(containers, 5.0, mp_cores);
+        REQUIRE(values.size() == 4);
+        REQUIRE(values(0) == 1.0);
+        REQUIRE(values(1) == 2.0);
+        REQUIRE(values(2) == 2.5);
+        REQUIRE(values(3) == 3.0);
+    }
+}
+
+TEST_CASE("get_shared_section_values: parallel tree merge matches k-way merge", TESTTAG)
+{
+    std::mt19937 gen(7);
+
+    for (size_t n_containers : { 1, 2, 3, 5, 8, 13 })
+    {
+        std::vector<std::vector<double>>   containers;
+        std::vector<xt::xtensor<float, 1>> containers_float;
+        for (size_t c = 0; c < n_containers; ++c)
+        {
+            containers.push_back(make_fragmented_container(gen));
+            // quantize to produce duplicates across containers
+            for (auto& v : containers.back())
+                v = std::round(v * 4) / 4;
+            containers_float.push_back(
+                xt::xtensor<float, 1>::from_shape({ containers.back().size() }));
+            std::copy(
+                containers.back().begin(), containers.back().end(), containers_float.back().begin());
+        }
+
+        auto serial = get_shared_section_values(containers, 2.0);
+        REQUIRE(std::is_sorted(serial.begin(), serial.end()));
+        REQUIRE(std::adjacent_find(serial.begin(), serial.end()) == serial.end());
+
+        auto serial_float = get_shared_section_values(containers_float, 2.0);
+
+        for (int mp_cores : { 2, 3, 8 })
+        {
+            auto parallel = get_shared_section_values(containers, 2.0, mp_cores);
+            REQUIRE(parallel.size() == serial.size());
+            REQUIRE(std::equal(parallel.begin(), parallel.end(), serial.begin()));
+
+            auto parallel_float = get_shared_section_values(containers_float, 2.0, mp_cores);
+            REQUIRE(parallel_float.size() == serial_float.size());
+            REQUIRE(std::equal(
+                parallel_float.begin(), parallel_float.end(), serial_float.begin()));
+        }
+    }
+}
+
+TEST_CASE("container_intersection: mp_cores results match sequential results", TESTTAG)
+{
+    std::mt19937 gen(1234);
+
+    for (size_t n_containers : { 1, 2, 5, 20 })
+    {
+        std::vector<std::vector<double>> containers;
+        for (size_t c = 0; c < n_containers; ++c)
+            containers.push_back(make_fragmented_container(gen));
+
+        const double max_gap = 2.5;
+
+        auto shared  = get_shared_sections(containers, max_gap);
+        auto cut     = cut_to_shared_sections(containers, max_gap);
+        auto indices = get_shared_section_indices(containers, max_gap);
+
+        for (int mp_cores : { 2, 4, 16 })
+        {
+            auto shared_mp = get_shared_sections(containers, max_gap, mp_cores);
+            REQUIRE(shared_mp.size() == shared.size());
+            for (size_t i = 0; i < shared.size(); ++i)
+            {
+                REQUIRE(shared_mp[i].min == shared[i].min);
+                REQUIRE(shared_mp[i].max == shared[i].max);
+            }
+
+            auto cut_mp     = cut_to_shared_sections(containers, max_gap, mp_cores);
+            auto indices_mp = get_shared_section_indices(containers, max_gap, mp_cores);
+            REQUIRE(cut_mp.size() == n_containers);
+            REQUIRE(indices_mp.size() == n_containers);
+            for (size_t c = 0; c < n_containers; ++c)
+            {
+                REQUIRE(cut_mp[c].size() == cut[c].size());
+                REQUIRE(std::equal(cut_mp[c].begin(), cut_mp[c].end(), cut[c].begin()));
+                REQUIRE(indices_mp[c].size() == indices[c].size());
+                REQUIRE(
+                    std::equal(indices_mp[c].begin(), indices_mp[c].end(), indices[c].begin()));
+            }
+        }
+    }
+}
@@ -5,6 +5,7 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <type_traits>
@@ -140,6 +141,19 @@ TEST_CASE("get_index_downsampling: gap exactly at boundary", TESTTAG)
     REQUIRE(result.size() == 4);
 }
 
+TEST_CASE("get_index_downsampling: float gap is compared in double", TESTTAG)
+{
+    // 1.0f - (-1e-8f) rounds to 1.0f in float, but the difference in double is > max_gap
+    std::vector<float> data = { -1e-8f, 1.0f, 1.5f };
+
+    auto result = get_index_downsampling(data, 10.0, 1.0);
+    REQUIRE(result.size() == 2);
+    REQUIRE(result[1] == 1);
+
+    auto result_parallel = get_index_downsampling(data, 10.0, 1.0, 4);
+    REQUIRE(result_parallel.size() == 2);
+}
+
 TEST_CASE("get_index_downsampling: with std::vector<float>", TESTTAG)
 {
     std::vector<float> data = { 0.0f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f };
@@ -223,6 +237,82 @@ TEST_CASE("get_index_downsampling: large dataset", TESTTAG)
     }
 }
 
+TEST_CASE("get_index_downsampling: matches element wise reference", TESTTAG)
+{
+    // element by element reference (the gap criterion uses the difference in double)
+    auto reference = [](const auto& data, double interval, double max_gap) {
+        std::vector<size_t> indices = { 0 };
+        double              last    = data[0];
+        for (size_t i = 1; i < data.size(); ++i)
+        {
+            if (double(data[i]) - double(data[i - 1]) > max_gap || data[i] - last >= interval)
+            {
+                indices.push_back(i);
+                last = data[i];
+            }
+        }
+        return indices;
+    };
+
+    std::vector<double> data_double;
+    std::vector<float>  data_float;
+    for (double t = 0; data_double.size() < 20000;)
+    {
+        data_double.push_back(t);
+        data_float.push_back(float(t));
+        // a gap of 3 every 1000 values, otherwise steps of 0.1 to 0.3
+        t += data_double.size() % 1000 == 0 ? 3.0 : 0.1 * double(1 + data_double.size() % 3);
+    }
+
+    for (double interval : { 0.25, 1.0, 7.5 })
+    {
+        auto result_double = get_index_downsampling(data_double, interval, 2.0);
+        auto result_float  = get_index_downsampling(data_float, interval, 2.0);
+        auto ref_double    = reference(data_double, interval, 2.0);
+        auto ref_float     = reference(data_float, interval, 2.0);
+
+        REQUIRE(result_double.size() == ref_double.size());
+        REQUIRE(std::equal(ref_double.begin(), ref_double.end(), result_double.begin()));
+        REQUIRE(result_float.size() == ref_float.size());
+        REQUIRE(std::equal(ref_float.begin(), ref_float.end(), result_float.begin()));
+    }
+}
+
+TEST_CASE("get_index_downsampling: mp_cores matches single threaded", TESTTAG)
+{
+    // 100 Hz series with a varying number of gaps (also none and one per few values)
+    for (size_t gap_every : { size_t(0), size_t(3), size_t(17), size_t(5000) })
+    {
+        std::vector<double>   data;
+        xt::xtensor<float, 1> data_float = xt::xtensor<float, 1>::from_shape({ 100000 });
+        for (double t = 0; data.size() < 100000;)
+        {
+            data_float[data.size()] = float(t);
+            data.push_back(t);
+            t += (gap_every > 0 && data.size() % gap_every == 0) ? 5.0 : 0.01;
+        }
+
+        for (double interval : { 0.05, 1.0, std::numeric_limits<double>::quiet_NaN() })
+        {
+            auto single       = get_index_downsampling(data, interval, 1.0);
+            auto single_float = get_index_downsampling(data_float, interval, 1.0);
+
+            for (int mp_cores : { 2, 3, 8 })
+            {
+                auto parallel = get_index_downsampling(data, interval, 1.0, mp_cores);
+                REQUIRE(parallel.size() == single.size());
+                REQUIRE(std::equal(single.begin(), single.end(), parallel.begin()));
+
+                auto parallel_float =
+                    get_index_downsampling(data_float, interval, 1.0, mp_cores);
+                REQUIRE(parallel_float.size() == single_float.size());
+                REQUIRE(std::equal(
+                    single_float.begin(), single_float.end(), parallel_float.begin()));
+            }
+        }
+    }
+}
+
 TEST_CASE("get_value_downsampling: basic functionality", TESTTAG)
 {
     std::vector<double> data = { 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0 };
@@ -287,3 +377,205 @@ TEST_CASE("get_value_downsampling: preserves value type for float", TESTTAG)
     REQUIRE(result.size() >= 2);
     REQUIRE(result(0) == Catch::Approx(0.0f));
 }
+
+namespace {
+/// x = i * 0.25 (exact) with a gap of 10 after every 50th value, y = sine with a few spikes
+void make_xy(std::vector<double>& x, std::vector<float>& y, size_t n)
+{
+    x.clear();
+    y.clear();
+    double t = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        x.push_back(t);
+        y.push_back(float(std::sin(t)) + (i % 37 == 5 ? 100.f : 0.f));
+        t += (i % 50 == 49) ? 10.0 : 0.25;
+    }
+}
+
+/// bucket bounds by brute force: a new bucket starts after a gap or when floor((x - x0) /
+/// interval) changes (x0: first value of the segment)
+std::vector<size_t> reference_bucket_bounds(const std::vector<double>& x,
+                                            double                     interval,
+                                            double                     max_gap)
+{
+    std::vector<size_t> bounds = { 0 };
+    double              x0     = x[0];
+    for (size_t i = 1; i < x.size(); ++i)
+    {
+        if (x[i] - x[i - 1] > max_gap)
+        {
+            x0 = x[i];
+            bounds.push_back(i);
+        }
+        else if (std::floor((x[i] - x0) / interval) != std::floor((x[i - 1] - x0) / interval))
+            bounds.push_back(i);
+    }
+    bounds.push_back(x.size());
+    return bounds;
+}
+} // namespace
+
+TEST_CASE("get_minmax_downsampling: matches brute force envelope", TESTTAG)
+{
+    std::vector<double> x;
+    std::vector<float>  y;
+    make_xy(x, y, 1000);
+
+    const auto bounds = reference_bucket_bounds(x, 2.0, 3.0);
+
+    std::vector<size_t> expected;
+    for (size_t b = 0; b + 1 < bounds.size(); ++b)
+    {
+        auto   first = y.begin() + bounds[b], last = y.begin() + bounds[b + 1];
+        size_t i_min = size_t(std::min_element(first, last) - y.begin());
+        size_t i_max = size_t(std::max_element(first, last) - y.begin());
+        expected.push_back(std::min(i_min, i_max));
+        if (i_min != i_max)
+            expected.push_back(std::max(i_min, i_max));
+    }
+
+    auto result = get_minmax_downsampling(x, y, 2.0, 3.0);
+    REQUIRE(result.size() == expected.size());
+    REQUIRE(std::equal(expected.begin(), expected.end(), result.begin()));
+
+    // all spikes are preserved
+    for (size_t i = 5; i < y.size(); i += 37)
+        REQUIRE(std::find(result.begin(), result.end(), i) != result.end());
+
+    // default max_gap (2x interval) gives the same buckets here
+    auto result_default = get_minmax_downsampling(x, y, 2.0);
+    REQUIRE(std::equal(result.begin(), result.end(), result_default.begin()));
+}
+
+TEST_CASE("get_mean_downsampling: bucket means", TESTTAG)
+{
+    xt::xtensor<double, 1> x = { 0, 1, 2, 3, 4, 5, 20, 21, 22 };
+    xt::xtensor<float, 1>  y = { 1, 3, 5, 7, std::numeric_limits<float>::quiet_NaN(), 0, 2, 4, 6 };
+
+    auto [x_mean, y_mean] = get_mean_downsampling(x, y, 2.0, 5.0);
+    static_assert(std::is_same_v<decltype(y_mean), xt::xtensor<float, 1>>);
+
+    // buckets: [0, 1], [2, 3], [4, 5], gap, [20, 21], [22]
+    REQUIRE(x_mean.size() == 5);
+    REQUIRE(y_mean.size() == 5);
+    std::vector<double> expected_x = { 0.5, 2.5, 4.5, 20.5, 22 };
+    std::vector<float>  expected_y = { 2, 6, 0, 3, 6 };
+    for (size_t i = 0; i < 5; ++i)
+    {
+        REQUIRE(x_mean(i) == Catch::Approx(expected_x[i]));
+        REQUIRE(y_mean(i) == Catch::Approx(expected_y[i]));
+    }
+}
+
+TEST_CASE("get_lttb_downsampling: one value per bucket, segment ends kept", TESTTAG)
+{
+    std::vector<double> x;
+    std::vector<float>  y;
+    make_xy(x, y, 1000);
+
+    const auto bounds = reference_bucket_bounds(x, 2.0, 3.0);
+    auto       result = get_lttb_downsampling(x, y, 2.0, 3.0);
+
+    // first and last value of every segment (50 values each) + one value per inner bucket
+    for (size_t segment_start = 0; segment_start < x.size(); segment_start += 50)
+    {
+        REQUIRE(std::find(result.begin(), result.end(), segment_start) != result.end());
+        REQUIRE(std::find(result.begin(), result.end(), segment_start + 49) != result.end());
+    }
+    REQUIRE(std::is_sorted(result.begin(), result.end()));
+    REQUIRE(std::adjacent_find(result.begin(), result.end()) == result.end());
+
+    // 2 end values per segment + one value per bucket of the values in between
+    size_t expected_size = 0;
+    for (size_t segment_start = 0; segment_start < x.size(); segment_start += 50)
+    {
+        expected_size += 3;
+        for (size_t bound : bounds)
+            if (bound > segment_start + 1 && bound <= segment_start + 48)
+                ++expected_size;
+    }
+    REQUIRE(result.size() == expected_size);
+
+    // spikes in inner buckets span the largest triangles
+    for (size_t i = 5; i < y.size(); i += 37)
+    {
+        const size_t segment_start = i - i % 50;
+        if (x[i] - x[segment_start] >= 2.0 && x[segment_start + 49] - x[i] >= 2.0)
+            REQUIRE(std::find(result.begin(), result.end(), i) != result.end());
+    }
+}
+
+TEST_CASE("get_lttb_downsampling: spikes in the first and the last interval", TESTTAG)
+{
+    // one segment of 100 values (x = i * 0.25), 13 buckets of 2.0
+    std::vector<double> x, y(100, 0.0);
+    for (size_t i = 0; i < 100; ++i)
+        x.push_back(0.25 * double(i));
+    y[3]  = 10;
+    y[97] = -10;
+
+    auto result = get_lttb_downsampling(x, y, 2.0, 3.0);
+
+    // first value + 13 buckets between the ends + last value
+    REQUIRE(result.size() == 15);
+    REQUIRE(result[0] == 0);
+    REQUIRE(result[1] == 3);
+    REQUIRE(result[13] == 97);
+    REQUIRE(result[14] == 99);
+
+    // segments with one or two values
+    std::vector<double> x_short = { 0, 10, 10.5 }, y_short = { 1, 2, 3 };
+    auto                result_short = get_lttb_downsampling(x_short, y_short, 2.0, 3.0);
+    REQUIRE(std::vector<size_t>(result_short.begin(), result_short.end()) ==
+            std::vector<size_t>{ 0, 1, 2 });
+}
+
+TEST_CASE("xy downsampling: disabled downsampling and input validation", TESTTAG)
+{
+    std::vector<double> x = { 0, 1, 2, 3 };
+    std::vector<double> y = { 0, 1, 0, 1 };
+
+    REQUIRE(get_minmax_downsampling(x, y, 0.0).size() == 4);
+    REQUIRE(get_lttb_downsampling(x, y, std::numeric_limits<double>::quiet_NaN()).size() == 4);
+    REQUIRE(std::get<1>(get_mean_downsampling(x, y, -1.0)).size() == 4);
+    REQUIRE(get_minmax_downsampling(std::vector<double>{}, std::vector<double>{}, 1.0).size() ==
+            0);
+
+    std::vector<double> y_short = { 0, 1 };
+    REQUIRE_THROWS_AS(get_minmax_downsampling(x, y_short, 1.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(get_mean_downsampling(x, y_short, 1.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(get_lttb_downsampling(x, y_short, 1.0), std::invalid_argument);
+}
+
+TEST_CASE("gather: values and rows at downsampled indices", TESTTAG)
+{
+    std::vector<double> x = { 0, 1, 2, 3, 10, 11, 12 };
+    auto indices = get_index_downsampling(x, 2.0, 5.0);
+
+    // 1D
+    auto gathered = gather(x, indices);
+    static_assert(std::is_same_v<decltype(gathered), xt::xtensor<double, 1>>);
+    REQUIRE(gathered.size() == indices.size());
+    for (size_t i = 0; i < indices.size(); ++i)
+        REQUIRE(gathered[i] == x[indices[i]]);
+
+    // 2D: rows along the first axis
+    auto channels = xt::xtensor<float, 2>::from_shape({ x.size(), 3 });
+    for (size_t i = 0; i < x.size(); ++i)
+        for (size_t j = 0; j < 3; ++j)
+            channels.data()[i * 3 + j] = float(i * 10 + j);
+
+    auto rows = gather(channels, indices);
+    static_assert(std::is_same_v<decltype(rows), xt::xtensor<float, 2>>);
+    REQUIRE(rows.shape()[0] == indices.size());
+    REQUIRE(rows.shape()[1] == 3);
+    for (size_t i = 0; i < indices.size(); ++i)
+        for (size_t j = 0; j < 3; ++j)
+            REQUIRE(rows.data()[i * 3 + j] == float(indices[i] * 10 + j));
+
+    // out of range
+    xt::xtensor<size_t, 1> bad_indices = { 0, 7 };
+    REQUIRE_THROWS_AS(gather(x, bad_indices), std::out_of_range);
+    REQUIRE(gather(x, xt::xtensor<size_t, 1>::from_shape({ 0 })).size() == 0);
+}
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include "../themachinethatgoesping/tools/helper/downsampling.hpp"
+#include "../themachinethatgoesping/tools/helper/downsampling_pyramid.hpp"
+
+using namespace std;
+using namespace themachinethatgoesping::tools::helper;
+
+#define TESTTAG "[downsampling_pyramid]"
+
+namespace {
+/// random sorted series with gaps of different sizes (steps in [0.01, 0.1], gaps of 1 to 100)
+template<typename T>
+std::vector<T> make_series(std::mt19937& gen, size_t n)
+{
+    std::uniform_real_distribution<double> step(0.01, 0.1);
+    std::uniform_real_distribution<double> gap(1.0, 100.0);
+    std::uniform_int_distribution<int>     is_gap(0, 199);
+
+    std::vector<T> data;
+    data.reserve(n);
+    for (double t = 1000; data.size() < n;)
+    {
+        data.push_back(static_cast<T>(t));
+        t += is_gap(gen) == 0 ? gap(gen) : step(gen);
+    }
+    return data;
+}
+
+template<typename T>
+void require_same(const xt::xtensor<T, 1>& a, const xt::xtensor<T, 1>& b)
+{
+    REQUIRE(a.size() == b.size());
+    REQUIRE(std::equal(a.begin(), a.end(), b.begin()));
+}
+} // namespace
+
+TEST_CASE("DownsamplingPyramid: matches get_value_downsampling", TESTTAG)
+{
+    std::mt19937 gen(7);
+    const auto   data = make_series<double>(gen, 20000);
+
+    DownsamplingPyramid<double> pyramid(data, 0.05, 12);
+    REQUIRE(pyramid.size() == data.size());
+    REQUIRE(pyramid.get_number_of_levels() == 12);
+    REQUIRE(pyramid.get_level_max_gap(3) == 0.8);
+
+    // levels are nested and contain exactly the gaps > level max_gap
+    for (size_t level = 0; level < pyramid.get_number_of_levels(); ++level)
+    {
+        const auto& gaps = pyramid.get_level_gaps(level);
+        size_t      n    = 0;
+        for (size_t i = 1; i < data.size(); ++i)
+            if (data[i] - data[i - 1] > pyramid.get_level_max_gap(level))
+                REQUIRE(gaps.at(n++) == i);
+        REQUIRE(gaps.size() == n);
+    }
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (double interval : { 0.01, 0.05, 0.07, 0.1, 0.3, 1.0, 2.5, 10.0, 77.0, 500.0 })
+        for (double max_gap : { nan, 0.05, 0.2, 1.5, 3.0, 50.0, 1e6 })
+        {
+            INFO("interval: " << interval << " max_gap: " << max_gap);
+            require_same(pyramid.get_value_downsampling(data, interval, max_gap),
+                         get_value_downsampling(data, interval, max_gap));
+        }
+
+    // disabled downsampling returns all values
+    require_same(pyramid.get_value_downsampling(data, nan), get_value_downsampling(data, nan));
+    REQUIRE(pyramid.get_value_downsampling(data, 0).size() == data.size());
+}
+
+TEST_CASE("DownsamplingPyramid: float data and edge cases", TESTTAG)
+{
+    std::mt19937 gen(3);
+    const auto   data = make_series<float>(gen, 5000);
+
+    DownsamplingPyramid<float> pyramid(data, 0.02);
+    for (double interval : { 0.02, 0.033, 0.5, 4.0, 60.0 })
+        for (double max_gap : { std::numeric_limits<double>::quiet_NaN(), 1.0, 25.0 })
+            require_same(pyramid.get_value_downsampling(data, interval, max_gap),
+                         get_value_downsampling(data, interval, max_gap));
+
+    // a gap right before the last value
+    std::vector<double> last_gap = { 0, 1, 2, 3, 100 };
+    DownsamplingPyramid<double> last_gap_pyramid(last_gap, 1);
+    require_same(last_gap_pyramid.get_value_downsampling(last_gap, 1),
+                 get_value_downsampling(last_gap, 1));
+    REQUIRE(last_gap_pyramid.get_value_downsampling(last_gap, 1).size() == 5);
+
+    // empty and single value data
+    std::vector<double> empty, single = { 5.0 };
+    REQUIRE(DownsamplingPyramid<double>(empty, 1).get_value_downsampling(empty, 1).size() == 0);
+    REQUIRE(DownsamplingPyramid<double>(single, 1).get_value_downsampling(single, 1).size() == 1);
+
+    // invalid parameters
+    REQUIRE_THROWS_AS(DownsamplingPyramid<double>(last_gap, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(DownsamplingPyramid<double>(last_gap, std::nan("")), std::invalid_argument);
+    REQUIRE_THROWS_AS(DownsamplingPyramid<double>(last_gap, 1, 0), std::invalid_argument);
+}
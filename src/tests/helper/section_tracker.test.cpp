@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include "../themachinethatgoesping/tools/helper/section_tracker.hpp"
+
+using namespace std;
+using namespace themachinethatgoesping::tools::helper;
+namespace classhelper = themachinethatgoesping::tools::classhelper;
+
+#define TESTTAG "[section_tracker]"
+
+namespace {
+/// random sorted series with gaps (steps in [0.1, 1.0], every ~20th step is a gap of 2 to 7)
+std::vector<double> make_series(std::mt19937& gen, size_t n, double start = 0)
+{
+    std::uniform_real_distribution<double> step(0.1, 1.0);
+    std::uniform_int_distribution<int>     gap(0, 19);
+
+    std::vector<double> data;
+    data.reserve(n);
+    for (double t = start; data.size() < n;)
+    {
+        data.push_back(t);
+        t += gap(gen) == 0 ? 2.0 + step(gen) * 5 : step(gen);
+    }
+    return data;
+}
+
+template<typename T>
+void require_equal(const std::vector<Range<T>>& a, const std::vector<Range<T>>& b)
+{
+    REQUIRE(a.size() == b.size());
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        REQUIRE(a[i].min == b[i].min);
+        REQUIRE(a[i].max == b[i].max);
+    }
+}
+} // namespace
+
+TEST_CASE("SectionTracker: chunked appends match get_sections", TESTTAG)
+{
+    std::mt19937 gen(11);
+    const auto   data = make_series(gen, 2000);
+
+    for (double max_gap : { 1.5, 0.0, -1.0, std::numeric_limits<double>::quiet_NaN() })
+    {
+        SectionTracker<double> tracker(max_gap);
+        REQUIRE(tracker.empty());
+        REQUIRE(tracker.get_sections().empty());
+        REQUIRE_THROWS_AS(tracker.get_open_section(), std::runtime_error);
+
+        std::uniform_int_distribution<size_t> chunk_size(0, 97);
+        for (size_t i = 0; i < data.size();)
+        {
+            size_t n = std::min(chunk_size(gen), data.size() - i);
+            tracker.extend(std::vector<double>(data.begin() + i, data.begin() + i + n));
+            i += n;
+
+            std::vector<double> so_far(data.begin(), data.begin() + i);
+            require_equal(tracker.get_sections(), get_sections(so_far, max_gap));
+            REQUIRE(tracker.size() == i);
+        }
+
+        REQUIRE(tracker.get_open_section().max == data.back());
+    }
+}
+
+TEST_CASE("SectionTracker: float values and xtensor chunks", TESTTAG)
+{
+    xt::xtensor<float, 1> chunk1 = { 0.f, 1.f, 2.f, 10.f };
+    xt::xtensor<float, 1> chunk2 = { 10.5f, 11.f, 20.f };
+
+    SectionTracker<float> tracker(2.0);
+    tracker.extend(chunk1);
+    tracker.extend(chunk2);
+    tracker.append(20.f); // equal values are allowed
+
+    REQUIRE(tracker.size() == 8);
+    REQUIRE(tracker.get_sections().size() == 3);
+    REQUIRE(tracker.get_sections()[1].min == 10.f);
+    REQUIRE(tracker.get_sections()[1].max == 11.f);
+    REQUIRE(tracker.get_open_section().min == 20.f);
+
+    // values must be appended in ascending order
+    REQUIRE_THROWS_AS(tracker.append(19.f), std::invalid_argument);
+    REQUIRE_THROWS_AS(tracker.append(std::numeric_limits<float>::quiet_NaN()),
+                      std::invalid_argument);
+    REQUIRE(tracker.size() == 8);
+
+    // invalid chunks are rejected as a whole (no partially appended chunk)
+    const auto sections = tracker.get_sections();
+    for (const auto& chunk : { std::vector<float>{ 21.f, 30.f, 25.f, 40.f },
+                               std::vector<float>{ 21.f, std::numeric_limits<float>::quiet_NaN() },
+                               std::vector<float>{ 19.f, 21.f } })
+    {
+        REQUIRE_THROWS_AS(tracker.extend(chunk), std::invalid_argument);
+        REQUIRE(tracker.size() == 8);
+        REQUIRE(tracker.get_sections() == sections);
+    }
+
+    tracker.clear();
+    REQUIRE_THROWS_AS(tracker.extend(std::vector<float>{ std::numeric_limits<float>::quiet_NaN() }),
+                      std::invalid_argument);
+    REQUIRE(tracker.empty());
+    REQUIRE(tracker.empty());
+    REQUIRE(tracker.get_max_gap() == 2.0);
+    tracker.append(-5.f);
+    REQUIRE(tracker.get_sections().size() == 1);
+}
+
+TEST_CASE("SectionTracker: shared sections match get_shared_sections", TESTTAG)
+{
+    std::mt19937 gen(5);
+
+    std::vector<std::vector<double>>    series;
+    std::vector<SectionTracker<double>> trackers;
+    for (size_t c = 0; c < 4; ++c)
+    {
+        series.push_back(make_series(gen, 1000, double(c) * 3));
+        trackers.emplace_back(1.5);
+        trackers.back().extend(series.back());
+    }
+
+    require_equal(trackers[0].get_shared_sections(trackers[1]),
+                  get_shared_sections(std::vector{ series[0], series[1] }, 1.5));
+    require_equal(SectionTracker<double>::get_shared_sections(trackers),
+                  get_shared_sections(series, 1.5));
+    REQUIRE(
+        SectionTracker<double>::get_shared_sections(std::vector<SectionTracker<double>>{}).empty());
+}
+
+TEST_CASE("SectionTracker: support common functions", TESTTAG)
+{
+    std::mt19937 gen(3);
+    const auto   data = make_series(gen, 500);
+
+    SectionTracker<double> tracker(1.5);
+    tracker.extend(std::vector<double>(data.begin(), data.begin() + 300));
+
+    // copy
+    auto tracker2 = tracker;
+    REQUIRE(tracker == tracker2);
+    REQUIRE(SectionTracker<double>() == SectionTracker<double>());
+
+    // binary round trip, then resume appending
+    auto tracker3 = SectionTracker<double>::from_binary(tracker.to_binary());
+    REQUIRE(tracker == tracker3);
+    REQUIRE(tracker.binary_hash() == tracker3.binary_hash());
+    const auto buffer3 = tracker3.to_binary();
+    REQUIRE(tracker3.binary_hash() == xxh::xxhash3<64>(buffer3.data(), buffer3.size()));
+    REQUIRE(tracker3.binary_size() == buffer3.size());
+    std::vector<char> buffer_into(buffer3.size());
+    REQUIRE(tracker3.to_binary_into(buffer_into) == buffer3.size());
+    REQUIRE(std::string(buffer_into.begin(), buffer_into.end()) == buffer3);
+
+    tracker.extend(std::vector<double>(data.begin() + 300, data.end()));
+    tracker3.extend(std::vector<double>(data.begin() + 300, data.end()));
+    REQUIRE(tracker == tracker3);
+    REQUIRE(tracker != tracker2);
+    require_equal(tracker3.get_sections(), get_sections(data, 1.5));
+
+    std::stringstream ss(tracker.to_binary());
+    REQUIRE(SectionTracker<double>::from_stream(ss) == tracker);
+
+    // wrong class name/version
+    std::string buffer = tracker.to_binary();
+    buffer[0]          = 'X';
+    REQUIRE_THROWS_AS(SectionTracker<double>::from_binary(buffer), std::runtime_error);
+
+    // printing
+    REQUIRE(tracker.info_string().size() != 0);
+}
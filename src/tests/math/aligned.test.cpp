@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+
+#include "../themachinethatgoesping/tools/math/aligned.hpp"
+
+using namespace themachinethatgoesping::tools::math;
+
+#define TESTTAG "[math][aligned]"
+
+TEMPLATE_TEST_CASE("aligned containers start on a simd_alignment boundary",
+                   TESTTAG,
+                   float,
+                   double,
+                   int16_t,
+                   uint8_t)
+{
+    for (size_t n : { 1, 3, 17, 1000, 4099 })
+    {
+        aligned_vector<TestType> v(n);
+        REQUIRE(is_aligned(v.data()));
+
+        auto t = make_aligned_xtensor<TestType>(n);
+        REQUIRE(t.size() == n);
+        REQUIRE(is_aligned(t.data()));
+
+        aligned_xtensor<TestType, 2> t2 = aligned_xtensor<TestType, 2>::from_shape({ n, 3 });
+        REQUIRE(is_aligned(t2.data()));
+    }
+}
+
+TEST_CASE("is_aligned", TESTTAG)
+{
+    aligned_vector<float> v(64);
+
+    REQUIRE(is_aligned(v.data()));
+    REQUIRE(is_aligned(v.data() + 16));
+    REQUIRE(!is_aligned(v.data() + 1));
+    REQUIRE(!is_aligned(v.data() + 4));
+    REQUIRE(is_aligned(v.data() + 4, 16));
+    REQUIRE(!is_aligned(v.data() + 2, 16));
+}
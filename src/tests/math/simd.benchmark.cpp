@@ -0,0 +1,325 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+// Benchmarks for math/simd.
+//
+// Every kernel is run once per architecture of dispatch_arch_list that is
+// available on the host (forced, bypassing the runtime dispatcher) and
+// compared against the dispatched call and the xt::fma reference.
+// A throughput table (GB/s, elements/ns) is printed for each array size.
+//
+// Regular and streaming (non-temporal) stores are compared per arch; the
+// streaming gain shows for outputs larger than the last level cache.
+//
+// Default sizes stay below ~64 MB per array. The sizes that exceed the last
+// level cache by far (10^7, 10^8) are hidden behind the [large] tag:
+//   ./<benchmark executable> "[large]"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "../benchmark_helper.hpp"
+#include "../themachinethatgoesping/tools/helper/omp_helper.hpp"
+#include "../themachinethatgoesping/tools/math/simd.hpp"
+
+using namespace themachinethatgoesping::tools::math;
+using benchmark_helper::measure_ns_per_call;
+
+#define TESTTAG "[math][simd][benchmark]"
+
+namespace {
+
+const std::vector<size_t> default_sizes = { 16,      64,      256,       1024,      4096,
+                                            16384,   65536,   262144,    1u << 20,  1u << 22,
+                                            1u << 23 };
+const std::vector<size_t> large_sizes   = { 10'000'000, 100'000'000 };
+
+/// Call f(Arch{}) for every architecture of dispatch_arch_list the host cpu supports
+template<typename t_function>
+void for_each_available_arch(t_function&& f)
+{
+    dispatch_arch_list::for_each([&](auto arch) {
+        if (xsimd::available_architectures().best >= decltype(arch)::version())
+            f(arch);
+    });
+}
+
+void print_header(const std::string& title)
+{
+    fmt::print("\n{}\n", title);
+    fmt::print("{:<22} {:<12} {:>12} {:>12} {:>10} {:>10}\n",
+               "variant",
+               "arch",
+               "n",
+               "ns/call",
+               "GB/s",
+               "elem/ns");
+}
+
+/// bytes_per_element: all bytes read + written per element (e.g. 2*sizeof(T) for fma)
+void print_row(const std::string& variant,
+               const std::string& arch,
+               size_t             n,
+               size_t             bytes_per_element,
+               double             ns_per_call)
+{
+    const double gb_per_s    = double(n * bytes_per_element) / ns_per_call; // bytes/ns == GB/s
+    const double elem_per_ns = double(n) / ns_per_call;
+
+    fmt::print("{:<22} {:<12} {:>12} {:>12.1f} {:>10.2f} {:>10.3f}\n",
+               variant,
+               arch,
+               n,
+               ns_per_call,
+               gb_per_s,
+               elem_per_ns);
+}
+
+template<typename T>
+std::vector<T> make_input(size_t n)
+{
+    std::vector<T> x(n);
+    for (size_t i = 0; i < n; ++i)
+        x[i] = T(i % 1000) * T(0.001);
+    return x;
+}
+
+template<typename T>
+void sweep_fma(const std::vector<size_t>& sizes)
+{
+    const T slope = T(1.5);
+    const T base  = T(-3);
+
+    for (size_t n : sizes)
+    {
+        const auto     x    = make_input<T>(n);
+        const auto     barr = make_input<T>(n);
+        std::vector<T> out(n);
+        std::vector<T> reference(n);
+
+        fma_xtensor(reference.data(), x.data(), slope, base, n);
+
+        print_header(
+            fmt::format("fma / fmab <{}>  n = {}", sizeof(T) == 4 ? "float" : "double", n));
+
+        print_row("fma_xtensor",
+                  "xt::fma",
+                  n,
+                  2 * sizeof(T),
+                  measure_ns_per_call([&] { fma_xtensor(out.data(), x.data(), slope, base, n); }));
+
+        print_row("fma_dispatch",
+                  fma_dispatch_arch(),
+                  n,
+                  2 * sizeof(T),
+                  measure_ns_per_call([&] { fma_dispatch(out.data(), x.data(), slope, base, n); }));
+
+        for_each_available_arch([&](auto arch) {
+            print_row("fma_dispatch (forced)",
+                      arch.name(),
+                      n,
+                      2 * sizeof(T),
+                      measure_ns_per_call([&] {
+                          fma_dispatch_kernel{}(arch, out.data(), x.data(), slope, base, n);
+                      }));
+
+            // make sure we did not benchmark a broken code path
+            // (not bit-exact: without fma3 the kernel falls back to mul + add)
+            for (size_t i = 0; i < n; i += std::max<size_t>(1, n / 101))
+                REQUIRE(out[i] == Catch::Approx(reference[i]));
+        });
+
+        for_each_available_arch([&](auto arch) {
+            print_row("fmab_dispatch (forced)",
+                      arch.name(),
+                      n,
+                      3 * sizeof(T),
+                      measure_ns_per_call([&] {
+                          fmab_dispatch_kernel{}(arch, out.data(), x.data(), slope, barr.data(), n);
+                      }));
+        });
+    }
+}
+
+void sweep_fma_convert(const std::vector<size_t>& sizes)
+{
+    for (size_t n : sizes)
+    {
+        std::vector<int16_t> x(n);
+        for (size_t i = 0; i < n; ++i)
+            x[i] = int16_t(i % 4096);
+        std::vector<float> out(n);
+
+        print_header(fmt::format("fma_convert <float, int16_t>  n = {}", n));
+
+        for_each_available_arch([&](auto arch) {
+            print_row("fma_convert (forced)",
+                      arch.name(),
+                      n,
+                      sizeof(int16_t) + sizeof(float),
+                      measure_ns_per_call([&] {
+                          fma_convert_dispatch_kernel{}(
+                              arch, out.data(), x.data(), 0.5f, -100.f, n);
+                      }));
+        });
+    }
+}
+
+/// regular vs. streaming (non-temporal) stores; the gain is expected above the last level cache
+template<typename T>
+void sweep_store_modes(const std::vector<size_t>& sizes)
+{
+    for (size_t n : sizes)
+    {
+        const auto        x    = make_input<T>(n);
+        const auto        barr = make_input<T>(n);
+        aligned_vector<T> out(n);
+
+        print_header(fmt::format("store modes <{}>  n = {} ({} MiB output)",
+                                 sizeof(T) == 4 ? "float" : "double",
+                                 n,
+                                 n * sizeof(T) / (1024 * 1024)));
+
+        for_each_available_arch([&](auto arch) {
+            for (bool streaming : { false, true })
+            {
+                print_row(streaming ? "fma streaming" : "fma regular",
+                          arch.name(),
+                          n,
+                          2 * sizeof(T),
+                          measure_ns_per_call([&] {
+                              fma_dispatch_kernel{}(
+                                  arch, out.data(), x.data(), T(1.5), T(-3), n, streaming);
+                          }));
+            }
+            for (bool streaming : { false, true })
+            {
+                print_row(streaming ? "fmab streaming" : "fmab regular",
+                          arch.name(),
+                          n,
+                          3 * sizeof(T),
+                          measure_ns_per_call([&] {
+                              fmab_dispatch_kernel{}(
+                                  arch, out.data(), x.data(), T(1.5), barr.data(), n, streaming);
+                          }));
+            }
+        });
+    }
+}
+
+/// thread scaling of the mp_cores variants (memory bandwidth bound for large n)
+template<typename T>
+void sweep_mp_cores(const std::vector<size_t>& sizes)
+{
+    std::vector<int> thread_counts = { 1, 2, 4, 8 };
+    if (omp_get_max_threads() > 8)
+        thread_counts.push_back(omp_get_max_threads());
+
+    for (size_t n : sizes)
+    {
+        const auto        x = make_input<T>(n);
+        aligned_vector<T> out(n);
+
+        print_header(
+            fmt::format("mp_cores <{}>  n = {}", sizeof(T) == 4 ? "float" : "double", n));
+
+        for (int mp_cores : thread_counts)
+            for (auto store_mode : { t_store_mode::regular, t_store_mode::streaming })
+            {
+                print_row(fmt::format("fma {} mp={}",
+                                      store_mode == t_store_mode::regular ? "regular" : "streaming",
+                                      mp_cores),
+                          fma_dispatch_arch(),
+                          n,
+                          2 * sizeof(T),
+                          measure_ns_per_call([&] {
+                              fma_dispatch(
+                                  out.data(), x.data(), T(1.5), T(-3), n, store_mode, mp_cores);
+                          }));
+            }
+    }
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("benchmark fma_dispatch vs fma_xtensor: size sweep", TESTTAG, float, double)
+{
+    sweep_fma<TestType>(default_sizes);
+}
+
+TEMPLATE_TEST_CASE("benchmark fma_dispatch vs fma_xtensor: size sweep (large)",
+                   TESTTAG "[.][large]",
+                   float,
+                   double)
+{
+    sweep_fma<TestType>(large_sizes);
+}
+
+TEST_CASE("benchmark fma_convert_dispatch: size sweep", TESTTAG)
+{
+    sweep_fma_convert(default_sizes);
+}
+
+TEST_CASE("benchmark fma_convert_dispatch: size sweep (large)", TESTTAG "[.][large]")
+{
+    sweep_fma_convert(large_sizes);
+}
+
+TEMPLATE_TEST_CASE("benchmark streaming vs regular stores", TESTTAG, float, double)
+{
+    sweep_store_modes<TestType>({ 1u << 16, 1u << 20, 1u << 23 });
+}
+
+TEMPLATE_TEST_CASE("benchmark streaming vs regular stores (large)",
+                   TESTTAG "[.][large]",
+                   float,
+                   double)
+{
+    sweep_store_modes<TestType>(large_sizes);
+}
+
+TEMPLATE_TEST_CASE("benchmark fma_dispatch mp_cores scaling", TESTTAG, float, double)
+{
+    sweep_mp_cores<TestType>({ 1u << 16, 1u << 20, 1u << 23 });
+}
+
+TEMPLATE_TEST_CASE("benchmark fma_dispatch mp_cores scaling (large)",
+                   TESTTAG "[.][large]",
+                   float,
+                   double)
+{
+    sweep_mp_cores<TestType>(large_sizes);
+}
+
+TEMPLATE_TEST_CASE("benchmark fma_dispatch per arch (catch2 statistics)", TESTTAG, float, double)
+{
+    for (size_t n : { size_t(1024), size_t(1u << 20) })
+    {
+        const auto            x = make_input<TestType>(n);
+        std::vector<TestType> out(n);
+
+        BENCHMARK("fma_xtensor n=" + std::to_string(n))
+        {
+            fma_xtensor(out.data(), x.data(), TestType(1.5), TestType(-3), n);
+            return out[n - 1];
+        };
+
+        for_each_available_arch([&](auto arch) {
+            BENCHMARK(std::string("fma_dispatch ") + arch.name() + " n=" + std::to_string(n))
+            {
+                fma_dispatch_kernel{}(arch, out.data(), x.data(), TestType(1.5), TestType(-3), n);
+                return out[n - 1];
+            };
+        });
+    }
+}
@@ -6,7 +6,11 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <numeric>
 #include <vector>
 
@@ -149,3 +153,410 @@ TEMPLATE_TEST_CASE("fma_dispatch vs fma_xtensor: results match", TESTTAG, float,
     for (size_t i = 0; i < N; ++i)
         REQUIRE(out_dispatch[i] == Catch::Approx(out_xtensor[i]));
 }
+
+// ---- mixed precision: fma_convert_dispatch ----
+
+TEMPLATE_TEST_CASE("fma_convert_dispatch: int16 raw counts", TESTTAG, float, double)
+{
+    constexpr size_t     N = 1037;
+    std::vector<int16_t> x(N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = static_cast<int16_t>(static_cast<int>(i) * 61 - 32000);
+    std::vector<TestType> out(N);
+
+    fma_convert_dispatch(out.data(), x.data(), TestType(0.5), TestType(-120), N);
+
+    for (size_t i = 0; i < N; ++i)
+        REQUIRE(out[i] == Catch::Approx(std::fma(TestType(x[i]), TestType(0.5), TestType(-120))));
+
+    // returning variant
+    auto out2 = fma_convert_dispatch(x.data(), TestType(0.5), TestType(-120), N);
+    REQUIRE(out2.size() == N);
+    for (size_t i = 0; i < N; ++i)
+        REQUIRE(out2(i) == out[i]);
+}
+
+TEMPLATE_TEST_CASE("fma_convert_dispatch: uint16 raw counts", TESTTAG, float, double)
+{
+    constexpr size_t      N = 517;
+    std::vector<uint16_t> x(N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = static_cast<uint16_t>(i * 127);
+    std::vector<TestType> out(N);
+
+    fma_convert_dispatch(out.data(), x.data(), TestType(0.01), TestType(3), N);
+
+    for (size_t i = 0; i < N; ++i)
+        REQUIRE(out[i] == Catch::Approx(std::fma(TestType(x[i]), TestType(0.01), TestType(3))));
+}
+
+TEST_CASE("fma_convert_dispatch: float -> double", TESTTAG)
+{
+    constexpr size_t   N = 333;
+    std::vector<float> x(N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = static_cast<float>(i) * 0.1f - 7.f;
+    std::vector<double> out(N);
+
+    fma_convert_dispatch(out.data(), x.data(), 1.0 / 3.0, 1e8, N);
+
+    // fused or mul + add (sse2 / sse4_2) differ by one rounding, a float computation would be
+    // off by several units at 1e8
+    for (size_t i = 0; i < N; ++i)
+        REQUIRE(out[i] == Catch::Approx(std::fma(double(x[i]), 1.0 / 3.0, 1e8)).epsilon(1e-14));
+}
+
+TEST_CASE("fmab_convert_dispatch: float storage, double accumulation", TESTTAG)
+{
+    constexpr size_t   N = 1001;
+    std::vector<float> x(N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = 0.1f * static_cast<float>(i % 17);
+
+    // accumulate in-place many times: double accumulation must not lose the small increments
+    std::vector<double> acc(N, 1e9);
+    for (int k = 0; k < 10; ++k)
+        fmab_convert_dispatch(acc.data(), x.data(), 1.0, acc.data(), N);
+
+    for (size_t i = 0; i < N; ++i)
+        REQUIRE(acc[i] == Catch::Approx(1e9 + 10.0 * double(x[i])).epsilon(1e-15));
+}
+
+// ---- float <-> half ----
+
+TEST_CASE("float_to_half / half_to_float: scalar reference values", TESTTAG)
+{
+    REQUIRE(float_to_half(0.f) == 0x0000);
+    REQUIRE(float_to_half(-0.f) == 0x8000);
+    REQUIRE(float_to_half(1.f) == 0x3c00);
+    REQUIRE(float_to_half(-2.f) == 0xc000);
+    REQUIRE(float_to_half(65504.f) == 0x7bff);                    // largest half
+    REQUIRE(float_to_half(65520.f) == 0x7c00);                    // rounds to inf
+    REQUIRE(float_to_half(std::ldexp(1.f, -24)) == 0x0001);       // smallest denormal
+    REQUIRE(float_to_half(1.f + std::ldexp(1.f, -11)) == 0x3c00); // tie -> even
+    REQUIRE(float_to_half(std::numeric_limits<float>::infinity()) == 0x7c00);
+    REQUIRE(float_to_half(std::numeric_limits<float>::quiet_NaN()) == 0x7e00);
+
+    REQUIRE(half_to_float(0x3c00) == 1.f);
+    REQUIRE(half_to_float(0xc000) == -2.f);
+    REQUIRE(half_to_float(0x7bff) == 65504.f);
+    REQUIRE(half_to_float(0x0001) == std::ldexp(1.f, -24));
+    REQUIRE(std::isinf(half_to_float(0x7c00)));
+    REQUIRE(std::isnan(half_to_float(0x7e00)));
+}
+
+TEST_CASE("half_to_float_dispatch: all half values round trip", TESTTAG)
+{
+    std::vector<uint16_t> halfs(65536);
+    for (size_t i = 0; i < halfs.size(); ++i)
+        halfs[i] = static_cast<uint16_t>(i);
+
+    std::vector<float> floats(halfs.size());
+    half_to_float_dispatch(floats.data(), halfs.data(), halfs.size());
+
+    std::vector<uint16_t> back(halfs.size());
+    float_to_half_dispatch(back.data(), floats.data(), floats.size());
+
+    for (size_t i = 0; i < halfs.size(); ++i)
+    {
+        REQUIRE(std::bit_cast<uint32_t>(floats[i]) == std::bit_cast<uint32_t>(half_to_float(halfs[i])));
+
+        if (std::isnan(floats[i]))
+            REQUIRE((back[i] & 0x7fff) == 0x7e00);
+        else
+            REQUIRE(back[i] == halfs[i]);
+    }
+}
+
+TEST_CASE("float_to_half_dispatch: matches scalar conversion", TESTTAG)
+{
+    constexpr size_t   N = 100003;
+    std::vector<float> x(N);
+    // cover denormal, normal, overflow and rounding ranges
+    for (size_t i = 0; i < N; ++i)
+        x[i] = std::ldexp(1.f + static_cast<float>(i % 1000) / 997.f, static_cast<int>(i % 50) - 30) *
+               ((i % 2) ? -1.f : 1.f);
+
+    auto out = float_to_half_dispatch(x.data(), N);
+    REQUIRE(out.size() == N);
+    for (size_t i = 0; i < N; ++i)
+        REQUIRE(out(i) == float_to_half(x[i]));
+}
+
+// ---- alignment handling (peel loop / aligned load+store paths) ----
+
+TEMPLATE_TEST_CASE("fma_dispatch/fmab_dispatch: all alignment offsets", TESTTAG, float, double)
+{
+    constexpr size_t         N = 203;
+    constexpr size_t         P = 16; // max offset (covers 64 byte alignment for float)
+    aligned_vector<TestType> x(N + P), base(N + P), out(N + P);
+    for (size_t i = 0; i < N + P; ++i)
+    {
+        x[i]    = TestType(i) * TestType(0.25);
+        base[i] = TestType(1) - TestType(i);
+    }
+
+    for (size_t offset_out = 0; offset_out < P; ++offset_out)
+        for (size_t offset_in : { size_t(0), size_t(1), offset_out })
+            for (size_t n : { size_t(0), size_t(1), size_t(7), N })
+            {
+                std::fill(out.begin(), out.end(), TestType(-999));
+                fma_dispatch(
+                    out.data() + offset_out, x.data() + offset_in, TestType(3), TestType(2), n);
+                for (size_t i = 0; i < n; ++i)
+                    REQUIRE(out[offset_out + i] ==
+                            Catch::Approx(std::fma(x[offset_in + i], TestType(3), TestType(2))));
+                // nothing written outside of [offset_out, offset_out + n)
+                for (size_t i = 0; i < offset_out; ++i)
+                    REQUIRE(out[i] == TestType(-999));
+                for (size_t i = offset_out + n; i < N + P; ++i)
+                    REQUIRE(out[i] == TestType(-999));
+
+                fmab_dispatch(out.data() + offset_out,
+                              x.data() + offset_in,
+                              TestType(3),
+                              base.data() + offset_in,
+                              n);
+                for (size_t i = 0; i < n; ++i)
+                    REQUIRE(out[offset_out + i] ==
+                            Catch::Approx(std::fma(x[offset_in + i], TestType(3), base[offset_in + i])));
+            }
+}
+
+TEMPLATE_TEST_CASE("fma_dispatch: in-place on unaligned view", TESTTAG, float, double)
+{
+    aligned_vector<TestType> x(100);
+    std::iota(x.begin(), x.end(), TestType(0));
+
+    fma_dispatch(x.data() + 3, x.data() + 3, TestType(2), TestType(1), 90);
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        if (i >= 3 && i < 93)
+            REQUIRE(x[i] == Catch::Approx(TestType(2 * i + 1)));
+        else
+            REQUIRE(x[i] == TestType(i));
+    }
+}
+
+TEMPLATE_TEST_CASE("returning overloads return aligned buffers", TESTTAG, float, double)
+{
+    std::vector<TestType> x(33, TestType(1));
+
+    auto r1 = fma_dispatch(x.data(), TestType(2), TestType(3), x.size());
+    auto r2 = fmab_dispatch(x.data(), TestType(2), x.data(), x.size());
+    auto r3 = fma_xtensor(x.data(), TestType(2), TestType(3), x.size());
+    REQUIRE(is_aligned(r1.data()));
+    REQUIRE(is_aligned(r2.data()));
+    REQUIRE(is_aligned(r3.data()));
+    REQUIRE(r1(32) == Catch::Approx(5));
+    REQUIRE(r2(32) == Catch::Approx(3));
+}
+
+// ---- streaming (non-temporal) store mode ----
+
+TEMPLATE_TEST_CASE("fma_dispatch/fmab_dispatch: streaming stores match regular stores",
+                   TESTTAG,
+                   float,
+                   double)
+{
+    constexpr size_t         N = 4099;
+    aligned_vector<TestType> x(N + 16), base(N + 16), out_regular(N + 16), out_streaming(N + 16);
+    for (size_t i = 0; i < N + 16; ++i)
+    {
+        x[i]    = TestType(i % 113) * TestType(0.5);
+        base[i] = TestType(i % 7);
+    }
+
+    for (size_t offset : { size_t(0), size_t(1), size_t(3), size_t(9) })
+    {
+        fma_dispatch(out_regular.data() + offset,
+                     x.data(),
+                     TestType(2),
+                     TestType(-1),
+                     N,
+                     t_store_mode::regular);
+        fma_dispatch(out_streaming.data() + offset,
+                     x.data(),
+                     TestType(2),
+                     TestType(-1),
+                     N,
+                     t_store_mode::streaming);
+        REQUIRE(out_regular == out_streaming);
+
+        fmab_dispatch(out_regular.data() + offset,
+                      x.data() + offset,
+                      TestType(2),
+                      base.data(),
+                      N,
+                      t_store_mode::regular);
+        fmab_dispatch(out_streaming.data() + offset,
+                      x.data() + offset,
+                      TestType(2),
+                      base.data(),
+                      N,
+                      t_store_mode::streaming);
+        REQUIRE(out_regular == out_streaming);
+    }
+
+    // every arch of the dispatch list (non-temporal store intrinsics differ per arch)
+    dispatch_arch_list::for_each([&](auto arch) {
+        if (xsimd::available_architectures().best < decltype(arch)::version())
+            return;
+
+        fma_dispatch_kernel{}(
+            arch, out_streaming.data() + 1, x.data(), TestType(2), TestType(-1), N, true);
+        fma_dispatch_kernel{}(
+            arch, out_regular.data() + 1, x.data(), TestType(2), TestType(-1), N, false);
+        for (size_t i = 0; i < N; ++i)
+            REQUIRE(out_streaming[i + 1] == Catch::Approx(out_regular[i + 1]));
+    });
+}
+
+TEST_CASE("streaming store threshold", TESTTAG)
+{
+    const size_t default_threshold = get_streaming_store_threshold();
+    REQUIRE(default_threshold == default_streaming_store_threshold);
+
+    REQUIRE(!use_streaming_stores(t_store_mode::regular, size_t(1) << 40));
+    REQUIRE(use_streaming_stores(t_store_mode::streaming, 0));
+    REQUIRE(!use_streaming_stores(t_store_mode::automatic, default_threshold - 1));
+    REQUIRE(use_streaming_stores(t_store_mode::automatic, default_threshold));
+
+    set_streaming_store_threshold(1024);
+    REQUIRE(get_streaming_store_threshold() == 1024);
+    REQUIRE(use_streaming_stores(t_store_mode::automatic, 1024));
+
+    // automatic mode above the threshold
+    std::vector<double> x(1000, 2.0), out(1000);
+    fma_dispatch(out.data(), x.data(), 3.0, 1.0, x.size());
+    for (auto v : out)
+        REQUIRE(v == Catch::Approx(7.0));
+
+    set_streaming_store_threshold(default_threshold);
+    REQUIRE(get_streaming_store_threshold() == default_threshold);
+}
+
+// ---- parallel (mp_cores) variants ----
+
+TEMPLATE_TEST_CASE("fma_dispatch/fmab_dispatch: mp_cores matches single threaded",
+                   TESTTAG,
+                   float,
+                   double)
+{
+    // large enough to be split in several chunks (parallel_min_bytes_per_thread)
+    const size_t N = 5 * parallel_min_bytes_per_thread / sizeof(TestType) + 37;
+
+    aligned_vector<TestType> x(N + 8), base(N + 8), out_single(N + 8), out_parallel(N + 8);
+    for (size_t i = 0; i < N + 8; ++i)
+    {
+        x[i]    = TestType(i % 1013) * TestType(0.125);
+        base[i] = TestType(i % 17);
+    }
+
+    for (int mp_cores : { 1, 2, 3, 4, 16 })
+        for (size_t offset : { size_t(0), size_t(1), size_t(5) })
+            for (size_t n : { size_t(100), N / 3, N })
+            {
+                std::fill(out_single.begin(), out_single.end(), TestType(-1));
+                std::fill(out_parallel.begin(), out_parallel.end(), TestType(-1));
+
+                fma_dispatch(
+                    out_single.data() + offset, x.data() + offset, TestType(3), TestType(2), n);
+                fma_dispatch(out_parallel.data() + offset,
+                             x.data() + offset,
+                             TestType(3),
+                             TestType(2),
+                             n,
+                             t_store_mode::automatic,
+                             mp_cores);
+                REQUIRE(out_single == out_parallel);
+
+                fmab_dispatch(out_single.data() + offset, x.data(), TestType(3), base.data(), n);
+                fmab_dispatch(out_parallel.data() + offset,
+                              x.data(),
+                              TestType(3),
+                              base.data(),
+                              n,
+                              t_store_mode::streaming,
+                              mp_cores);
+                REQUIRE(out_single == out_parallel);
+            }
+
+    // returning overloads
+    auto r_single   = fma_dispatch(x.data(), TestType(3), TestType(2), N);
+    auto r_parallel = fma_dispatch(x.data(), TestType(3), TestType(2), N, 4);
+    REQUIRE(std::equal(r_single.begin(), r_single.end(), r_parallel.begin()));
+}
+
+// ---- gap detection ----
+
+template<typename T>
+std::vector<size_t> ref_find_gaps(const std::vector<T>& x, T threshold)
+{
+    std::vector<size_t> gaps;
+    for (size_t i = 1; i < x.size(); ++i)
+        if (x[i] - x[i - 1] > threshold)
+            gaps.push_back(i);
+    return gaps;
+}
+
+TEMPLATE_TEST_CASE("find_gaps_dispatch: matches scalar reference", TESTTAG, float, double)
+{
+    // sorted series with a gap every 7th / 97th / 1001st step (all lane positions, blocks)
+    for (size_t n : { size_t(0), size_t(1), size_t(2), size_t(37), size_t(10007) })
+        for (size_t gap_every : { size_t(7), size_t(97), size_t(1001) })
+        {
+            std::vector<TestType> x(n);
+            TestType              t = 0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                t += (i % gap_every == 0) ? TestType(5) : TestType(0.25) * TestType(i % 3);
+                x[i] = t;
+            }
+
+            const auto expected = ref_find_gaps(x, TestType(1));
+            REQUIRE(find_gaps_dispatch(x.data(), TestType(1), n) == expected);
+
+            std::vector<size_t> gaps(n);
+            REQUIRE(find_gaps_dispatch(gaps.data(), x.data(), TestType(1), n) == expected.size());
+            REQUIRE(std::equal(expected.begin(), expected.end(), gaps.begin()));
+        }
+}
+
+TEMPLATE_TEST_CASE("find_gaps_dispatch: NaN and infinite values", TESTTAG, float, double)
+{
+    const TestType nan = std::numeric_limits<TestType>::quiet_NaN();
+    const TestType inf = std::numeric_limits<TestType>::infinity();
+
+    std::vector<TestType> x = { 0, 1, nan, 2, 10, 11, inf, 12, 13, 20, 21, 22, 23, 24, 50, 51, 52 };
+    const auto            gaps = find_gaps_dispatch(x.data(), TestType(2), x.size());
+    REQUIRE(gaps == ref_find_gaps(x, TestType(2)));
+    REQUIRE(gaps == std::vector<size_t>{ 4, 6, 9, 14 });
+}
+
+TEST_CASE("gap_threshold: same result as comparing with the double max_gap", TESTTAG)
+{
+    // 0.1f > 0.1 (double): a float difference of 0.1f is a gap for max_gap = 0.1
+    REQUIRE(double(0.1f) > 0.1);
+    REQUIRE(gap_threshold<float>(0.1) < 0.1f);
+    REQUIRE(0.1f > gap_threshold<float>(0.1));
+
+    std::vector<float> x = { 0.f, 0.1f, 0.2f, 0.25f };
+    REQUIRE(find_gaps_dispatch(x.data(), gap_threshold<float>(0.1), x.size()) ==
+            std::vector<size_t>{ 1, 2 });
+
+    for (double max_gap : { 0.1, 0.3, 1.0, 1e-7, 1e30, 1e300, 2.5 })
+    {
+        const float threshold = gap_threshold<float>(max_gap);
+        REQUIRE(double(threshold) <= max_gap);
+        REQUIRE(double(std::nextafter(threshold, std::numeric_limits<float>::infinity())) >
+                max_gap);
+
+        REQUIRE(gap_threshold<double>(max_gap) == max_gap);
+    }
+
+    REQUIRE(std::isnan(gap_threshold<float>(std::numeric_limits<double>::quiet_NaN())));
+    REQUIRE(gap_threshold<float>(std::numeric_limits<double>::infinity()) ==
+            std::numeric_limits<float>::infinity());
+}
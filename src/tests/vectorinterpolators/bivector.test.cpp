@@ -100,7 +100,7 @@ TEST_CASE("BiVectorInterpolator: should perform basic interpolations correctly",
     test_interpolator_serialize(interpolator);
 
     // hashing should stay stable
-    REQUIRE(interpolator.binary_hash() == 2221036240740104729ULL);
+    REQUIRE(interpolator.binary_hash() == 4656936829036154697ULL);
 
     SECTION("existing values should be looked up correctly")
     {
@@ -115,7 +115,7 @@ TEST_CASE("BiVectorInterpolator: should perform basic interpolations correctly",
     }
 
     REQUIRE(interpolator.binary_hash() ==
-            2221036240740104729ULL); // lookup should not change the hash
+            4656936829036154697ULL); // lookup should not change the hash
 
     // SECTION("preset values should be interpolated correctly")
     // {
@@ -129,7 +129,7 @@ TEST_CASE("BiVectorInterpolator: should perform basic interpolations correctly",
     // }
 
     REQUIRE(interpolator.binary_hash() ==
-            2221036240740104729ULL); // lookup should not change the hash
+            4656936829036154697ULL); // lookup should not change the hash
 
     // SECTION("preset value vectors should be interpolated correctly")
     // {
@@ -143,7 +143,7 @@ TEST_CASE("BiVectorInterpolator: should perform basic interpolations correctly",
     // }
 
     REQUIRE(interpolator.binary_hash() ==
-            2221036240740104729ULL); // lookup should not change the hash
+            4656936829036154697ULL); // lookup should not change the hash
 
     // SECTION("extrapolation mode should cause:")
     // {
@@ -6,8 +6,11 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <span>
+#include <sstream>
 
 #include <themachinethatgoesping/tools/vectorinterpolators/akimainterpolator.hpp>
 #include <themachinethatgoesping/tools/vectorinterpolators/linearinterpolator.hpp>
@@ -85,6 +88,124 @@ void test_interpolator_serialize(t_interpolator& ip)
     }
 }
 
+template<typename t_interpolator>
+void test_interpolator_sampling_pyramid(t_interpolator ip, t_interpolator reference)
+{
+    INFO("test_interpolator_sampling_pyramid: " << ip.class_name());
+    auto require_same = [](const auto& a, const auto& b) {
+        REQUIRE(a.size() == b.size());
+        REQUIRE(std::equal(a.begin(), a.end(), b.begin()));
+    };
+
+    ip.set_sampling_pyramid(0.5, 8);
+    REQUIRE(ip.get_sampling_pyramid_base_interval() == 0.5);
+
+    for (double interval : { 0.5, 1.0, 3.0, 7.5 })
+        require_same(ip.get_sampled_X(interval), reference.get_sampled_X(interval));
+
+    // the cached pyramid must be dropped when the data changes
+    ip.append(100, 1);
+    reference.append(100, 1);
+    require_same(ip.get_sampled_X(1.0), reference.get_sampled_X(1.0));
+
+    ip.extend({ 101, 150 }, { 0, 1 });
+    reference.extend({ 101, 150 }, { 0, 1 });
+    require_same(ip.get_sampled_X(1.0), reference.get_sampled_X(1.0));
+
+    ip.insert({ 50, 51 }, { 0, 1 });
+    reference.insert({ 50, 51 }, { 0, 1 });
+    require_same(ip.get_sampled_X(1.0), reference.get_sampled_X(1.0));
+
+    ip.set_data_XY({ 0, 1, 2, 3, 40, 41 }, { 0, 1, 0, 1, 0, 1 });
+    reference.set_data_XY({ 0, 1, 2, 3, 40, 41 }, { 0, 1, 0, 1, 0, 1 });
+    require_same(ip.get_sampled_X(1.0), reference.get_sampled_X(1.0));
+
+    // disable
+    ip.set_sampling_pyramid(0);
+    REQUIRE(std::isnan(ip.get_sampling_pyramid_base_interval()));
+    require_same(ip.get_sampled_X(1.0), reference.get_sampled_X(1.0));
+    REQUIRE_THROWS_AS(ip.set_sampling_pyramid(1, 0), std::invalid_argument);
+}
+
+template<typename t_interpolator>
+void test_interpolator_binary_hash(t_interpolator ip)
+{
+    // hash_to visits the same bytes as to_stream
+    const auto buffer = ip.to_binary();
+    REQUIRE(ip.binary_hash() == xxh::xxhash3<64>(buffer.data(), buffer.size()));
+
+    // the hash is memoized until the data or the extrapolation mode changes
+    const auto hash = ip.binary_hash();
+    REQUIRE(ip.get_binary_hash_cache().is_valid());
+    REQUIRE(t_interpolator(ip).get_binary_hash_cache().is_valid());
+
+    ip.append(100, 1);
+    REQUIRE_FALSE(ip.get_binary_hash_cache().is_valid());
+    REQUIRE(ip.binary_hash() != hash);
+    REQUIRE(ip.binary_hash() == t_interpolator::from_binary(ip.to_binary()).binary_hash());
+
+    const auto hash_appended = ip.binary_hash();
+    ip.set_extrapolation_mode(vectorinterpolators::t_extr_mode::fail);
+    REQUIRE(ip.binary_hash() != hash_appended);
+
+    const auto buffer_fail = ip.to_binary();
+    REQUIRE(ip.binary_hash() == xxh::xxhash3<64>(buffer_fail.data(), buffer_fail.size()));
+}
+
+template<typename t_interpolator>
+void test_interpolator_compressed(const t_interpolator& ip, double max_size_ratio)
+{
+    using classhelper::t_binary_encoding;
+
+    const auto raw        = ip.to_binary();
+    const auto compressed = ip.to_binary(true, t_binary_encoding::compressed);
+    REQUIRE(double(compressed.size()) <= double(raw.size()) * max_size_ratio);
+
+    // from_binary / from_stream detect the encoding
+    REQUIRE(t_interpolator::from_binary(compressed, true) == ip);
+    REQUIRE(t_interpolator::from_binary(raw, true) == ip);
+
+    std::stringstream ss;
+    ip.to_stream(ss, t_binary_encoding::compressed);
+    ip.to_stream(ss);
+    REQUIRE(t_interpolator::from_stream(ss) == ip);
+    REQUIRE(t_interpolator::from_stream(ss) == ip);
+
+    // the hash describes the data, not the encoding
+    REQUIRE(t_interpolator::from_binary(compressed).binary_hash() == ip.binary_hash());
+
+    // binary_size is exact, to_binary_into writes the same bytes into a caller-owned buffer
+    REQUIRE(raw.size() == ip.binary_size());
+    std::vector<char> buffer(raw.size() + 10);
+    REQUIRE(ip.to_binary_into(buffer) == raw.size());
+    REQUIRE(std::string(buffer.data(), raw.size()) == raw);
+    REQUIRE(ip.to_binary_into(buffer, t_binary_encoding::compressed) == compressed.size());
+    REQUIRE(std::string(buffer.data(), compressed.size()) == compressed);
+
+    REQUIRE_THROWS_AS(ip.to_binary_into(std::span<char>(buffer.data(), raw.size() - 1)),
+                      std::runtime_error);
+    REQUIRE_THROWS_AS(ip.to_binary_into(std::span<char>(buffer.data(), compressed.size() - 1),
+                                        t_binary_encoding::compressed),
+                      std::runtime_error);
+}
+
+template<typename t_interpolator>
+void test_interpolator_legacy_layout(const t_interpolator& ip)
+{
+    // raw layout of older versions (no version header): extr_mode | X | Y
+    const vectorinterpolators::t_extr_mode extr_mode = ip.get_extrapolation_mode().value;
+    std::stringstream                      legacy;
+    legacy.write(reinterpret_cast<const char*>(&extr_mode), sizeof(extr_mode));
+    classhelper::stream::container_to_stream(legacy, ip.get_data_X());
+    classhelper::stream::container_to_stream(legacy, ip.get_data_Y());
+
+    REQUIRE(t_interpolator::from_binary(legacy.str(), true) == ip);
+    REQUIRE(t_interpolator::from_stream(legacy) == ip);
+
+    // the current raw layout starts with a version header (tagged fields)
+    REQUIRE(ip.to_binary().starts_with(ip.class_name() + "_V2"));
+}
+
 TEST_CASE("VectorInterpolators should serializable", TESTTAG)
 {
     std::vector<double> x     = { -10, -5, 0, 6, 12 };
@@ -104,6 +225,22 @@ TEST_CASE("VectorInterpolators should serializable", TESTTAG)
     test_interpolator_serialize(slerp);
 }
 
+TEST_CASE("VectorInterpolators: read the legacy raw layout", TESTTAG)
+{
+    std::vector<double> x     = { -10, -5, 0, 6, 12 };
+    std::vector<double> y     = { 1, 0, 1, 0, -1 };
+    std::vector<double> yaw   = { 1, 0, 1, 0, -1 };
+    std::vector<double> pitch = { 1, 0, 1, 0, -1 };
+    std::vector<double> roll  = { 1, 0, 1, 0, -1 };
+
+    test_interpolator_legacy_layout(vectorinterpolators::LinearInterpolator<double, double>(
+        x, y, vectorinterpolators::t_extr_mode::nearest));
+    test_interpolator_legacy_layout(vectorinterpolators::NearestInterpolator<double, double>(x, y));
+    test_interpolator_legacy_layout(vectorinterpolators::AkimaInterpolator<double>(x, y));
+    test_interpolator_legacy_layout(
+        vectorinterpolators::SlerpInterpolator<double, double>(x, yaw, pitch, roll));
+}
+
 /**
  * @brief This test is more of a compile time check actually, it makes sure that the interpolators
  * implement all virtual functions such that they can actually be copied (had problems with this)
@@ -455,13 +592,181 @@ TEST_CASE("VectorInterpolators should hashable", TESTTAG)
     REQUIRE(aip.binary_hash() != 0);
     REQUIRE(slerp.binary_hash() != 0);
 
-    CHECK(lip.binary_hash() == 10074301266414863605ULL);
-    CHECK(nip.binary_hash() == 10074301266414863605ULL);
-    CHECK(aip.binary_hash() == 10074301266414863605ULL);
-    CHECK(slerp.binary_hash() == 5661085787625436237ULL);
+    CHECK(lip.binary_hash() == 5492908170267227990ULL);
+    CHECK(nip.binary_hash() == 4942168772535981197ULL);
+    CHECK(aip.binary_hash() == 9471373590003214712ULL);
+    CHECK(slerp.binary_hash() == 16876442722228123901ULL);
 
     // test_interpolator_serialize(nip);
     // test_interpolator_serialize(lip);
     // test_interpolator_serialize(aip);
     // test_interpolator_serialize(slerp);
-}
\ No newline at end of file
+}
+
+TEST_CASE("VectorInterpolators: get_sampled_X with sampling pyramid", TESTTAG)
+{
+    std::vector<double> x = { -10, -5, 0, 6, 12, 13, 14, 15, 30, 31, 32 };
+    std::vector<double> y = { 1, 0, 1, 0, -1, 1, 0, 1, 0, -1, 1 };
+
+    using t_lip = vectorinterpolators::LinearInterpolator<double, double>;
+    using t_nip = vectorinterpolators::NearestInterpolator<double, double>;
+    using t_aip = vectorinterpolators::AkimaInterpolator<double>;
+
+    // (akima interpolators share the spline when copied, so the reference is created separately)
+    test_interpolator_sampling_pyramid(t_lip(x, y), t_lip(x, y));
+    test_interpolator_sampling_pyramid(t_nip(x, y), t_nip(x, y));
+    test_interpolator_sampling_pyramid(t_aip(x, y), t_aip(x, y));
+}
+
+TEST_CASE("VectorInterpolators: concurrent get_sampled_X with sampling pyramid", TESTTAG)
+{
+    // x = 0, 0.25, ... with a gap of 10 after every 1000 values
+    std::vector<double> x, y;
+    for (size_t i = 0; i < 100000; ++i)
+    {
+        x.push_back(i == 0 ? 0 : x.back() + (i % 1000 == 0 ? 10.0 : 0.25));
+        y.push_back(double(i % 7));
+    }
+
+    vectorinterpolators::LinearInterpolator<double, double> reference(x, y);
+    vectorinterpolators::LinearInterpolator<double, double> lip(x, y);
+    lip.set_sampling_pyramid(0.5, 8);
+    const auto& const_lip = lip;
+
+    // the first calls build the pyramid concurrently
+    const std::vector<double>           intervals = { 0.5, 1.0, 2.0, 3.0, 7.5, 16.0, 40.0, 100.0 };
+    const int                           n_calls   = 64;
+    std::vector<xt::xtensor<double, 1>> results(n_calls);
+#pragma omp parallel for num_threads(8)
+    for (int i = 0; i < n_calls; ++i)
+        results[i] = const_lip.get_sampled_X(intervals[i % intervals.size()]);
+
+    for (int i = 0; i < n_calls; ++i)
+    {
+        const auto expected = reference.get_sampled_X(intervals[i % intervals.size()]);
+        REQUIRE(results[i].size() == expected.size());
+        REQUIRE(std::equal(expected.begin(), expected.end(), results[i].begin()));
+    }
+
+    // copies share the built pyramid and rebuild their own when their data changes
+    auto copy = lip;
+    copy.append(x.back() + 20, 0);
+    reference.append(x.back() + 20, 0);
+    const auto expected = reference.get_sampled_X(1.0);
+    const auto result   = copy.get_sampled_X(1.0);
+    REQUIRE(result.size() == expected.size());
+    REQUIRE(std::equal(expected.begin(), expected.end(), result.begin()));
+    REQUIRE(lip.get_sampled_X(1.0).size() + 1 == result.size());
+}
+
+TEST_CASE("VectorInterpolators: get_sampled_XY gathers knots", TESTTAG)
+{
+    std::vector<double> x = { -10, -5, 0, 6, 12, 13, 14, 15, 30, 31, 32 };
+    std::vector<double> y = { 1, 0, 1, 0, -1, 1, 0, 1, 0, -1, 1 };
+
+    vectorinterpolators::LinearInterpolator<double, double> lip(x, y);
+    vectorinterpolators::AkimaInterpolator<double>          aip(x, y);
+
+    auto [indices, X, Y] = lip.get_sampled_XY(2.0, 10.0);
+    REQUIRE(indices.size() > 0);
+    REQUIRE(indices.size() < x.size());
+    REQUIRE(std::equal(indices.begin(), indices.end(), lip.get_sampled_indices(2.0, 10.0).begin()));
+
+    // sampled x values are knots: y is identical to the interpolated value
+    auto Y_interpolated = lip(std::vector<double>(X.begin(), X.end()));
+    REQUIRE(std::equal(Y.begin(), Y.end(), Y_interpolated.begin()));
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        REQUIRE(X[i] == x[indices[i]]);
+        REQUIRE(Y[i] == y[indices[i]]);
+    }
+
+    auto [aindices, aX, aY] = aip.get_sampled_XY(2.0, 10.0, 2);
+    REQUIRE(std::equal(aindices.begin(), aindices.end(), indices.begin(), indices.end()));
+    REQUIRE(std::equal(aY.begin(), aY.end(), Y.begin(), Y.end()));
+
+    // additional channels
+    std::vector<float> channel(x.size());
+    for (size_t i = 0; i < channel.size(); ++i)
+        channel[i] = float(i) * 2;
+
+    auto sampled_channel = lip.get_sampled_channel(channel, indices);
+    for (size_t i = 0; i < indices.size(); ++i)
+        REQUIRE(sampled_channel[i] == float(indices[i]) * 2);
+
+    REQUIRE_THROWS_AS(lip.get_sampled_channel(std::vector<float>(3), indices),
+                      std::invalid_argument);
+}
+
+TEST_CASE("VectorInterpolators: binary_hash without serialization", TESTTAG)
+{
+    std::vector<double> x     = { -10, -5, 0, 6, 12 };
+    std::vector<double> y     = { 1, 0, 1, 0, -1 };
+    std::vector<double> yaw   = { 1, 0, 1, 0, -1 };
+    std::vector<double> pitch = { 1, 0, 1, 0, -1 };
+    std::vector<double> roll  = { 1, 0, 1, 0, -1 };
+
+    test_interpolator_binary_hash(vectorinterpolators::LinearInterpolator<double, double>(x, y));
+    test_interpolator_binary_hash(vectorinterpolators::NearestInterpolator<double, double>(x, y));
+    test_interpolator_binary_hash(vectorinterpolators::AkimaInterpolator<double>(x, y));
+
+    vectorinterpolators::SlerpInterpolator<double, double> slerp(x, yaw, pitch, roll);
+    const auto                                             buffer = slerp.to_binary();
+    REQUIRE(slerp.binary_hash() == xxh::xxhash3<64>(buffer.data(), buffer.size()));
+}
+
+TEST_CASE("VectorInterpolators: compressed serialization", TESTTAG)
+{
+    // navigation like data: regular timestamps and slowly varying values
+    std::vector<double> x, y, yaw, pitch, roll;
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        x.push_back(1.7e9 + double(i) * 0.25);
+        y.push_back(double(int(std::sin(double(i) * 0.001) * 100)) * 0.01);
+        yaw.push_back(double(i / 100));
+        pitch.push_back(0);
+        roll.push_back(1);
+    }
+
+    test_interpolator_compressed(
+        vectorinterpolators::LinearInterpolator<double, double>(x, y), 0.5);
+    test_interpolator_compressed(
+        vectorinterpolators::NearestInterpolator<double, double>(x, y), 0.5);
+    test_interpolator_compressed(vectorinterpolators::AkimaInterpolator<double>(x, y), 0.5);
+    test_interpolator_compressed(
+        vectorinterpolators::SlerpInterpolator<double, double>(x, yaw, pitch, roll), 0.5);
+
+    // incompressible data is stored raw (small header overhead only)
+    std::vector<double> noise_x, noise_y;
+    uint64_t            state = 12345;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        noise_x.push_back(double(i) + double(state >> 40) / double(1ULL << 24));
+        noise_y.push_back(double(state));
+    }
+    test_interpolator_compressed(
+        vectorinterpolators::LinearInterpolator<double, double>(noise_x, noise_y), 1.01);
+
+    // large data is written in chunks (in parallel), the hash is computed while writing
+    for (size_t i = x.size(); i < 300000; ++i)
+    {
+        x.push_back(1.7e9 + double(i) * 0.25);
+        y.push_back(double(i % 1000));
+    }
+    vectorinterpolators::LinearInterpolator<double, double> lip(x, y);
+    const auto compressed = lip.to_binary(true, classhelper::t_binary_encoding::compressed, 4);
+    REQUIRE(lip.get_binary_hash_cache().is_valid());
+
+    const auto lip2 = decltype(lip)::from_binary(compressed, true, 4);
+    REQUIRE(lip2 == lip);
+    REQUIRE(lip2.binary_hash() == lip.binary_hash());
+    REQUIRE(compressed.size() < lip.to_binary().size() / 2);
+
+    // containers larger than hash_chunk_bytes do not change the hash definition: binary_hash
+    // (computed while writing or with hash_to) is the xxhash3 of the raw to_binary bytes
+    const auto raw = lip.to_binary();
+    REQUIRE(raw.size() > 2 * classhelper::hash_chunk_bytes);
+    REQUIRE(lip.binary_hash() == xxh::xxhash3<64>(raw.data(), raw.size()));
+    REQUIRE(lip2.binary_hash() == xxh::xxhash3<64>(raw.data(), raw.size()));
+}
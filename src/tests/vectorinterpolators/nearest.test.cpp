@@ -26,11 +26,11 @@ TEST_CASE("NearestInterpolator: should perform basic interpolations correctly",
     vectorinterpolators::NearestInterpolator interpolator(x, y);
 
     // hashing should stay stable
-    REQUIRE(interpolator.binary_hash() == 14894304295739877660ULL);
+    REQUIRE(interpolator.binary_hash() == 11594248326311870270ULL);
 
     // append some data
     interpolator.append(x_append, y_append);
-    REQUIRE(interpolator.binary_hash() == 10074301266414863605ULL);
+    REQUIRE(interpolator.binary_hash() == 4942168772535981197ULL);
 
     SECTION("existing values should be looked up correctly")
     {
@@ -40,7 +40,7 @@ TEST_CASE("NearestInterpolator: should perform basic interpolations correctly",
         REQUIRE(interpolator(x_append) == Catch::Approx(y_append));
     }
     REQUIRE(interpolator.binary_hash() ==
-            10074301266414863605ULL); // lookup should not change the hash
+            4942168772535981197ULL); // lookup should not change the hash
 
     SECTION("const interpolation should produce the same results as classic interpolation")
     {
@@ -48,7 +48,7 @@ TEST_CASE("NearestInterpolator: should perform basic interpolations correctly",
             REQUIRE(interpolator(x_val) == Catch::Approx(interpolator.get_y(x_val)));
     }
     REQUIRE(interpolator.binary_hash() ==
-            10074301266414863605ULL); // lookup should not change the hash
+            4942168772535981197ULL); // lookup should not change the hash
 
     SECTION("preset values should be interpolated correctly")
     {
@@ -70,7 +70,7 @@ TEST_CASE("NearestInterpolator: should perform basic interpolations correctly",
         REQUIRE(interpolator(9.1) == Catch::Approx(-1));
     }
     REQUIRE(interpolator.binary_hash() ==
-            10074301266414863605ULL); // lookup should not change the hash
+            4942168772535981197ULL); // lookup should not change the hash
 
     SECTION("preset value vectors should be interpolated correctly")
     {
@@ -80,7 +80,7 @@ TEST_CASE("NearestInterpolator: should perform basic interpolations correctly",
         REQUIRE(interpolator(targets_x) == expected_y);
     }
     REQUIRE(interpolator.binary_hash() ==
-            10074301266414863605ULL); // lookup should not change the hash
+            4942168772535981197ULL); // lookup should not change the hash
 
     SECTION("extrapolation mode should cause:")
     {
@@ -0,0 +1,145 @@
+//sourcehash: aeeeaaa429ea0761cf4e2e1bea825ff018c3fc9f82ca944f35ab56f949c7cac0
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader =
+R"doc(Asynchronous loader for serialized objects (files or byte ranges of files
+written with to_binary)
+
+Requests are queued and processed by a pool of worker threads. Each
+worker reads the bytes of one request and directly deserializes them
+(from_binary), so reading and decoding of different objects overlap and
+many small reads are in flight at the same time. Results are returned as
+std::future or passed to a callback as soon as they are complete.
+
+Reads use plain positional file reads on the worker threads (portable,
+no io_uring). Pending requests are completed before the loader is
+destroyed.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_BatchLoader =
+R"doc(Construct a new loader
+
+Args:
+    io_threads: number of worker threads (number of concurrent reads /
+                decodes), 0: use std::thread::hardware_concurrency())doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_BatchLoader_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_enqueue = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_get_io_threads = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_load =
+R"doc(Load one object per file and pass each object to callback as soon as
+it is loaded (completion order, not file order)
+
+The callback is called from the worker threads, but never concurrently,
+so it does not need to be thread safe. The function returns when all
+files are processed.
+
+Args:
+    callback: void(size_t index, T_object&& object), index into
+              file_paths
+
+Throws:
+    the first read / deserialization / callback error (after all files
+    are processed))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_load_2 =
+R"doc(Load one object per file (blocking), reads and decoding run
+concurrently
+
+Returns:
+    objects in the order of file_paths)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_load_async =
+R"doc(Asynchronously read and deserialize an object (T_object::from_binary)
+
+Args:
+    file_path: file that contains the to_binary buffer
+    offset: offset of the buffer in the file
+    size: size of the buffer, to_end_of_file: the rest of the file
+
+Returns:
+    std::future<T_object> (rethrows read / deserialization errors on
+    get()))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_load_async_2 =
+R"doc(Asynchronously load one object per file
+
+Returns:
+    one future per file (same order as file_paths))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_mutex = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_operator_assign = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_read_async =
+R"doc(Asynchronously read size bytes at offset of a file)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_read_bytes =
+R"doc(Read size bytes at offset of a file (blocking, used by the workers)
+
+Args:
+    size: number of bytes, to_end_of_file: read until the end of the
+          file
+
+Throws:
+    std::runtime_error if the file cannot be opened or is too short)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_stop = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_task_available = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_tasks = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_to_end_of_file = R"doc(read until the end of the file)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_worker_loop = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BatchLoader_workers = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -0,0 +1,193 @@
+//sourcehash: e6c187af903ec25e1d206ff37e6ad7e07264e9bbca0b6e8b796b6696195d262e
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor =
+R"doc(Forward only read cursor over a binary buffer (e.g. the result of
+to_binary or a memory mapped file)
+
+The cursor reads the same layout as the stream functions
+(classhelper::read_version, stream::container_from_stream, ...) but
+without the std::istream overhead. Containers can be borrowed as
+ContainerView (zero copy) or copied with a single memcpy. Reading past
+the end of the buffer throws a std::runtime_error.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_ByteCursor =
+R"doc(Construct a new cursor at the start of buffer
+
+Args:
+    buffer: buffer to read (is not copied and must outlive the cursor
+            and all views))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_at_end = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_buffer = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_check_at_end =
+R"doc(Throw if the buffer was not read completely)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_check_remaining = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_position = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_read = R"doc(Copy the next bytes to destination)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_read_2 =
+R"doc(Read a trivially copyable value (same layout as is.read(&value,
+sizeof(value))))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_read_any_version =
+R"doc(Same as classhelper::read_any_version
+
+Returns:
+    index of the name that was read)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_read_bytes =
+R"doc(Borrow the next bytes of the buffer (zero copy))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_read_container =
+R"doc(Read a container written with stream::container_to_stream into an
+owning container (single memcpy, same result as
+stream::container_from_stream)
+
+Template Args:
+    T_container: container with resize() and data() (e.g.
+                 std::vector<T>))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_read_container_view =
+R"doc(Borrow a container written with stream::container_to_stream (zero
+copy)
+
+Template Args:
+    T: value type of the container
+
+Returns:
+    ContainerView<T> view into the buffer)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_read_version =
+R"doc(Same check as classhelper::read_version
+
+Args:
+    required_name: expected class name/version string
+    class_name: used for the error message)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_remaining = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_skip = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_try_read_any_version =
+R"doc(Same as classhelper::try_read_any_version
+
+Returns:
+    index of the name that was read, std::nullopt if nothing was read)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView =
+R"doc(Borrowed (non owning) view of a container that was written with
+stream::container_to_stream
+
+The view points into the buffer that was passed to the ByteCursor, so
+the buffer (e.g. a memory mapped file) must outlive the view. The
+payload offsets of the stream format are not aligned, therefore element
+access uses memcpy loads. as_span() is only possible if the payload
+happens to be aligned. Use to_vector() / to<T_container>() (a single
+memcpy) when ownership is needed.
+
+Template Args:
+    T: trivially copyable value type of the container)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_ContainerView = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_ContainerView_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_as_span =
+R"doc(Zero copy span of the payload
+
+Returns:
+    std::span<const T>
+
+Raises:
+    std::runtime_error: if the payload is not aligned for T)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_at = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_bytes =
+R"doc(Raw bytes of the payload (points into the borrowed buffer))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_empty = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_is_aligned =
+R"doc(True if the payload is aligned for T (required for as_span))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_operator_array =
+R"doc(Element access (memcpy load, works for unaligned payloads))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_to =
+R"doc(Copy the payload into an owning container (single memcpy)
+
+Template Args:
+    T_container: container with resize() and data() (e.g.
+                 std::vector<T>))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ContainerView_to_vector = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_from_binary_cursor =
+R"doc(Read an object from a buffer using T_class::from_cursor (used by
+from_binary)
+
+Args:
+    buffer: buffer written with to_binary
+    check_buffer_is_read_completely: throw if the buffer contains
+                                     trailing bytes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ByteCursor_try_read_version =
+R"doc(Same as classhelper::try_read_version
+
+Returns:
+    true if the buffer continues with name (the name is then skipped))doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -1,4 +1,4 @@
-//sourcehash: e841db48dbaf3b8ad191d9d737d6fb183f0f0c63bac9d2b8a40f3c7a9cdb50c9
+//sourcehash: beced891c52114e1a4907e78ede45f81d505eddf2cfe97364ed458000053602f
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -41,10 +41,46 @@
 #endif
 
 
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_read_any_version =
+R"doc(Read a version name that must be one of several supported versions (e.g.
+the current layout and older layouts that are still readable)
+
+All names must have the same length.
+
+Returns:
+    index of the name that was read)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_classhelper_read_version = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_try_read_any_version =
+R"doc(Same as read_any_version, but only if the stream starts with the first
+character of the names (used to detect layouts that were written without
+a version header)
+
+All names must start with the same character, which must not be a
+possible first byte of the layout without a version header.
+
+Returns:
+    index of the name that was read, std::nullopt if nothing was read)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_try_read_version =
+R"doc(Read the version name only if the stream starts with it (used to
+negotiate optional encodings, e.g. compressed streams, for layouts that
+may not start with this name)
+
+The first character of name must not be a possible first byte of the
+alternative layout.
+
+Returns:
+    true if the version name was read)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_classhelper_write_version = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_write_version_2 =
+R"doc(Same as write_version(std::ostream&, ...), but helper::osstream and
+helper::ospanstream are written without going through the
+std::streambuf interface)doc";
+
 #if defined(__GNUG__)
 #pragma GCC diagnostic pop
 #endif
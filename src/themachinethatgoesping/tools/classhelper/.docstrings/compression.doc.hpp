@@ -0,0 +1,166 @@
+//sourcehash: 1449dc32c7ce22da223ec448c7ff5866c1a60394d0bd198f20e5ae83d90c859c
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_compression_decode =
+R"doc(Decompress data written with encode
+
+Args:
+    encoded: encoded bytes
+    data: output buffer (element_count * element_size bytes)
+    element_count: number of elements
+    element_size: size of one element in bytes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_compression_encode =
+R"doc(Compress an array of trivially copyable elements
+
+Consecutive elements are xor'ed (slowly varying or sorted values share
+their high bytes), the bytes are shuffled into planes (byte 0 of all
+elements, byte 1 of all elements, ...) and the planes are run length
+encoded. Timestamps and slowly varying sensor values produce long zero
+runs in the upper planes.
+
+Args:
+    data: pointer to the first element
+    element_count: number of elements
+    element_size: size of one element in bytes
+
+Returns:
+    std::string encoded bytes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_compression_max_decode_ratio =
+R"doc(Maximum number of decoded bytes per encoded byte (longest run in 2
+bytes)
+
+Readers use this to reject corrupt sizes before allocating the decoded
+container.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_compression_t_codec =
+R"doc(Codec of a compressed container payload (stored in front of the payload))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_compression_t_codec_chunked =
+R"doc(< independently encoded and hashed chunks (large containers))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_compression_t_codec_raw =
+R"doc(< uncompressed element bytes (used if compression does not pay off))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_compression_t_codec_xor_shuffle_rle =
+R"doc(< xor delta + byte shuffle + run length encoding)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_chunked_container_to_stream =
+R"doc(Write a large container with the chunked codec (used by
+compressed_container_to_stream)
+
+The container is split into chunks of hash_chunk_elements values that
+are hashed and encoded independently (in parallel). Layout: [size_t
+size][uint8_t codec][size_t encoded_size] [size_t
+chunk_elements][size_t n_chunks], n_chunks x [uint64_t hash][uint8_t
+codec] [size_t chunk_encoded_size], followed by the encoded chunks.
+
+Args:
+    mp_cores: Number of cores to use for parallelization
+
+Returns:
+    std::vector<uint64_t> chunk hashes (same as
+    classhelper::chunk_hashes))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_compressed_container_from_cursor =
+R"doc(Read a container written with compressed_container_to_stream from a
+ByteCursor
+
+Args:
+    mp_cores: Number of cores to use for parallelization (chunked
+              codec))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_compressed_container_from_payload =
+R"doc(Decode the payload of compressed_container_to_stream (used by the
+stream and cursor readers))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_compressed_container_from_stream =
+R"doc(Read a container written with compressed_container_to_stream
+
+Args:
+    mp_cores: Number of cores to use for parallelization (chunked
+              codec))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_compressed_container_to_stream =
+R"doc(Write a container with the compressed layout
+
+Layout: [size_t size][uint8_t codec][size_t encoded_size][encoded
+bytes]. The raw codec is stored if compression does not make the payload
+smaller. Containers larger than hash_chunk_bytes are written with the
+chunked codec (see chunked_container_to_stream). The elements are
+written as raw bytes (same requirements as container_to_stream).
+
+Args:
+    mp_cores: Number of cores to use for parallelization (chunked
+              codec)
+    hasher: if set, the container is fed into this hasher
+            (BinaryHasher::update_container, the hash of the raw layout,
+            not of the compressed bytes))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_decode_chunked_payload =
+R"doc(Decode a chunked payload (see chunked_container_to_stream) into data
+
+The chunks are decoded and their hashes are verified in parallel.
+
+Args:
+    mp_cores: Number of cores to use for parallelization)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_decode_payload =
+R"doc(Decode a single (not chunked) payload into data)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_t_binary_encoding =
+R"doc(Binary encoding used by to_stream / to_binary of classes that support
+compression)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_t_binary_encoding_compressed =
+R"doc(< containers are written with compression::encode)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_t_binary_encoding_raw =
+R"doc(< containers are written as size + raw element bytes (default))doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -0,0 +1,224 @@
+//sourcehash: 17b02331911aaf87967ab3e7aba4a78032c5b7e3798dd240dde8fbdb33a56f4f
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache =
+R"doc(Thread safe cache for computed objects, keyed by a hash of the inputs of
+the computation
+
+Objects are stored as to_binary buffers and reconstructed with
+from_binary, so cached objects can not be modified through the cache.
+Buffers are content addressed (binary_hash): if different keys produce
+the same object, the buffer is only stored once.
+
+When the buffers exceed max_memory_bytes, the least recently used
+buffers are evicted. If a spill file is given, evicted buffers (and their
+keys) are moved to an ObjectStore on disk and are loaded back on the next
+request. Since the ObjectStore is persistent, a later process that opens
+the same spill file (after flush()) can reuse the results. The spill file
+must not be used by two caches at the same time.
+
+get_or_compute has single flight semantics: concurrent requests for the
+same key compute the object only once, the other requests wait for the
+result. Buffers are shared with the requests, so from_binary, reading
+the spill file and writing evicted buffers (in batches) run without
+holding the cache lock.
+
+Keys must identify the computation including the type of the result
+(e.g. hash of the input file, the parameters and the class name).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Entry = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Entry_buffer = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Entry_keys = R"doc(keys that map to this buffer)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Entry_lru_position = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_ObjectCache =
+R"doc(Construct a new cache
+
+Args:
+    max_memory_bytes: maximum size of the buffers that are kept in memory
+    spill_file: optional ObjectStore file for evicted buffers (created
+                if it does not exist, an incomplete record of an
+                interrupted process is removed))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_ObjectCache_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_SpillJob =
+R"doc(buffer (and its keys) that is written to the spill file)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_SpillJob_buffer = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_SpillJob_content_hash = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_SpillJob_keys = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Statistics =
+R"doc(Counters for monitoring (see get_statistics))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Statistics_disk_hits =
+R"doc(hits that were loaded from the spill file)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Statistics_evictions =
+R"doc(buffers evicted from memory)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Statistics_hits =
+R"doc(requests served from memory or disk)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Statistics_lookup_misses =
+R"doc(get requests for keys that are not cached)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Statistics_misses =
+R"doc(requests that computed the object)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Statistics_spills =
+R"doc(evicted buffers written to the spill file)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_Statistics_waits =
+R"doc(requests that waited for the computation of another request)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_clear =
+R"doc(Remove all buffers from memory (the spill file is not modified))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_contains =
+R"doc(True if key is cached in memory or in the spill file)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_entries = R"doc(content hash -> buffer)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_evict = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_find_buffer = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_find_in_memory = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_flush =
+R"doc(Write all buffers that are in memory to the spill file (e.g. before the
+process ends, so other processes can reuse them). The buffers stay in
+memory.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_get =
+R"doc(Return the cached object for key (std::nullopt if the key is not
+cached))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_get_max_memory_bytes = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_get_memory_bytes = R"doc(size of the buffers in memory)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_get_number_of_buffers =
+R"doc(number of distinct buffers in memory)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_get_or_compute =
+R"doc(Return the cached object for key or compute (and cache) it
+
+Args:
+    key: hash of the inputs of the computation
+    compute: T_object() called if the key is not cached (at most once
+             for concurrent requests of the same key). If compute
+             throws, the exception is passed to all waiting requests and
+             nothing is cached.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_get_statistics = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_has_spill_file = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_in_flight = R"doc(keys that are being computed)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_insert_buffer = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_keys = R"doc(key -> content hash)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_load_from_spill_file = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_lru = R"doc(content hashes, most recent first)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_max_memory_bytes = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_memory_bytes = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_mutex = R"doc(guards all members except _spill_store)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_operator_assign = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_put =
+R"doc(Cache object under key
+
+Replaces the object of a key that is in memory. Keys that were already
+spilled to disk keep the spilled object once they are evicted again
+(keys are expected to identify a deterministic computation).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_reset_statistics = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_size = R"doc(number of keys in memory)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_spill_mutex =
+R"doc(guards _spill_store (file I/O without _mutex))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_spill_queue = R"doc(evicted buffers to write)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_spill_store = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_spilling = R"doc(evicted, spill write pending)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_statistics = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_t_buffer =
+R"doc(to_binary buffer, shared with the requests that read it (from_binary runs
+unlocked))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_t_in_flight =
+R"doc(running computations (single flight): key -> to_binary buffer of the result)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_t_spilling =
+R"doc(evicted buffers that are not yet written to the spill file: key ->
+content hash, buffer)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_write_spill_queue = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectCache_write_to_spill_file = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -1,4 +1,4 @@
-//sourcehash: b3f1e26616166af314f3bd6b65a5014f15f91feacd3f7b1d44a26095ac5ad785
+//sourcehash: e0525521e7d33d6046a55194ce601689440c76e2a484586305cfdb851367b9d5
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -0,0 +1,225 @@
+//sourcehash: bd4d77402835c992a62048440b87b32b5b3ec83ac26729fa3fb737a96f817415
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore =
+R"doc(Append only, memory mapped file store for serialized objects keyed by
+their binary_hash
+
+Each record consists of the 64 bit binary_hash, the size of the binary
+buffer and the buffer written by to_binary. Objects are only stored
+once (content addressed). Reading maps the file into memory, so buffers
+and ByteCursors returned by get_buffer / get_cursor are zero copy views
+into the mapping. They stay valid until the next add or close call (the
+file is remapped after writing). Batch loading maps the file once and
+does not allocate intermediate std::strings.
+
+An incomplete record at the end of the file (an interrupted write, or a
+write of another process that is still running) is ignored when the
+file is indexed, the file is only truncated by repair(). Before
+appending, records that other stores appended to the file are indexed.
+Several processes may read a store while one process appends to it, but
+only one store may write to the file at a time. The store is not thread
+safe.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_ObjectStore =
+R"doc(Open a store file (the file is created if it does not exist)
+
+Args:
+    file_path: path of the store file)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_PendingRecords =
+R"doc(records written to the file that are added to the index once the write
+is verified)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_PendingRecords_bytes = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_PendingRecords_contains = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_PendingRecords_index = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_PendingRecords_keys = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_Record = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_Record_offset =
+R"doc(< offset of the binary buffer in the file)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_Record_size = R"doc(< size of the binary buffer)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_add =
+R"doc(Append an object (skipped if an object with the same binary_hash is
+already stored)
+
+Template Args:
+    T_object: class with to_binary and binary_hash functions
+
+Returns:
+    uint64_t binary_hash of the object (key for reading it back))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_add_2 =
+R"doc(Append multiple objects (the file is only opened once)
+
+Template Args:
+    T_object: class with to_binary and binary_hash functions
+
+Returns:
+    std::vector<uint64_t> binary_hash of each object)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_add_buffer =
+R"doc(Append a binary buffer with the given key (skipped if the key is
+already stored)
+
+Args:
+    hash: key of the buffer (usually the binary_hash of the object)
+    buffer: binary buffer (usually the result of to_binary)
+
+Returns:
+    true if the buffer was appended, false if the key was already
+    stored)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_add_buffers =
+R"doc(Append multiple binary buffers (the file is only opened and flushed
+once, keys that are already stored are skipped)
+
+Args:
+    buffers: key and binary buffer of each record
+
+Returns:
+    size_t number of appended buffers)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_close =
+R"doc(Unmap the file (views returned by get_buffer / get_cursor become
+invalid))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_commit = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_contains = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_empty = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_file_path = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_file_size = R"doc(< end of the last complete record)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_get =
+R"doc(Read a stored object
+
+Template Args:
+    T_object: class with a from_binary function
+
+Args:
+    hash: key of the object)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_get_2 =
+R"doc(Read multiple stored objects (the file is mapped once, the buffers
+are read in place)
+
+Template Args:
+    T_object: class with a from_binary function
+
+Args:
+    hashes: keys of the objects
+    mp_cores: Number of cores to use for parallelization (only used if
+              T_object is default constructible)
+
+Returns:
+    std::vector<T_object> objects in the order of hashes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_get_all =
+R"doc(Read all stored objects (in the order they were added))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_get_buffer =
+R"doc(Binary buffer of a stored object (zero copy view into the mapped
+file, valid until the next add or close)
+
+Args:
+    hash: key of the object
+
+Returns:
+    std::string_view)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_get_cursor =
+R"doc(ByteCursor over the binary buffer of a stored object (zero copy, same
+lifetime as get_buffer))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_get_file_path = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_get_file_size =
+R"doc(Size of the indexed part of the store file in bytes (end of the last
+complete record))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_get_keys = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_index = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_index_file = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_keys = R"doc(< keys in file order)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_map_file = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_mapped_buffer = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_mapped_file = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_mapped_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_mapping_is_stale = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_open_for_append = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_repair =
+R"doc(Re-index the file and truncate an incomplete record at its end (e.g.
+after an interrupted write)
+
+Must not be called while another process appends to the file.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_ObjectStore_write_record = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -1,4 +1,4 @@
-//sourcehash: d6757b8374c67a94e13c645af487cd740d7cdc68ba64ef725b8e517def41b5f1
+//sourcehash: 35d2402e5b0041a5e887dd960b66d81a4adc953ab9bb8895c42c3eb92ec688d6
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -1,4 +1,4 @@
-//sourcehash: a9ab4c2b88ffe0576b257cd2895b8a59565d7d121af9e9b4d208a67d9ba27863
+//sourcehash: 7697bee509376f58af2abe59f4905f25118d8488303034291c0b1b01537f06fc
 
 /*
   This file contains docstrings for use in the Python bindings.
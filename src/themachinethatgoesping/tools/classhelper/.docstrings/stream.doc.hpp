@@ -1,4 +1,4 @@
-//sourcehash: aa21eb8a9c2e22fdc53cdce226747469ee8c2ef922cb2be794193b343843a0b0
+//sourcehash: 8d9a2a21fca5ce2f0d38af642d1e0748d87f6c240ce602af3ecaec4891e13cc4
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -41,10 +41,104 @@
 #endif
 
 
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_binary_fits =
+R"doc(False if T_class implements binary_size and the object does not fit into
+buffer_size bytes (used by to_binary_into to fail before writing))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_binary_size_hint =
+R"doc(Initial buffer capacity for to_binary (binary_size if implemented))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_check_binary_written =
+R"doc(Throw if writing into the buffer of to_binary_into failed (buffer too
+small))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_default_binary_size_hint =
+R"doc(initial capacity of to_binary for classes without binary_size (same as
+helper::osstream))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_has_binary_size =
+R"doc(True if T_class implements size_t binary_size() (exact size of the
+to_binary result))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamReader =
+R"doc(Reader for the stream functions below
+
+For helper::isviewstream (selected at compile time) the data is copied
+directly from the viewed buffer without going through the virtual
+std::streambuf interface. Other streams are read with
+std::istream::read. The reader never reads ahead, so it can be mixed
+with other reads from the same stream.
+
+Template Args:
+    T_istream: static type of the input stream)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamReader_StreamReader = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamReader_is = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamReader_is_isviewstream = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamReader_read = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamReader_read_container =
+R"doc(Read a container written with write_container / container_to_stream)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamReader_read_value =
+R"doc(Read the object representation of a value (sizeof(T) bytes))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter =
+R"doc(Buffered writer for the stream functions below
+
+Small writes (sizes, keys, values) are collected in a contiguous block
+that is written to the stream with a single call, large payloads (POD
+containers) are written directly. For helper::osstream (selected at
+compile time) all writes are appended to the target string without
+going through the virtual std::streambuf interface. The block is
+flushed in the destructor.
+
+Template Args:
+    T_ostream: static type of the output stream)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_StreamWriter = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_StreamWriter_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_block = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_block_pos = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_block_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_flush =
+R"doc(Write the buffered block to the stream)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_is_osstream = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_operator_assign = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_os = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_write = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_write_container =
+R"doc(Write size and data of a contiguous container (same layout as
+container_to_stream))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_StreamWriter_write_value =
+R"doc(Write the object representation of value (sizeof(T) bytes))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_container_binary_size =
+R"doc(Number of bytes container_to_stream writes for this container (size +
+data))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_container_container_from_reader = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_container_container_from_stream = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_container_container_to_stream = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_container_container_to_writer = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_container_from_stream = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_classhelper_stream_container_to_stream = R"doc()doc";
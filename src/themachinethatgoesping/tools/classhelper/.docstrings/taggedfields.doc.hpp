@@ -0,0 +1,211 @@
+//sourcehash: f3874ae7d1250c5d63885b9ee54b18dfb5480eaf6986cc2c77688739fb7655c7
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldHasher =
+R"doc(Feed the bytes TaggedFieldWriter would write into a BinaryHasher (used by
+hash_to))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldHasher_TaggedFieldHasher = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldHasher_finish = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldHasher_hasher = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldHasher_update_header = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldHasher_write_bytes = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldHasher_write_container = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldHasher_write_container_header =
+R"doc(Hash only the header of a container field, the caller feeds the payload
+into the hasher (e.g. stream::compressed_container_to_stream, which
+hashes while writing))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldHasher_write_value = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldSizer =
+R"doc(Count the bytes TaggedFieldWriter would write (used by binary_size))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldSizer_finish = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldSizer_size = R"doc(Number of bytes of the record)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldSizer_size_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldSizer_write_bytes = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldSizer_write_container = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldSizer_write_value = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldWriter =
+R"doc(Write a tagged field record to a stream
+
+Writes go through stream::StreamWriter (same buffering and osstream fast
+path as the stream functions). finish() writes the end of the record and
+must be called after the last field.
+
+TaggedFieldHasher and TaggedFieldSizer have the same interface, so a
+class can implement one template function that visits its fields and use
+it for to_stream, hash_to and binary_size.
+
+Template parameter ``T_ostream``:
+    static type of the output stream)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldWriter_TaggedFieldWriter = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldWriter_finish =
+R"doc(Terminate the record (must be called after the last field))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldWriter_write_bytes =
+R"doc(Write already serialized bytes (e.g. the to_binary result of a member
+object))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldWriter_write_container =
+R"doc(Write a contiguous container (payload: same layout as
+stream::container_to_stream))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldWriter_write_header = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldWriter_write_value =
+R"doc(Write a trivially copyable value (payload: sizeof(T) bytes))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFieldWriter_writer = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields =
+R"doc(Index of a tagged field record for lazy reading
+
+Reading a record only parses the field headers: payloads are not decoded
+until a field is requested, and fields that are unknown to the reader are
+skipped. from_cursor borrows the payloads from the cursor buffer (zero
+copy), from_stream copies the requested payloads.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_Field = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_Field_offset =
+R"doc(offset of the payload in the buffer)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_Field_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_Field_tag = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_TaggedFields = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_borrowed =
+R"doc(buffer of from_cursor (owned by the caller))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_buffer = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_fields = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_find = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_from_cursor =
+R"doc(Index a record written with TaggedFieldWriter (zero copy)
+
+The cursor is moved behind the record. The buffer of the cursor must
+outlive the returned object.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_from_stream =
+R"doc(Read a record written with TaggedFieldWriter from a stream
+
+Args:
+    tags: fields to read, other fields are skipped without copying them
+          (empty: read all fields))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_get = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_get_bytes =
+R"doc(Payload of a field (zero copy)
+
+Throws:
+    std::runtime_error if the field is missing)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_get_cursor =
+R"doc(Cursor over the payload of a field (e.g. to read a nested object with
+from_cursor))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_get_tags =
+R"doc(Tags of all indexed fields (in the order they were written))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_has = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_owning = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_read_container =
+R"doc(Read a container field into an owning container (single memcpy)
+
+Values that are not trivially copyable but written bytewise by
+write_container (e.g. Eigen::Quaternion) can not be borrowed, they are
+copied as stream::container_from_stream does.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_read_container_view =
+R"doc(Borrow a container field written with TaggedFieldWriter::write_container)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_read_value =
+R"doc(Read a value field written with TaggedFieldWriter::write_value
+
+Throws:
+    std::runtime_error if the field is missing or does not have
+    sizeof(T) bytes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_read_value_2 =
+R"doc(Read an optional value field (default_value if the field is missing,
+e.g. records written before the field was added))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_TaggedFields_storage = R"doc(payloads read by from_stream)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_detail_check_field_tag = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_end_of_fields_tag =
+R"doc(tag that terminates a tagged field record (not a valid field tag))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_field_header_size =
+R"doc(size of the header in front of each field payload (tag + payload size))doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -1,4 +1,4 @@
-//sourcehash: ab301263f731fdd32ab52737b5577958ad72ed34a194ce207b67565a2b8b9184
+//sourcehash: 50d09ae33a6a1dc2d44cabf4195811c2bd416f5f47e367ec682b5d430a013851
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -51,6 +51,97 @@ static const char *mkd_doc_XXHashSink_hash_state = R"doc()doc";
 
 static const char *mkd_doc_XXHashSink_write = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BinaryHasher =
+R"doc(Hashing visitor that feeds the binary representation of an object
+directly into a xxhash3 state
+
+The update functions mirror the stream functions
+(classhelper::write_version, stream::container_to_stream, ...). A
+hash_to(BinaryHasher&) implementation that visits the same bytes in the
+same order as to_stream produces the same hash as the stream based
+binary_hash, without serializing the object (binary_hash ==
+xxhash3(to_binary()) also holds for large containers).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BinaryHasher_digest = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BinaryHasher_state = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BinaryHasher_update = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BinaryHasher_update_container =
+R"doc(Same bytes as stream::container_to_stream (size followed by the data
+span))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BinaryHasher_update_value =
+R"doc(Hash the object representation of value (sizeof(T) bytes))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_BinaryHasher_update_version =
+R"doc(Same bytes as classhelper::write_version)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_HashCache =
+R"doc(Memoized binary_hash, must be invalidated whenever the hashed data
+changes
+
+Copies keep the cached hash (the copied data is identical). Concurrent
+reads of a valid cache are safe, invalidation must not run concurrently
+with reads.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_HashCache_HashCache = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_HashCache_HashCache_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_HashCache_get =
+R"doc(Return the cached hash or compute (and cache) it
+
+Args:
+    compute: callable that returns the hash)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_HashCache_hash = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_HashCache_invalidate = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_HashCache_is_valid = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_HashCache_operator_assign = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_HashCache_set =
+R"doc(Store a hash that was computed elsewhere (e.g. while serializing the
+object))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_HashCache_valid = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_binary_hash_of =
+R"doc(Compute the binary_hash of an object using hash_to (used by
+binary_hash)
+
+If the object provides a HashCache (get_binary_hash_cache), the hash is
+memoized.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_chunk_hashes =
+R"doc(xxhash3 of each hash_chunk_elements sized chunk of a container
+
+These hashes verify the chunks of the chunked payload. They are not
+part of binary_hash.
+
+Args:
+    mp_cores: Number of cores to use for parallelization)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_has_binary_hash_cache =
+R"doc(True if T_class provides a memoized hash (const HashCache&
+get_binary_hash_cache() const))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_has_hash_to =
+R"doc(True if T_class implements void hash_to(BinaryHasher&) const)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_hash_chunk_bytes =
+R"doc(containers larger than this are serialized (compressed encoding) in
+independently encoded and hashed chunks, see
+stream::chunked_container_to_stream)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_classhelper_hash_chunk_elements =
+R"doc(Number of elements per hash (and serialization) chunk for value type
+T_value)doc";
+
 #if defined(__GNUG__)
 #pragma GCC diagnostic pop
 #endif
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "batchloader.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+
+BatchLoader::BatchLoader(unsigned int io_threads)
+{
+    if (io_threads == 0)
+        io_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    _workers.reserve(io_threads);
+    for (unsigned int i = 0; i < io_threads; ++i)
+        _workers.emplace_back([this]() { worker_loop(); });
+}
+
+BatchLoader::~BatchLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _task_available.notify_all();
+
+    for (auto& worker : _workers)
+        worker.join();
+}
+
+void BatchLoader::worker_loop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _task_available.wait(lock, [this]() { return _stop || !_tasks.empty(); });
+
+            // finish pending requests before stopping
+            if (_tasks.empty())
+                return;
+
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+
+        // exceptions are stored in the future of the task
+        task();
+    }
+}
+
+void BatchLoader::enqueue(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.push_back(std::move(task));
+    }
+    _task_available.notify_one();
+}
+
+std::string BatchLoader::read_bytes(const std::filesystem::path& file_path,
+                                    size_t                       offset,
+                                    size_t                       size)
+{
+    std::ifstream ifs(file_path, std::ios::binary | std::ios::ate);
+    if (!ifs)
+        throw std::runtime_error(fmt::format(
+            "ERROR[BatchLoader::read_bytes]: could not open '{}'", file_path.string()));
+
+    const auto file_size = static_cast<size_t>(ifs.tellg());
+    if (size == to_end_of_file)
+        size = file_size > offset ? file_size - offset : 0;
+
+    if (offset > file_size || size > file_size - offset)
+        throw std::runtime_error(
+            fmt::format("ERROR[BatchLoader::read_bytes]: cannot read {} bytes at offset {} from "
+                        "'{}' ({} bytes)",
+                        size,
+                        offset,
+                        file_path.string(),
+                        file_size));
+
+    std::string buffer(size, '\0');
+    ifs.seekg(static_cast<std::streamoff>(offset));
+    ifs.read(buffer.data(), static_cast<std::streamsize>(size));
+    if (!ifs)
+        throw std::runtime_error(fmt::format(
+            "ERROR[BatchLoader::read_bytes]: could not read '{}'", file_path.string()));
+
+    return buffer;
+}
+
+std::future<std::string> BatchLoader::read_async(std::filesystem::path file_path,
+                                                 size_t                offset,
+                                                 size_t                size)
+{
+    auto task = std::make_shared<std::packaged_task<std::string()>>(
+        [file_path = std::move(file_path), offset, size]() {
+            return read_bytes(file_path, offset, size);
+        });
+
+    auto future = task->get_future();
+    enqueue([task]() { (*task)(); });
+    return future;
+}
+
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief Asynchronous batch loading of serialized objects (to_binary / from_binary) from files
+ *
+ * @authors Peter Urban
+ */
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/batchloader.doc.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+
+/**
+ * @brief Asynchronous loader for serialized objects (files or byte ranges of files written with
+ * to_binary)
+ *
+ * Requests are queued and processed by a pool of worker threads. Each worker reads the bytes of
+ * one request and directly deserializes them (from_binary), so reading and decoding of different
+ * objects overlap and many small reads are in flight at the same time. Results are returned as
+ * std::future or passed to a callback as soon as they are complete.
+ *
+ * Reads use plain positional file reads on the worker threads (portable, no io_uring).
+ * Pending requests are completed before the loader is destroyed.
+ */
+class BatchLoader
+{
+    std::vector<std::thread>          _workers;
+    std::deque<std::function<void()>> _tasks;
+    std::mutex                        _mutex;
+    std::condition_variable           _task_available;
+    bool                              _stop = false;
+
+    void worker_loop();
+    void enqueue(std::function<void()> task);
+
+  public:
+    /// read until the end of the file
+    static constexpr size_t to_end_of_file = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief Construct a new loader
+     *
+     * @param io_threads number of worker threads (number of concurrent reads / decodes), 0: use
+     * std::thread::hardware_concurrency()
+     */
+    explicit BatchLoader(unsigned int io_threads = 4);
+    ~BatchLoader();
+
+    BatchLoader(const BatchLoader&)            = delete;
+    BatchLoader& operator=(const BatchLoader&) = delete;
+
+    size_t get_io_threads() const { return _workers.size(); }
+
+    /**
+     * @brief Read size bytes at offset of a file (blocking, used by the workers)
+     *
+     * @param size number of bytes, to_end_of_file: read until the end of the file
+     * @throws std::runtime_error if the file cannot be opened or is too short
+     */
+    static std::string read_bytes(const std::filesystem::path& file_path,
+                                  size_t                       offset = 0,
+                                  size_t                       size   = to_end_of_file);
+
+    // ----- raw bytes -----
+    /**
+     * @brief Asynchronously read size bytes at offset of a file
+     */
+    std::future<std::string> read_async(std::filesystem::path file_path,
+                                        size_t                offset = 0,
+                                        size_t                size   = to_end_of_file);
+
+    // ----- objects -----
+    /**
+     * @brief Asynchronously read and deserialize an object (T_object::from_binary)
+     *
+     * @param file_path file that contains the to_binary buffer
+     * @param offset offset of the buffer in the file
+     * @param size size of the buffer, to_end_of_file: the rest of the file
+     * @return std::future<T_object> (rethrows read / deserialization errors on get())
+     */
+    template<typename T_object>
+    std::future<T_object> load_async(std::filesystem::path file_path,
+                                     size_t                offset = 0,
+                                     size_t                size   = to_end_of_file)
+    {
+        auto task = std::make_shared<std::packaged_task<T_object()>>(
+            [file_path = std::move(file_path), offset, size]() {
+                return T_object::from_binary(read_bytes(file_path, offset, size));
+            });
+
+        auto future = task->get_future();
+        enqueue([task]() { (*task)(); });
+        return future;
+    }
+
+    /**
+     * @brief Asynchronously load one object per file
+     *
+     * @return one future per file (same order as file_paths)
+     */
+    template<typename T_object>
+    std::vector<std::future<T_object>> load_async(
+        const std::vector<std::filesystem::path>& file_paths)
+    {
+        std::vector<std::future<T_object>> futures;
+        futures.reserve(file_paths.size());
+        for (const auto& file_path : file_paths)
+            futures.push_back(load_async<T_object>(file_path));
+
+        return futures;
+    }
+
+    /**
+     * @brief Load one object per file and pass each object to callback as soon as it is loaded
+     * (completion order, not file order)
+     *
+     * The callback is called from the worker threads, but never concurrently, so it does not
+     * need to be thread safe. The function returns when all files are processed.
+     *
+     * @param callback void(size_t index, T_object&& object), index into file_paths
+     * @throws the first read / deserialization / callback error (after all files are processed)
+     */
+    template<typename T_object, typename T_callback>
+    void load(const std::vector<std::filesystem::path>& file_paths, T_callback&& callback)
+    {
+        std::mutex                     callback_mutex;
+        std::exception_ptr             exception;
+        std::vector<std::future<void>> done;
+        done.reserve(file_paths.size());
+
+        for (size_t index = 0; index < file_paths.size(); ++index)
+        {
+            auto task = std::make_shared<std::packaged_task<void()>>([&, index]() {
+                try
+                {
+                    auto object = T_object::from_binary(read_bytes(file_paths[index]));
+
+                    std::lock_guard<std::mutex> lock(callback_mutex);
+                    if (!exception)
+                        callback(index, std::move(object));
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(callback_mutex);
+                    if (!exception)
+                        exception = std::current_exception();
+                }
+            });
+
+            done.push_back(task->get_future());
+            enqueue([task]() { (*task)(); });
+        }
+
+        for (auto& future : done)
+            future.wait();
+
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    /**
+     * @brief Load one object per file (blocking), reads and decoding run concurrently
+     *
+     * @return objects in the order of file_paths
+     */
+    template<typename T_object>
+    std::vector<T_object> load(const std::vector<std::filesystem::path>& file_paths)
+    {
+        auto futures = load_async<T_object>(file_paths);
+
+        // complete all requests before an error is rethrown (no loads keep running after the call)
+        for (auto& future : futures)
+            future.wait();
+
+        std::vector<T_object> objects;
+        objects.reserve(futures.size());
+        for (auto& future : futures)
+            objects.push_back(future.get());
+
+        return objects;
+    }
+};
+
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
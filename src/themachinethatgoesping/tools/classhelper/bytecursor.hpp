@@ -0,0 +1,381 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief Zero copy reading of binary buffers written with to_stream / to_binary
+ *
+ * @authors Peter Urban
+ */
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/bytecursor.doc.hpp"
+
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+
+/**
+ * @brief Borrowed (non owning) view of a container that was written with
+ * stream::container_to_stream
+ *
+ * The view points into the buffer that was passed to the ByteCursor, so the buffer (e.g. a
+ * memory mapped file) must outlive the view. The payload offsets of the stream format are not
+ * aligned, therefore element access uses memcpy loads. as_span() is only possible if the payload
+ * happens to be aligned. Use to_vector() / to<T_container>() (a single memcpy) when ownership is
+ * needed.
+ *
+ * @tparam T trivially copyable value type of the container
+ */
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+class ContainerView
+{
+    const char* _data = nullptr;
+    size_t      _size = 0;
+
+  public:
+    using value_type = T;
+
+    ContainerView() = default;
+    ContainerView(const char* data, size_t size)
+        : _data(data)
+        , _size(size)
+    {
+    }
+
+    size_t size() const { return _size; }
+    bool   empty() const { return _size == 0; }
+
+    /**
+     * @brief Raw bytes of the payload (points into the borrowed buffer)
+     */
+    std::string_view bytes() const { return std::string_view(_data, _size * sizeof(T)); }
+
+    /**
+     * @brief Element access (memcpy load, works for unaligned payloads)
+     */
+    T operator[](size_t index) const
+    {
+        T value;
+        std::memcpy(&value, _data + index * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    T at(size_t index) const
+    {
+        if (index >= _size)
+            throw std::out_of_range(fmt::format(
+                "ERROR[ContainerView::at]: index {} is out of range (size {})", index, _size));
+
+        return (*this)[index];
+    }
+
+    /**
+     * @brief True if the payload is aligned for T (required for as_span)
+     */
+    bool is_aligned() const
+    {
+        return reinterpret_cast<std::uintptr_t>(_data) % alignof(T) == 0;
+    }
+
+    /**
+     * @brief Zero copy span of the payload
+     *
+     * @return std::span<const T>
+     * @throws std::runtime_error if the payload is not aligned for T
+     */
+    std::span<const T> as_span() const
+    {
+        if (!is_aligned())
+            throw std::runtime_error(
+                fmt::format("ERROR[ContainerView::as_span]: payload is not aligned to {} bytes, "
+                            "use to_vector() instead",
+                            alignof(T)));
+
+        return std::span<const T>(reinterpret_cast<const T*>(_data), _size);
+    }
+
+    /**
+     * @brief Copy the payload into an owning container (single memcpy)
+     *
+     * @tparam T_container container with resize() and data() (e.g. std::vector<T>)
+     */
+    template<typename T_container = std::vector<T>>
+    T_container to() const
+    {
+        static_assert(sizeof(typename T_container::value_type) == sizeof(T),
+                      "ContainerView::to: value type size mismatch");
+
+        T_container container;
+        container.resize(_size);
+        if (_size > 0)
+            std::memcpy(static_cast<void*>(container.data()), _data, _size * sizeof(T));
+
+        return container;
+    }
+
+    std::vector<T> to_vector() const { return to<std::vector<T>>(); }
+};
+
+/**
+ * @brief Forward only read cursor over a binary buffer (e.g. the result of to_binary or a memory
+ * mapped file)
+ *
+ * The cursor reads the same layout as the stream functions (classhelper::read_version,
+ * stream::container_from_stream, ...) but without the std::istream overhead. Containers can be
+ * borrowed as ContainerView (zero copy) or copied with a single memcpy. Reading past the end of
+ * the buffer throws a std::runtime_error.
+ */
+class ByteCursor
+{
+    std::string_view _buffer;
+    size_t           _position = 0;
+
+    void check_remaining(size_t bytes, std::string_view function) const
+    {
+        if (bytes > remaining())
+            throw std::runtime_error(fmt::format(
+                "ERROR[ByteCursor::{}]: unexpected end of buffer (requested {} bytes at position "
+                "{}, buffer size {})",
+                function,
+                bytes,
+                _position,
+                _buffer.size()));
+    }
+
+  public:
+    /**
+     * @brief Construct a new cursor at the start of buffer
+     *
+     * @param buffer buffer to read (is not copied and must outlive the cursor and all views)
+     */
+    explicit ByteCursor(std::string_view buffer)
+        : _buffer(buffer)
+    {
+    }
+
+    // ----- position -----
+    size_t           position() const { return _position; }
+    size_t           remaining() const { return _buffer.size() - _position; }
+    bool             at_end() const { return _position == _buffer.size(); }
+    std::string_view buffer() const { return _buffer; }
+
+    /**
+     * @brief Throw if the buffer was not read completely
+     */
+    void check_at_end() const
+    {
+        if (!at_end())
+            throw std::runtime_error(fmt::format(
+                "ERROR[ByteCursor::check_at_end]: buffer was not read completely ({} of {} bytes "
+                "read)",
+                _position,
+                _buffer.size()));
+    }
+
+    void skip(size_t bytes)
+    {
+        check_remaining(bytes, "skip");
+        _position += bytes;
+    }
+
+    // ----- raw reads -----
+    /**
+     * @brief Borrow the next bytes of the buffer (zero copy)
+     */
+    std::string_view read_bytes(size_t bytes)
+    {
+        check_remaining(bytes, "read_bytes");
+        auto result = _buffer.substr(_position, bytes);
+        _position += bytes;
+        return result;
+    }
+
+    /**
+     * @brief Copy the next bytes to destination
+     */
+    void read(void* destination, size_t bytes)
+    {
+        check_remaining(bytes, "read");
+        if (bytes > 0)
+            std::memcpy(destination, _buffer.data() + _position, bytes);
+        _position += bytes;
+    }
+
+    /**
+     * @brief Read a trivially copyable value (same layout as is.read(&value, sizeof(value)))
+     */
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    T read()
+    {
+        T value;
+        read(&value, sizeof(T));
+        return value;
+    }
+
+    // ----- classhelper formats -----
+    /**
+     * @brief Same check as classhelper::read_version
+     *
+     * @param required_name expected class name/version string
+     * @param class_name used for the error message
+     */
+    void read_version(std::string_view required_name, std::string_view class_name)
+    {
+        auto name = _buffer.substr(_position, required_name.size());
+        _position += name.size();
+
+        if (name != required_name)
+            throw std::runtime_error(fmt::format(
+                "ERROR[{}::from_stream]: ClassName/Version mismatch: expected {}, got {}",
+                class_name,
+                required_name,
+                name));
+    }
+
+    /**
+     * @brief Same as classhelper::try_read_version
+     *
+     * @return true if the buffer continues with name (the name is then skipped)
+     */
+    bool try_read_version(std::string_view name, std::string_view class_name)
+    {
+        if (name.empty() || at_end() || _buffer[_position] != name[0])
+            return false;
+
+        read_version(name, class_name);
+        return true;
+    }
+
+    /**
+     * @brief Same as classhelper::read_any_version
+     *
+     * @return index of the name that was read
+     */
+    size_t read_any_version(std::initializer_list<std::string_view> names,
+                            std::string_view                        class_name)
+    {
+        const size_t name_size = names.size() > 0 ? names.begin()->size() : 0;
+        for (const auto& name : names)
+            if (name.size() != name_size)
+                throw std::invalid_argument(fmt::format(
+                    "ERROR[{}::from_stream]: version names must have the same length",
+                    class_name));
+
+        auto name = _buffer.substr(_position, name_size);
+        _position += name.size();
+
+        size_t index = 0;
+        for (const auto& required_name : names)
+        {
+            if (name == required_name)
+                return index;
+            ++index;
+        }
+
+        throw std::runtime_error(fmt::format(
+            "ERROR[{}::from_stream]: ClassName/Version mismatch: expected one of [{}], got {}",
+            class_name,
+            fmt::join(names, ", "),
+            name));
+    }
+
+    /**
+     * @brief Same as classhelper::try_read_any_version
+     *
+     * @return index of the name that was read, std::nullopt if nothing was read
+     */
+    std::optional<size_t> try_read_any_version(std::initializer_list<std::string_view> names,
+                                               std::string_view                        class_name)
+    {
+        if (names.size() == 0 || names.begin()->empty() || at_end() ||
+            _buffer[_position] != names.begin()->front())
+            return std::nullopt;
+
+        return read_any_version(names, class_name);
+    }
+
+    /**
+     * @brief Borrow a container written with stream::container_to_stream (zero copy)
+     *
+     * @tparam T value type of the container
+     * @return ContainerView<T> view into the buffer
+     */
+    template<typename T>
+    ContainerView<T> read_container_view()
+    {
+        const auto size = read<size_t>();
+        if (size > remaining() / sizeof(T))
+            throw std::runtime_error(
+                fmt::format("ERROR[ByteCursor::read_container_view]: container size {} exceeds "
+                            "the remaining buffer ({} bytes)",
+                            size,
+                            remaining()));
+
+        ContainerView<T> view(_buffer.data() + _position, size);
+        _position += size * sizeof(T);
+        return view;
+    }
+
+    /**
+     * @brief Read a container written with stream::container_to_stream into an owning container
+     * (single memcpy, same result as stream::container_from_stream)
+     *
+     * @tparam T_container container with resize() and data() (e.g. std::vector<T>)
+     */
+    template<typename T_container>
+    T_container read_container()
+    {
+        return read_container_view<typename T_container::value_type>()
+            .template to<T_container>();
+    }
+};
+
+/**
+ * @brief True if T_class implements static T_class from_cursor(ByteCursor&)
+ */
+template<typename T_class>
+concept has_from_cursor = requires(ByteCursor& cursor) {
+    { T_class::from_cursor(cursor) } -> std::same_as<T_class>;
+};
+
+/**
+ * @brief Read an object from a buffer using T_class::from_cursor (used by from_binary)
+ *
+ * @param buffer buffer written with to_binary
+ * @param check_buffer_is_read_completely throw if the buffer contains trailing bytes
+ */
+template<typename T_class>
+T_class from_binary_cursor(std::string_view buffer, bool check_buffer_is_read_completely)
+{
+    ByteCursor cursor(buffer);
+    T_class    obj = T_class::from_cursor(cursor);
+
+    if (check_buffer_is_read_completely)
+        cursor.check_at_end();
+
+    return obj;
+}
+
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
@@ -4,6 +4,7 @@
 
 #include <stdexcept>
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 namespace themachinethatgoesping::tools::classhelper {
 
@@ -26,9 +27,58 @@ void read_version(std::istream&   is,
     }
 }
 
+size_t read_any_version(std::istream&                           is,
+                        std::initializer_list<std::string_view> names,
+                        std::string_view                        class_name)
+{
+    const size_t name_size = names.size() > 0 ? names.begin()->size() : 0;
+    for (const auto& name : names)
+        if (name.size() != name_size)
+            throw std::invalid_argument(fmt::format(
+                "ERROR[{}::from_stream]: version names must have the same length", class_name));
+
+    std::string name(name_size, '\0');
+    is.read(name.data(), static_cast<std::streamsize>(name_size));
+
+    size_t index = 0;
+    for (const auto& required_name : names)
+    {
+        if (name == required_name)
+            return index;
+        ++index;
+    }
+
+    throw std::runtime_error(
+        fmt::format("ERROR[{}::from_stream]: ClassName/Version mismatch: expected one of [{}], "
+                    "got {}",
+                    class_name,
+                    fmt::join(names, ", "),
+                    name));
+}
+
 void write_version(std::ostream& os, std::string_view name)
 {
     os.write(name.data(), static_cast<std::streamsize>(name.size()));
 }
 
-} // namespace themachinethatgoesping::tools::classhelper
\ No newline at end of file
+bool try_read_version(std::istream& is, std::string_view name, std::string_view class_name)
+{
+    if (name.empty() || is.peek() != std::istream::traits_type::to_int_type(name[0]))
+        return false;
+
+    read_version(is, name, class_name);
+    return true;
+}
+
+std::optional<size_t> try_read_any_version(std::istream&                           is,
+                                           std::initializer_list<std::string_view> names,
+                                           std::string_view                        class_name)
+{
+    if (names.size() == 0 || names.begin()->empty() ||
+        is.peek() != std::istream::traits_type::to_int_type(names.begin()->front()))
+        return std::nullopt;
+
+    return read_any_version(is, names, class_name);
+}
+
+} // namespace themachinethatgoesping::tools::classhelper
@@ -7,9 +7,14 @@
 /* generated doc strings */
 #include ".docstrings/classversion.doc.hpp"
 
+#include <concepts>
+#include <initializer_list>
+#include <optional>
 #include <string_view>
 #include <iostream>
 
+#include "../helper/osstream.hpp"
+
 namespace themachinethatgoesping::tools::classhelper {
 
 void read_version(std::istream&   is,
@@ -18,4 +23,55 @@ void read_version(std::istream&   is,
 
 void write_version(std::ostream& os, std::string_view name);
 
+/**
+ * @brief Same as write_version(std::ostream&, ...), but helper::osstream and helper::ospanstream
+ * are written without going through the std::streambuf interface
+ */
+template<typename T_ostream>
+    requires std::derived_from<T_ostream, std::ostream>
+void write_version(T_ostream& os, std::string_view name)
+{
+    if constexpr (helper::has_write_direct<T_ostream>)
+        os.write_direct(name.data(), name.size());
+    else
+        write_version(static_cast<std::ostream&>(os), name);
+}
+
+/**
+ * @brief Read the version name only if the stream starts with it (used to negotiate optional
+ * encodings, e.g. compressed streams, for layouts that may not start with this name)
+ *
+ * The first character of name must not be a possible first byte of the alternative layout.
+ *
+ * @return true if the version name was read
+ */
+bool try_read_version(std::istream&    is,
+                      std::string_view name,
+                      std::string_view class_name);
+
+/**
+ * @brief Read a version name that must be one of several supported versions (e.g. the current
+ * layout and older layouts that are still readable)
+ *
+ * All names must have the same length.
+ *
+ * @return index of the name that was read
+ */
+size_t read_any_version(std::istream&                           is,
+                        std::initializer_list<std::string_view> names,
+                        std::string_view                        class_name);
+
+/**
+ * @brief Same as read_any_version, but only if the stream starts with the first character of the
+ * names (used to detect layouts that were written without a version header)
+ *
+ * All names must start with the same character, which must not be a possible first byte of the
+ * layout without a version header.
+ *
+ * @return index of the name that was read, std::nullopt if nothing was read
+ */
+std::optional<size_t> try_read_any_version(std::istream&                           is,
+                                           std::initializer_list<std::string_view> names,
+                                           std::string_view                        class_name);
+
 } // namespace themachinethatgoesping::tools::classhelper
\ No newline at end of file
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "compression.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+namespace compression {
+
+namespace {
+/// runs shorter than this are stored as literals
+constexpr size_t min_run = 3;
+/// control byte < 128: literal block of (control + 1) bytes
+constexpr size_t max_literal = 128;
+/// control byte >= 128: run of (control - 128 + min_run) equal bytes
+constexpr size_t max_run = 127 + min_run;
+static_assert(max_run / 2 == max_decode_ratio, "max_decode_ratio must match the run encoding");
+
+size_t run_length(const uint8_t* data, size_t size, size_t pos)
+{
+    const size_t end = std::min(size, pos + max_run);
+    size_t       run = 1;
+    while (pos + run < end && data[pos + run] == data[pos])
+        ++run;
+    return run;
+}
+
+void rle_encode(const uint8_t* data, size_t size, std::string& out)
+{
+    size_t pos = 0;
+    while (pos < size)
+    {
+        const size_t run = run_length(data, size, pos);
+        if (run >= min_run)
+        {
+            out.push_back(static_cast<char>(128 + run - min_run));
+            out.push_back(static_cast<char>(data[pos]));
+            pos += run;
+            continue;
+        }
+
+        // literal block: until the next run or max_literal bytes
+        size_t literal = run;
+        while (pos + literal < size && literal < max_literal &&
+               run_length(data, size, pos + literal) < min_run)
+            ++literal;
+        literal = std::min(literal, max_literal);
+
+        out.push_back(static_cast<char>(literal - 1));
+        out.append(reinterpret_cast<const char*>(data + pos), literal);
+        pos += literal;
+    }
+}
+
+void rle_decode(std::string_view encoded, uint8_t* data, size_t size)
+{
+    size_t in  = 0;
+    size_t out = 0;
+    while (in < encoded.size())
+    {
+        const auto control = static_cast<uint8_t>(encoded[in++]);
+        if (control >= 128)
+        {
+            const size_t run = control - 128 + min_run;
+            if (in >= encoded.size() || out + run > size)
+                break;
+
+            std::memset(data + out, static_cast<uint8_t>(encoded[in++]), run);
+            out += run;
+        }
+        else
+        {
+            const size_t literal = size_t(control) + 1;
+            if (in + literal > encoded.size() || out + literal > size)
+                break;
+
+            std::memcpy(data + out, encoded.data() + in, literal);
+            in += literal;
+            out += literal;
+        }
+    }
+
+    if (in != encoded.size() || out != size)
+        throw std::runtime_error(
+            fmt::format("ERROR[compression::decode]: corrupt data (decoded {} of {} bytes)",
+                        out,
+                        size));
+}
+} // namespace
+
+std::string encode(const void* data, size_t element_count, size_t element_size)
+{
+    const auto*  bytes      = static_cast<const uint8_t*>(data);
+    const size_t total_size = element_count * element_size;
+
+    // xor delta + shuffle: plane b holds byte b of all (xor'ed) elements
+    std::vector<uint8_t> planes(total_size);
+    for (size_t i = 0; i < element_count; ++i)
+    {
+        const uint8_t* element  = bytes + i * element_size;
+        const uint8_t* previous = i > 0 ? element - element_size : nullptr;
+        for (size_t b = 0; b < element_size; ++b)
+            planes[b * element_count + i] = previous ? element[b] ^ previous[b] : element[b];
+    }
+
+    std::string encoded;
+    encoded.reserve(total_size / 4 + 16);
+    rle_encode(planes.data(), planes.size(), encoded);
+    return encoded;
+}
+
+void decode(std::string_view encoded, void* data, size_t element_count, size_t element_size)
+{
+    auto*        bytes      = static_cast<uint8_t*>(data);
+    const size_t total_size = element_count * element_size;
+
+    std::vector<uint8_t> planes(total_size);
+    rle_decode(encoded, planes.data(), planes.size());
+
+    // unshuffle + undo the xor delta
+    for (size_t i = 0; i < element_count; ++i)
+    {
+        uint8_t*       element  = bytes + i * element_size;
+        const uint8_t* previous = i > 0 ? element - element_size : nullptr;
+        for (size_t b = 0; b < element_size; ++b)
+            element[b] = previous ? planes[b * element_count + i] ^ previous[b]
+                                  : planes[b * element_count + i];
+    }
+}
+
+} // namespace compression
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
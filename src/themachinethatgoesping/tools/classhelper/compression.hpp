@@ -0,0 +1,411 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief Optional compressed encoding for large container payloads (to_stream / to_binary)
+ *
+ * @authors Peter Urban
+ */
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/compression.doc.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "bytecursor.hpp"
+#include "option.hpp"
+#include "stream.hpp"
+#include "xxhashhelper.hpp"
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+
+/**
+ * @brief Binary encoding used by to_stream / to_binary of classes that support compression
+ */
+enum class t_binary_encoding : uint8_t
+{
+    raw        = 0, ///< containers are written as size + raw element bytes (default)
+    compressed = 1  ///< containers are written with compression::encode
+};
+
+using o_binary_encoding = Option<t_binary_encoding>;
+
+namespace compression {
+
+/**
+ * @brief Codec of a compressed container payload (stored in front of the payload)
+ */
+enum class t_codec : uint8_t
+{
+    raw             = 0, ///< uncompressed element bytes (used if compression does not pay off)
+    xor_shuffle_rle = 1, ///< xor delta + byte shuffle + run length encoding
+    chunked         = 2  ///< independently encoded and hashed chunks (large containers)
+};
+
+/**
+ * @brief Compress an array of trivially copyable elements
+ *
+ * Consecutive elements are xor'ed (slowly varying or sorted values share their high bytes), the
+ * bytes are shuffled into planes (byte 0 of all elements, byte 1 of all elements, ...) and the
+ * planes are run length encoded. Timestamps and slowly varying sensor values produce long zero
+ * runs in the upper planes.
+ *
+ * @param data pointer to the first element
+ * @param element_count number of elements
+ * @param element_size size of one element in bytes
+ * @return std::string encoded bytes
+ */
+std::string encode(const void* data, size_t element_count, size_t element_size);
+
+/**
+ * @brief Decompress data written with encode
+ *
+ * @param encoded encoded bytes
+ * @param data output buffer (element_count * element_size bytes)
+ * @param element_count number of elements
+ * @param element_size size of one element in bytes
+ */
+void decode(std::string_view encoded, void* data, size_t element_count, size_t element_size);
+
+/**
+ * @brief Maximum number of decoded bytes per encoded byte (longest run in 2 bytes)
+ *
+ * Readers use this to reject corrupt sizes before allocating the decoded container.
+ */
+inline constexpr size_t max_decode_ratio = 65;
+
+} // namespace compression
+
+namespace stream {
+
+/**
+ * @brief Write a large container with the chunked codec (used by compressed_container_to_stream)
+ *
+ * The container is split into chunks of hash_chunk_elements values that are hashed and encoded
+ * independently (in parallel). Layout: [size_t size][uint8_t codec][size_t encoded_size]
+ * [size_t chunk_elements][size_t n_chunks], n_chunks x [uint64_t hash][uint8_t codec]
+ * [size_t chunk_encoded_size], followed by the encoded chunks.
+ *
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::vector<uint64_t> chunk hashes (same as classhelper::chunk_hashes)
+ */
+template<typename T_container, typename T_ostream>
+inline std::vector<uint64_t> chunked_container_to_stream(T_ostream&         os,
+                                                         const T_container& container,
+                                                         int                mp_cores = 1)
+{
+    using T_value = typename T_container::value_type;
+
+    const size_t size           = container.size();
+    const size_t chunk_elements = hash_chunk_elements<T_value>();
+    const size_t n_chunks       = (size + chunk_elements - 1) / chunk_elements;
+
+    std::vector<uint64_t>             hashes(n_chunks);
+    std::vector<compression::t_codec> codecs(n_chunks, compression::t_codec::xor_shuffle_rle);
+    std::vector<size_t>               chunk_sizes(n_chunks);
+    std::vector<std::string>          encoded(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1)
+    for (int64_t i = 0; i < int64_t(n_chunks); ++i)
+    {
+        const T_value* chunk      = container.data() + size_t(i) * chunk_elements;
+        const size_t   chunk_size = std::min(chunk_elements, size - size_t(i) * chunk_elements);
+        const size_t   raw_bytes  = chunk_size * sizeof(T_value);
+
+        hashes[i]  = xxh::xxhash3<64>(chunk, raw_bytes);
+        encoded[i] = compression::encode(chunk, chunk_size, sizeof(T_value));
+
+        // incompressible chunks are written directly from the container
+        if (encoded[i].size() >= raw_bytes)
+        {
+            encoded[i].clear();
+            codecs[i] = compression::t_codec::raw;
+        }
+        chunk_sizes[i] = codecs[i] == compression::t_codec::raw ? raw_bytes : encoded[i].size();
+    }
+
+    constexpr size_t table_entry_size =
+        sizeof(uint64_t) + sizeof(compression::t_codec) + sizeof(size_t);
+    size_t encoded_size = 2 * sizeof(size_t) + n_chunks * table_entry_size;
+    for (auto chunk_size : chunk_sizes)
+        encoded_size += chunk_size;
+
+    const auto              codec = compression::t_codec::chunked;
+    StreamWriter<T_ostream> writer(os);
+    writer.write_value(size);
+    writer.write_value(codec);
+    writer.write_value(encoded_size);
+    writer.write_value(chunk_elements);
+    writer.write_value(n_chunks);
+    for (size_t i = 0; i < n_chunks; ++i)
+    {
+        writer.write_value(hashes[i]);
+        writer.write_value(codecs[i]);
+        writer.write_value(chunk_sizes[i]);
+    }
+    for (size_t i = 0; i < n_chunks; ++i)
+    {
+        const T_value* chunk = container.data() + i * chunk_elements;
+        const char*    data  = codecs[i] == compression::t_codec::raw
+                                   ? reinterpret_cast<const char*>(chunk)
+                                   : encoded[i].data();
+        writer.write(data, chunk_sizes[i]);
+    }
+
+    return hashes;
+}
+
+/**
+ * @brief Write a container with the compressed layout
+ *
+ * Layout: [size_t size][uint8_t codec][size_t encoded_size][encoded bytes]. The raw codec is
+ * stored if compression does not make the payload smaller. Containers larger than
+ * hash_chunk_bytes are written with the chunked codec (see chunked_container_to_stream). The
+ * elements are written as raw bytes (same requirements as container_to_stream).
+ *
+ * @param mp_cores Number of cores to use for parallelization (chunked codec)
+ * @param hasher if set, the container is fed into this hasher (BinaryHasher::update_container,
+ * the hash of the raw layout, not of the compressed bytes)
+ */
+template<typename T_container, typename T_ostream>
+inline void compressed_container_to_stream(T_ostream&         os,
+                                           const T_container& container,
+                                           int                mp_cores = 1,
+                                           BinaryHasher*      hasher   = nullptr)
+{
+    using T_value = typename T_container::value_type;
+
+    const size_t size      = container.size();
+    const size_t raw_bytes = size * sizeof(T_value);
+
+    if (hasher)
+        hasher->update_container(container);
+
+    if (raw_bytes > hash_chunk_bytes)
+    {
+        chunked_container_to_stream(os, container, mp_cores);
+        return;
+    }
+
+    std::string encoded = compression::encode(container.data(), size, sizeof(T_value));
+    auto        codec   = compression::t_codec::xor_shuffle_rle;
+    if (encoded.size() >= raw_bytes)
+    {
+        encoded.assign(reinterpret_cast<const char*>(container.data()), raw_bytes);
+        codec = compression::t_codec::raw;
+    }
+
+    const size_t            encoded_size = encoded.size();
+    StreamWriter<T_ostream> writer(os);
+    writer.write_value(size);
+    writer.write_value(codec);
+    writer.write_value(encoded_size);
+    writer.write(encoded.data(), encoded_size);
+}
+
+/**
+ * @brief Decode a single (not chunked) payload into data
+ */
+template<typename T_value>
+inline void decode_payload(compression::t_codec codec,
+                           std::string_view     encoded,
+                           T_value*             data,
+                           size_t               size)
+{
+    switch (codec)
+    {
+        case compression::t_codec::raw:
+            if (encoded.size() != size * sizeof(T_value))
+                throw std::runtime_error(
+                    fmt::format("ERROR[compressed_container_from_stream]: raw payload has {} "
+                                "bytes, expected {}",
+                                encoded.size(),
+                                size * sizeof(T_value)));
+            std::memcpy(static_cast<void*>(data), encoded.data(), encoded.size());
+            break;
+        case compression::t_codec::xor_shuffle_rle:
+            compression::decode(encoded, data, size, sizeof(T_value));
+            break;
+        default:
+            throw std::runtime_error(
+                fmt::format("ERROR[compressed_container_from_stream]: unknown codec {}",
+                            static_cast<int>(codec)));
+    }
+}
+
+/**
+ * @brief Decode a chunked payload (see chunked_container_to_stream) into data
+ *
+ * The chunks are decoded and their hashes are verified in parallel.
+ *
+ * @param mp_cores Number of cores to use for parallelization
+ */
+template<typename T_value>
+inline void decode_chunked_payload(std::string_view encoded,
+                                   T_value*         data,
+                                   size_t           size,
+                                   int              mp_cores = 1)
+{
+    ByteCursor   cursor(encoded);
+    const auto   chunk_elements = cursor.read<size_t>();
+    const auto   n_chunks       = cursor.read<size_t>();
+    // (size + chunk_elements - 1) could overflow for a corrupt chunk_elements
+    const size_t expected_chunks =
+        chunk_elements > 0 ? size / chunk_elements + (size % chunk_elements != 0) : 0;
+    if (n_chunks != expected_chunks || (size > 0 && chunk_elements == 0))
+        throw std::runtime_error(
+            fmt::format("ERROR[compressed_container_from_stream]: invalid chunk table ({} chunks "
+                        "of {} elements for {} elements)",
+                        n_chunks,
+                        chunk_elements,
+                        size));
+
+    std::vector<uint64_t>             hashes(n_chunks);
+    std::vector<compression::t_codec> codecs(n_chunks);
+    std::vector<std::string_view>     chunks(n_chunks);
+    std::vector<size_t>               chunk_sizes(n_chunks);
+    for (size_t i = 0; i < n_chunks; ++i)
+    {
+        hashes[i]      = cursor.read<uint64_t>();
+        codecs[i]      = cursor.read<compression::t_codec>();
+        chunk_sizes[i] = cursor.read<size_t>();
+    }
+    for (size_t i = 0; i < n_chunks; ++i)
+        chunks[i] = cursor.read_bytes(chunk_sizes[i]);
+    cursor.check_at_end();
+
+    std::exception_ptr exception;
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1)
+    for (int64_t i = 0; i < int64_t(n_chunks); ++i)
+    {
+        try
+        {
+            T_value*     chunk      = data + size_t(i) * chunk_elements;
+            const size_t chunk_size = std::min(chunk_elements, size - size_t(i) * chunk_elements);
+
+            decode_payload(codecs[i], chunks[i], chunk, chunk_size);
+            if (xxh::xxhash3<64>(chunk, chunk_size * sizeof(T_value)) != hashes[i])
+                throw std::runtime_error(fmt::format(
+                    "ERROR[compressed_container_from_stream]: hash mismatch in chunk {}", i));
+        }
+        catch (...)
+        {
+#pragma omp critical
+            exception = std::current_exception();
+        }
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+/**
+ * @brief Decode the payload of compressed_container_to_stream (used by the stream and cursor
+ * readers)
+ */
+template<typename T_container>
+inline T_container compressed_container_from_payload(size_t               size,
+                                                     compression::t_codec codec,
+                                                     std::string_view     encoded,
+                                                     int                  mp_cores = 1)
+{
+    using T_value = typename T_container::value_type;
+
+    // reject sizes that the payload can not decode to before allocating (corrupt input)
+    if (size > encoded.size() * compression::max_decode_ratio / sizeof(T_value))
+        throw std::runtime_error(
+            fmt::format("ERROR[compressed_container_from_stream]: {} elements can not be decoded "
+                        "from {} bytes (corrupt size)",
+                        size,
+                        encoded.size()));
+
+    T_container container;
+    container.resize(size);
+
+    if (codec == compression::t_codec::chunked)
+        decode_chunked_payload(encoded, container.data(), size, mp_cores);
+    else
+        decode_payload(codec, encoded, container.data(), size);
+
+    return container;
+}
+
+/**
+ * @brief Read a container written with compressed_container_to_stream
+ *
+ * @param mp_cores Number of cores to use for parallelization (chunked codec)
+ */
+template<typename T_container, typename T_istream>
+inline T_container compressed_container_from_stream(T_istream& is, int mp_cores = 1)
+{
+    size_t               size         = 0;
+    size_t               encoded_size = 0;
+    compression::t_codec codec        = compression::t_codec::raw;
+
+    is.read(reinterpret_cast<char*>(&size), sizeof(size));
+    is.read(reinterpret_cast<char*>(&codec), sizeof(codec));
+    is.read(reinterpret_cast<char*>(&encoded_size), sizeof(encoded_size));
+
+    if (!is)
+        throw std::runtime_error(
+            "ERROR[compressed_container_from_stream]: unexpected end of stream");
+
+    // read in blocks, so a corrupt encoded_size fails at the end of the stream instead of
+    // allocating encoded_size bytes up front
+    constexpr size_t block_size = size_t(16) * 1024 * 1024;
+    std::string      encoded;
+    while (encoded.size() < encoded_size)
+    {
+        const size_t offset = encoded.size();
+        const size_t bytes  = std::min(block_size, encoded_size - offset);
+        encoded.resize(offset + bytes);
+        is.read(encoded.data() + offset, static_cast<std::streamsize>(bytes));
+        if (!is)
+            throw std::runtime_error(fmt::format(
+                "ERROR[compressed_container_from_stream]: unexpected end of stream ({} of {} "
+                "encoded bytes)",
+                offset + size_t(is.gcount()),
+                encoded_size));
+    }
+
+    return compressed_container_from_payload<T_container>(size, codec, encoded, mp_cores);
+}
+
+/**
+ * @brief Read a container written with compressed_container_to_stream from a ByteCursor
+ *
+ * @param mp_cores Number of cores to use for parallelization (chunked codec)
+ */
+template<typename T_container>
+inline T_container compressed_container_from_cursor(ByteCursor& cursor, int mp_cores = 1)
+{
+    const auto size         = cursor.read<size_t>();
+    const auto codec        = cursor.read<compression::t_codec>();
+    const auto encoded_size = cursor.read<size_t>();
+
+    return compressed_container_from_payload<T_container>(
+        size, codec, cursor.read_bytes(encoded_size), mp_cores);
+}
+
+} // namespace stream
+
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
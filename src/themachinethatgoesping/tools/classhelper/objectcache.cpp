@@ -0,0 +1,331 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "objectcache.hpp"
+
+#include <cstring>
+#include <unordered_set>
+
+#include "xxhashhelper.hpp"
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+
+/*
+ * Spill file layout: the ObjectStore holds two kinds of records
+ *   content hash       -> to_binary buffer
+ *   key_record_id(key) -> content hash (8 bytes)
+ * so buffers are stored once even if several keys map to them. Key records are stored under a
+ * hash of the key, because a key can be equal to a content hash (e.g. put(obj.binary_hash(), obj)).
+ */
+
+namespace {
+uint64_t key_record_id(uint64_t key)
+{
+    BinaryHasher hasher;
+    hasher.update_version("ObjectCache_key");
+    hasher.update_value(key);
+    return hasher.digest();
+}
+} // namespace
+
+ObjectCache::ObjectCache(size_t max_memory_bytes, std::optional<std::filesystem::path> spill_file)
+    : _max_memory_bytes(max_memory_bytes)
+{
+    if (spill_file)
+    {
+        _spill_store.emplace(std::move(*spill_file));
+
+        // the cache is the only writer of the spill file (see class description)
+        _spill_store->repair();
+    }
+}
+
+ObjectCache::t_buffer ObjectCache::find_in_memory(uint64_t key)
+{
+    if (auto key_it = _keys.find(key); key_it != _keys.end())
+    {
+        auto& entry = _entries.at(key_it->second);
+        _lru.splice(_lru.begin(), _lru, entry.lru_position);
+
+        ++_statistics.hits;
+        return entry.buffer;
+    }
+
+    // evicted, but not yet written to the spill file
+    if (auto spill_it = _spilling.find(key); spill_it != _spilling.end())
+    {
+        auto [content_hash, buffer] = spill_it->second;
+        insert_buffer(key, content_hash, buffer);
+
+        ++_statistics.hits;
+        return buffer;
+    }
+
+    return nullptr;
+}
+
+ObjectCache::t_buffer ObjectCache::find_buffer(uint64_t key)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (auto buffer = find_in_memory(key))
+            return buffer;
+    }
+
+    auto buffer = load_from_spill_file(key);
+    if (buffer)
+        write_spill_queue();
+
+    return buffer;
+}
+
+ObjectCache::t_buffer ObjectCache::load_from_spill_file(uint64_t key)
+{
+    if (!_spill_store)
+        return nullptr;
+
+    uint64_t content_hash;
+    t_buffer buffer;
+    {
+        std::lock_guard<std::mutex> lock(_spill_mutex);
+
+        const uint64_t record_id = key_record_id(key);
+        if (!_spill_store->contains(record_id))
+            return nullptr;
+
+        // key record -> content record
+        const auto key_record = _spill_store->get_buffer(record_id);
+        if (key_record.size() != sizeof(content_hash))
+            throw std::runtime_error(fmt::format(
+                "ERROR[ObjectCache]: corrupt key record for key {} in the spill file", key));
+        std::memcpy(&content_hash, key_record.data(), sizeof(content_hash));
+
+        buffer = std::make_shared<const std::string>(_spill_store->get_buffer(content_hash));
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    insert_buffer(key, content_hash, buffer);
+
+    ++_statistics.hits;
+    ++_statistics.disk_hits;
+    return buffer;
+}
+
+void ObjectCache::insert_buffer(uint64_t key, uint64_t content_hash, t_buffer buffer)
+{
+    // replace the mapping of an existing key
+    if (auto key_it = _keys.find(key); key_it != _keys.end())
+    {
+        if (key_it->second == content_hash)
+            return;
+
+        // drop the old buffer if no other key refers to it
+        auto old_it = _entries.find(key_it->second);
+        std::erase(old_it->second.keys, key);
+        if (old_it->second.keys.empty())
+        {
+            _memory_bytes -= old_it->second.buffer->size();
+            _lru.erase(old_it->second.lru_position);
+            _entries.erase(old_it);
+        }
+        _keys.erase(key_it);
+    }
+
+    auto [entry_it, inserted] = _entries.try_emplace(content_hash);
+    auto& entry               = entry_it->second;
+    if (inserted)
+    {
+        _memory_bytes += buffer->size();
+        entry.buffer = std::move(buffer);
+        _lru.push_front(content_hash);
+        entry.lru_position = _lru.begin();
+    }
+    else
+        _lru.splice(_lru.begin(), _lru, entry.lru_position);
+
+    entry.keys.push_back(key);
+    _keys[key] = content_hash;
+
+    evict();
+}
+
+void ObjectCache::evict()
+{
+    while (_memory_bytes > _max_memory_bytes && !_lru.empty())
+    {
+        const uint64_t content_hash = _lru.back();
+        auto           entry_it     = _entries.find(content_hash);
+        auto&          entry        = entry_it->second;
+
+        // the buffer is written by write_spill_queue (after the lock is released), until then
+        // it is still served from _spilling
+        if (_spill_store)
+        {
+            for (auto key : entry.keys)
+                _spilling[key] = { content_hash, entry.buffer };
+            _spill_queue.push_back(SpillJob{ content_hash, entry.buffer, entry.keys });
+        }
+
+        for (auto key : entry.keys)
+            _keys.erase(key);
+        _memory_bytes -= entry.buffer->size();
+        _entries.erase(entry_it);
+        _lru.pop_back();
+
+        ++_statistics.evictions;
+    }
+}
+
+void ObjectCache::write_spill_queue()
+{
+    std::vector<SpillJob> jobs;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        jobs.swap(_spill_queue);
+    }
+
+    if (jobs.empty())
+        return;
+
+    auto release_jobs = [&]() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& job : jobs)
+            for (auto key : job.keys)
+                // the key may have been evicted again (with a different buffer) in the meantime
+                if (auto it = _spilling.find(key);
+                    it != _spilling.end() && it->second.second == job.buffer)
+                    _spilling.erase(it);
+    };
+
+    try
+    {
+        write_to_spill_file(jobs);
+    }
+    catch (...)
+    {
+        release_jobs();
+        throw;
+    }
+    release_jobs();
+}
+
+void ObjectCache::write_to_spill_file(const std::vector<SpillJob>& jobs)
+{
+    // key records: the content hash of each key (the views below point into this vector)
+    size_t number_of_keys = 0;
+    for (const auto& job : jobs)
+        number_of_keys += job.keys.size();
+
+    std::vector<uint64_t> key_record_values;
+    key_record_values.reserve(number_of_keys);
+
+    std::vector<std::pair<uint64_t, std::string_view>> records;
+    records.reserve(jobs.size() + number_of_keys);
+    for (const auto& job : jobs)
+    {
+        records.emplace_back(job.content_hash, *job.buffer);
+        for (auto key : job.keys)
+        {
+            key_record_values.push_back(job.content_hash);
+            records.emplace_back(
+                key_record_id(key),
+                std::string_view(reinterpret_cast<const char*>(&key_record_values.back()),
+                                 sizeof(uint64_t)));
+        }
+    }
+
+    size_t spills = 0;
+    {
+        std::lock_guard<std::mutex> lock(_spill_mutex);
+
+        std::unordered_set<uint64_t> new_buffers;
+        for (const auto& job : jobs)
+            if (!_spill_store->contains(job.content_hash))
+                new_buffers.insert(job.content_hash);
+        spills = new_buffers.size();
+
+        _spill_store->add_buffers(records);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _statistics.spills += spills;
+}
+
+bool ObjectCache::contains(uint64_t key) const
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_keys.contains(key) || _spilling.contains(key))
+            return true;
+    }
+
+    if (!_spill_store)
+        return false;
+
+    std::lock_guard<std::mutex> lock(_spill_mutex);
+    return _spill_store->contains(key_record_id(key));
+}
+
+void ObjectCache::flush()
+{
+    write_spill_queue();
+
+    if (!_spill_store)
+        return;
+
+    std::vector<SpillJob> jobs;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        jobs.reserve(_entries.size());
+        for (const auto& [content_hash, entry] : _entries)
+            jobs.push_back(SpillJob{ content_hash, entry.buffer, entry.keys });
+    }
+
+    write_to_spill_file(jobs);
+}
+
+void ObjectCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _keys.clear();
+    _entries.clear();
+    _lru.clear();
+    _memory_bytes = 0;
+}
+
+ObjectCache::Statistics ObjectCache::get_statistics() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _statistics;
+}
+
+void ObjectCache::reset_statistics()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _statistics = Statistics();
+}
+
+size_t ObjectCache::size() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _keys.size();
+}
+
+size_t ObjectCache::get_number_of_buffers() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
+size_t ObjectCache::get_memory_bytes() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memory_bytes;
+}
+
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
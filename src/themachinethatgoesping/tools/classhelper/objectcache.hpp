@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief Content addressed, thread safe LRU cache for objects that implement to_binary /
+ * from_binary / binary_hash
+ *
+ * @authors Peter Urban
+ */
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/objectcache.doc.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "objectstore.hpp"
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+
+/**
+ * @brief Thread safe cache for computed objects, keyed by a hash of the inputs of the computation
+ *
+ * Objects are stored as to_binary buffers and reconstructed with from_binary, so cached objects
+ * can not be modified through the cache. Buffers are content addressed (binary_hash): if
+ * different keys produce the same object, the buffer is only stored once.
+ *
+ * When the buffers exceed max_memory_bytes, the least recently used buffers are evicted. If a
+ * spill file is given, evicted buffers (and their keys) are moved to an ObjectStore on disk and
+ * are loaded back on the next request. Since the ObjectStore is persistent, a later process that
+ * opens the same spill file (after flush()) can reuse the results. The spill file must not be
+ * used by two caches at the same time.
+ *
+ * get_or_compute has single flight semantics: concurrent requests for the same key compute the
+ * object only once, the other requests wait for the result. Buffers are shared with the
+ * requests, so from_binary, reading the spill file and writing evicted buffers (in batches) run
+ * without holding the cache lock.
+ *
+ * Keys must identify the computation including the type of the result (e.g. hash of the input
+ * file, the parameters and the class name).
+ */
+class ObjectCache
+{
+  public:
+    /**
+     * @brief Counters for monitoring (see get_statistics)
+     */
+    struct Statistics
+    {
+        size_t hits          = 0; ///< requests served from memory or disk
+        size_t disk_hits     = 0; ///< hits that were loaded from the spill file
+        size_t misses        = 0; ///< requests that computed the object
+        size_t lookup_misses = 0; ///< get requests for keys that are not cached
+        size_t waits         = 0; ///< requests that waited for the computation of another request
+        size_t evictions     = 0; ///< buffers evicted from memory
+        size_t spills        = 0; ///< evicted buffers written to the spill file
+    };
+
+  private:
+    /// to_binary buffer, shared with the requests that read it (from_binary runs unlocked)
+    using t_buffer = std::shared_ptr<const std::string>;
+
+    struct Entry
+    {
+        t_buffer                      buffer;
+        std::list<uint64_t>::iterator lru_position;
+        std::vector<uint64_t>         keys; ///< keys that map to this buffer
+    };
+
+    /// buffer (and its keys) that is written to the spill file
+    struct SpillJob
+    {
+        uint64_t              content_hash;
+        t_buffer              buffer;
+        std::vector<uint64_t> keys;
+    };
+
+    /// running computations (single flight): key -> to_binary buffer of the result
+    using t_in_flight = std::unordered_map<uint64_t, std::shared_future<t_buffer>>;
+    /// evicted buffers that are not yet written to the spill file: key -> content hash, buffer
+    using t_spilling = std::unordered_map<uint64_t, std::pair<uint64_t, t_buffer>>;
+
+    size_t                                 _max_memory_bytes;
+    size_t                                 _memory_bytes = 0;
+    std::unordered_map<uint64_t, uint64_t> _keys;        ///< key -> content hash
+    std::unordered_map<uint64_t, Entry>    _entries;     ///< content hash -> buffer
+    std::list<uint64_t>                    _lru;         ///< content hashes, most recent first
+    t_in_flight                            _in_flight;   ///< keys that are being computed
+    t_spilling                             _spilling;    ///< evicted, spill write pending
+    std::vector<SpillJob>                  _spill_queue; ///< evicted buffers to write
+    Statistics                             _statistics;
+    mutable std::mutex                     _mutex; ///< guards all members except _spill_store
+
+    std::optional<ObjectStore> _spill_store;
+    mutable std::mutex         _spill_mutex; ///< guards _spill_store (file I/O without _mutex)
+
+    // these functions expect _mutex to be locked
+    t_buffer find_in_memory(uint64_t key);
+    void     insert_buffer(uint64_t key, uint64_t content_hash, t_buffer buffer);
+    void     evict();
+
+    // these functions expect _mutex to be unlocked
+    t_buffer find_buffer(uint64_t key);
+    t_buffer load_from_spill_file(uint64_t key);
+    void     write_spill_queue();
+    void     write_to_spill_file(const std::vector<SpillJob>& jobs);
+
+  public:
+    /**
+     * @brief Construct a new cache
+     *
+     * @param max_memory_bytes maximum size of the buffers that are kept in memory
+     * @param spill_file optional ObjectStore file for evicted buffers (created if it does not
+     * exist, an incomplete record of an interrupted process is removed)
+     */
+    explicit ObjectCache(size_t                               max_memory_bytes,
+                         std::optional<std::filesystem::path> spill_file = std::nullopt);
+
+    ObjectCache(const ObjectCache&)            = delete;
+    ObjectCache& operator=(const ObjectCache&) = delete;
+
+    /**
+     * @brief Return the cached object for key or compute (and cache) it
+     *
+     * @param key hash of the inputs of the computation
+     * @param compute T_object() called if the key is not cached (at most once for concurrent
+     * requests of the same key). If compute throws, the exception is passed to all waiting
+     * requests and nothing is cached.
+     */
+    template<typename T_object, typename T_compute>
+    T_object get_or_compute(uint64_t key, T_compute&& compute)
+    {
+        if (auto buffer = find_buffer(key))
+            return T_object::from_binary(*buffer);
+
+        std::promise<t_buffer> promise;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            // cached or started by another request after find_buffer
+            if (auto buffer = find_in_memory(key))
+            {
+                lock.unlock();
+                return T_object::from_binary(*buffer);
+            }
+
+            if (auto it = _in_flight.find(key); it != _in_flight.end())
+            {
+                ++_statistics.waits;
+                auto result = it->second;
+                lock.unlock();
+                return T_object::from_binary(*result.get());
+            }
+
+            ++_statistics.misses;
+            _in_flight.emplace(key, promise.get_future().share());
+        }
+
+        try
+        {
+            T_object       object       = compute();
+            auto           buffer       = std::make_shared<const std::string>(object.to_binary());
+            const uint64_t content_hash = object.binary_hash();
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                insert_buffer(key, content_hash, buffer);
+                _in_flight.erase(key);
+            }
+            promise.set_value(std::move(buffer));
+            write_spill_queue();
+
+            return object;
+        }
+        catch (...)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _in_flight.erase(key);
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+    }
+
+    /**
+     * @brief Return the cached object for key (std::nullopt if the key is not cached)
+     */
+    template<typename T_object>
+    std::optional<T_object> get(uint64_t key)
+    {
+        auto buffer = find_buffer(key);
+        if (!buffer)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            ++_statistics.lookup_misses;
+            return std::nullopt;
+        }
+
+        return T_object::from_binary(*buffer);
+    }
+
+    /**
+     * @brief Cache object under key
+     *
+     * Replaces the object of a key that is in memory. Keys that were already spilled to disk keep
+     * the spilled object once they are evicted again (keys are expected to identify a
+     * deterministic computation).
+     */
+    template<typename T_object>
+    void put(uint64_t key, const T_object& object)
+    {
+        auto           buffer       = std::make_shared<const std::string>(object.to_binary());
+        const uint64_t content_hash = object.binary_hash();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            insert_buffer(key, content_hash, std::move(buffer));
+        }
+        write_spill_queue();
+    }
+
+    /**
+     * @brief True if key is cached in memory or in the spill file
+     */
+    bool contains(uint64_t key) const;
+
+    /**
+     * @brief Write all buffers that are in memory to the spill file (e.g. before the process
+     * ends, so other processes can reuse them). The buffers stay in memory.
+     */
+    void flush();
+
+    /**
+     * @brief Remove all buffers from memory (the spill file is not modified)
+     */
+    void clear();
+
+    // ----- monitoring -----
+    Statistics get_statistics() const;
+    void       reset_statistics();
+
+    /// number of keys in memory
+    size_t size() const;
+    /// number of distinct buffers in memory
+    size_t get_number_of_buffers() const;
+    /// size of the buffers in memory
+    size_t get_memory_bytes() const;
+    size_t get_max_memory_bytes() const { return _max_memory_bytes; }
+    bool   has_spill_file() const { return _spill_store.has_value(); }
+};
+
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
@@ -139,22 +139,6 @@ ObjectPrinter ObjectPrinter::from_stream(std::istream& is)
     return printer;
 }
 
-void ObjectPrinter::to_stream(std::ostream& os) const
-{
-    using namespace stream;
-
-    container_to_stream(os, _name);
-    container_container_to_stream<1>(os, _fields);
-    container_to_stream(os, _field_types);
-    container_container_to_stream<2>(os, _lines);
-    container_container_to_stream<1>(os, _value_infos);
-    container_to_stream(os, _section_underliner);
-
-    os.write(reinterpret_cast<const char*>(&_float_precision), sizeof(_float_precision));
-    os.write(reinterpret_cast<const char*>(&_superscript_exponents),
-             sizeof(_superscript_exponents));
-}
-
 ObjectPrinter ObjectPrinter::__printer__(unsigned int float_precision,
                                          bool         superscript_exponents) const
 {
@@ -150,7 +150,23 @@ class ObjectPrinter
   public:
     // serialization support
     static ObjectPrinter from_stream(std::istream& is);
-    void                 to_stream(std::ostream& os) const;
+
+    template<typename T_ostream>
+    void to_stream(T_ostream& os) const
+    {
+        using namespace stream;
+
+        container_to_stream(os, _name);
+        container_container_to_stream<1>(os, _fields);
+        container_to_stream(os, _field_types);
+        container_container_to_stream<2>(os, _lines);
+        container_container_to_stream<1>(os, _value_infos);
+        container_to_stream(os, _section_underliner);
+
+        StreamWriter<T_ostream> writer(os);
+        writer.write_value(_float_precision);
+        writer.write_value(_superscript_exponents);
+    }
 
     ObjectPrinter __printer__(unsigned int float_precision, bool superscript_exponents) const;
 
@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "objectstore.hpp"
+
+#include "classversion.hpp"
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+
+namespace {
+constexpr std::string_view file_version = "ObjectStore_V1";
+
+/// hash + buffer size
+constexpr size_t record_header_size = sizeof(uint64_t) + sizeof(size_t);
+} // namespace
+
+ObjectStore::ObjectStore(std::filesystem::path file_path)
+    : _file_path(std::move(file_path))
+{
+    if (!std::filesystem::exists(_file_path))
+    {
+        std::ofstream ofs(_file_path, std::ios::binary);
+        write_version(ofs, file_version);
+
+        if (!ofs)
+            throw std::runtime_error(
+                fmt::format("ERROR[ObjectStore]: could not create '{}'", _file_path.string()));
+    }
+
+    index_file();
+}
+
+void ObjectStore::map_file()
+{
+    _mapped_file.close();
+    _mapped_size = std::filesystem::file_size(_file_path);
+
+    if (_mapped_size > 0)
+        _mapped_file.open(_file_path.string());
+
+    _mapping_is_stale = false;
+}
+
+std::string_view ObjectStore::mapped_buffer()
+{
+    if (_mapping_is_stale)
+        map_file();
+
+    if (!_mapped_file.is_open())
+        return {};
+
+    return std::string_view(_mapped_file.data(), _mapped_size);
+}
+
+void ObjectStore::index_file()
+{
+    _index.clear();
+    _keys.clear();
+    _mapping_is_stale = true;
+
+    ByteCursor cursor(mapped_buffer());
+    cursor.read_version(file_version, "ObjectStore");
+
+    size_t end_of_last_record = cursor.position();
+    while (cursor.remaining() >= record_header_size)
+    {
+        const auto hash = cursor.read<uint64_t>();
+        const auto size = cursor.read<size_t>();
+        if (size > cursor.remaining())
+            break;
+
+        if (_index.try_emplace(hash, Record{ cursor.position(), size }).second)
+            _keys.push_back(hash);
+
+        cursor.skip(size);
+        end_of_last_record = cursor.position();
+    }
+
+    // an incomplete record at the end of the file (interrupted write, or a write of another
+    // process that is still running) is ignored, the file is not modified (see repair)
+    _file_size = end_of_last_record;
+}
+
+void ObjectStore::repair()
+{
+    index_file();
+
+    if (std::filesystem::file_size(_file_path) != _file_size)
+    {
+        _mapped_file.close();
+        std::filesystem::resize_file(_file_path, _file_size);
+        _mapping_is_stale = true;
+    }
+}
+
+std::ofstream ObjectStore::open_for_append()
+{
+    // pick up records that were appended by another store since the file was indexed
+    if (std::filesystem::file_size(_file_path) != _file_size)
+    {
+        index_file();
+
+        if (std::filesystem::file_size(_file_path) != _file_size)
+            throw std::runtime_error(
+                fmt::format("ERROR[ObjectStore::add]: '{}' ends with an incomplete record "
+                            "(interrupted or concurrent write), call repair() before adding",
+                            _file_path.string()));
+    }
+
+    std::ofstream ofs(_file_path, std::ios::binary | std::ios::app);
+    if (!ofs)
+        throw std::runtime_error(fmt::format(
+            "ERROR[ObjectStore::add]: could not open '{}' for writing", _file_path.string()));
+
+    return ofs;
+}
+
+void ObjectStore::write_record(std::ostream&    os,
+                               PendingRecords&  pending,
+                               uint64_t         hash,
+                               std::string_view buffer) const
+{
+    const size_t size = buffer.size();
+    os.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    os.write(buffer.data(), static_cast<std::streamsize>(size));
+
+    const size_t offset = _file_size + pending.bytes;
+    pending.index.emplace(hash, Record{ offset + record_header_size, size });
+    pending.keys.push_back(hash);
+    pending.bytes += record_header_size + size;
+}
+
+void ObjectStore::commit(std::ofstream& ofs, PendingRecords& pending, std::string_view function)
+{
+    ofs.flush();
+    if (!ofs)
+        throw std::runtime_error(fmt::format(
+            "ERROR[ObjectStore::{}]: could not write to '{}'", function, _file_path.string()));
+
+    // the index only refers to records that are completely written
+    _index.merge(pending.index);
+    _keys.insert(_keys.end(), pending.keys.begin(), pending.keys.end());
+    _file_size += pending.bytes;
+    _mapping_is_stale = true;
+}
+
+bool ObjectStore::add_buffer(uint64_t hash, std::string_view buffer)
+{
+    if (contains(hash))
+        return false;
+
+    PendingRecords pending;
+    auto           ofs = open_for_append();
+    if (contains(hash)) // appended by another store
+        return false;
+
+    write_record(ofs, pending, hash, buffer);
+    commit(ofs, pending, "add_buffer");
+
+    return true;
+}
+
+size_t ObjectStore::add_buffers(const std::vector<std::pair<uint64_t, std::string_view>>& buffers)
+{
+    PendingRecords pending;
+    auto           ofs = open_for_append();
+    for (const auto& [hash, buffer] : buffers)
+        if (!contains(hash) && !pending.contains(hash))
+            write_record(ofs, pending, hash, buffer);
+    commit(ofs, pending, "add_buffers");
+
+    return pending.keys.size();
+}
+
+std::string_view ObjectStore::get_buffer(uint64_t hash)
+{
+    auto it = _index.find(hash);
+    if (it == _index.end())
+        throw std::out_of_range(fmt::format(
+            "ERROR[ObjectStore::get_buffer]: no object with hash {} in '{}'",
+            hash,
+            _file_path.string()));
+
+    return mapped_buffer().substr(it->second.offset, it->second.size);
+}
+
+void ObjectStore::close()
+{
+    _mapped_file.close();
+    _mapping_is_stale = true;
+}
+
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
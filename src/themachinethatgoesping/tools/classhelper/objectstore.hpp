@@ -0,0 +1,275 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief Append only file store for objects that implement to_binary / from_binary / binary_hash
+ *
+ * @authors Peter Urban
+ */
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/objectstore.doc.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <fmt/format.h>
+
+#include "bytecursor.hpp"
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+
+/**
+ * @brief Append only, memory mapped file store for serialized objects keyed by their binary_hash
+ *
+ * Each record consists of the 64 bit binary_hash, the size of the binary buffer and the buffer
+ * written by to_binary. Objects are only stored once (content addressed). Reading maps the file
+ * into memory, so buffers and ByteCursors returned by get_buffer / get_cursor are zero copy views
+ * into the mapping. They stay valid until the next add or close call (the file is remapped after
+ * writing). Batch loading maps the file once and does not allocate intermediate std::strings.
+ *
+ * An incomplete record at the end of the file (an interrupted write, or a write of another
+ * process that is still running) is ignored when the file is indexed, the file is only truncated
+ * by repair(). Before appending, records that other stores appended to the file are indexed.
+ * Several processes may read a store while one process appends to it, but only one store may
+ * write to the file at a time. The store is not thread safe.
+ */
+class ObjectStore
+{
+    struct Record
+    {
+        size_t offset; ///< offset of the binary buffer in the file
+        size_t size;   ///< size of the binary buffer
+    };
+
+    /// records written to the file that are added to the index once the write is verified
+    struct PendingRecords
+    {
+        std::unordered_map<uint64_t, Record> index;
+        std::vector<uint64_t>                keys;
+        size_t                               bytes = 0;
+
+        bool contains(uint64_t hash) const { return index.contains(hash); }
+    };
+
+    std::filesystem::path                _file_path;
+    std::unordered_map<uint64_t, Record> _index;
+    std::vector<uint64_t>                _keys;            ///< keys in file order
+    size_t                               _file_size   = 0; ///< end of the last complete record
+    size_t                               _mapped_size = 0;
+    boost::iostreams::mapped_file_source _mapped_file;
+    bool                                 _mapping_is_stale = true;
+
+    void             map_file();
+    void             index_file();
+    std::string_view mapped_buffer();
+    std::ofstream    open_for_append();
+    void             write_record(std::ostream&    os,
+                                  PendingRecords&  pending,
+                                  uint64_t         hash,
+                                  std::string_view buffer) const;
+    void commit(std::ofstream& ofs, PendingRecords& pending, std::string_view function);
+
+  public:
+    /**
+     * @brief Open a store file (the file is created if it does not exist)
+     *
+     * @param file_path path of the store file
+     */
+    explicit ObjectStore(std::filesystem::path file_path);
+
+    // ----- writing -----
+    /**
+     * @brief Append a binary buffer with the given key (skipped if the key is already stored)
+     *
+     * @param hash key of the buffer (usually the binary_hash of the object)
+     * @param buffer binary buffer (usually the result of to_binary)
+     * @return true if the buffer was appended, false if the key was already stored
+     */
+    bool add_buffer(uint64_t hash, std::string_view buffer);
+
+    /**
+     * @brief Append multiple binary buffers (the file is only opened and flushed once, keys that
+     * are already stored are skipped)
+     *
+     * @param buffers key and binary buffer of each record
+     * @return size_t number of appended buffers
+     */
+    size_t add_buffers(const std::vector<std::pair<uint64_t, std::string_view>>& buffers);
+
+    /**
+     * @brief Append an object (skipped if an object with the same binary_hash is already stored)
+     *
+     * @tparam T_object class with to_binary and binary_hash functions
+     * @return uint64_t binary_hash of the object (key for reading it back)
+     */
+    template<typename T_object>
+    uint64_t add(const T_object& object)
+    {
+        const uint64_t hash = object.binary_hash();
+        if (!contains(hash))
+            add_buffer(hash, object.to_binary());
+
+        return hash;
+    }
+
+    /**
+     * @brief Append multiple objects (the file is only opened once)
+     *
+     * @tparam T_object class with to_binary and binary_hash functions
+     * @return std::vector<uint64_t> binary_hash of each object
+     */
+    template<typename T_object>
+    std::vector<uint64_t> add(const std::vector<T_object>& objects)
+    {
+        std::vector<uint64_t> hashes;
+        hashes.reserve(objects.size());
+
+        PendingRecords pending;
+        auto           ofs = open_for_append();
+        for (const auto& object : objects)
+        {
+            const uint64_t hash = object.binary_hash();
+            if (!contains(hash) && !pending.contains(hash))
+                write_record(ofs, pending, hash, object.to_binary());
+            hashes.push_back(hash);
+        }
+        commit(ofs, pending, "add");
+
+        return hashes;
+    }
+
+    // ----- reading -----
+    bool contains(uint64_t hash) const { return _index.contains(hash); }
+
+    /**
+     * @brief Binary buffer of a stored object (zero copy view into the mapped file, valid until
+     * the next add or close)
+     *
+     * @param hash key of the object
+     * @return std::string_view
+     */
+    std::string_view get_buffer(uint64_t hash);
+
+    /**
+     * @brief ByteCursor over the binary buffer of a stored object (zero copy, same lifetime as
+     * get_buffer)
+     */
+    ByteCursor get_cursor(uint64_t hash) { return ByteCursor(get_buffer(hash)); }
+
+    /**
+     * @brief Read a stored object
+     *
+     * @tparam T_object class with a from_binary function
+     * @param hash key of the object
+     */
+    template<typename T_object>
+    T_object get(uint64_t hash)
+    {
+        return T_object::from_binary(get_buffer(hash));
+    }
+
+    /**
+     * @brief Read multiple stored objects (the file is mapped once, the buffers are read in place)
+     *
+     * @tparam T_object class with a from_binary function
+     * @param hashes keys of the objects
+     * @param mp_cores Number of cores to use for parallelization (only used if T_object is
+     * default constructible)
+     * @return std::vector<T_object> objects in the order of hashes
+     */
+    template<typename T_object>
+    std::vector<T_object> get(const std::vector<uint64_t>& hashes, int mp_cores = 1)
+    {
+        std::vector<std::string_view> buffers;
+        buffers.reserve(hashes.size());
+        for (auto hash : hashes)
+            buffers.push_back(get_buffer(hash));
+
+        if constexpr (std::is_default_constructible_v<T_object>)
+        {
+            std::vector<T_object> objects(buffers.size());
+            std::exception_ptr    exception;
+
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1)
+            for (int64_t i = 0; i < int64_t(buffers.size()); ++i)
+            {
+                try
+                {
+                    objects[i] = T_object::from_binary(buffers[i]);
+                }
+                catch (...)
+                {
+#pragma omp critical
+                    exception = std::current_exception();
+                }
+            }
+
+            if (exception)
+                std::rethrow_exception(exception);
+
+            return objects;
+        }
+        else
+        {
+            std::vector<T_object> objects;
+            objects.reserve(buffers.size());
+            for (auto buffer : buffers)
+                objects.push_back(T_object::from_binary(buffer));
+
+            return objects;
+        }
+    }
+
+    /**
+     * @brief Read all stored objects (in the order they were added)
+     */
+    template<typename T_object>
+    std::vector<T_object> get_all(int mp_cores = 1)
+    {
+        return get<T_object>(_keys, mp_cores);
+    }
+
+    /**
+     * @brief Unmap the file (views returned by get_buffer / get_cursor become invalid)
+     */
+    void close();
+
+    /**
+     * @brief Re-index the file and truncate an incomplete record at its end (e.g. after an
+     * interrupted write)
+     *
+     * Must not be called while another process appends to the file.
+     */
+    void repair();
+
+    // ----- getters -----
+    const std::filesystem::path& get_file_path() const { return _file_path; }
+    const std::vector<uint64_t>& get_keys() const { return _keys; }
+    size_t                       size() const { return _keys.size(); }
+    bool                         empty() const { return _keys.empty(); }
+
+    /**
+     * @brief Size of the indexed part of the store file in bytes (end of the last complete record)
+     */
+    size_t get_file_size() const { return _file_size; }
+};
+
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
@@ -118,9 +118,10 @@ struct Option
         is.read(reinterpret_cast<char*>(&v), sizeof(t_enum));
         return Option(v);
     }
-    void to_stream(std::ostream& os) const
+    template<typename T_ostream>
+    void to_stream(T_ostream& os) const
     {
-        os.write(reinterpret_cast<const char*>(&value), sizeof(t_enum));
+        stream::StreamWriter<T_ostream>(os).write_value(value);
     }
 
     ObjectPrinter __printer__(unsigned int float_precision, bool superscript_exponents) const
@@ -15,16 +15,25 @@
 #include ".docstrings/stream.doc.hpp"
 
 #include "xxhashhelper.hpp"
+#include <array>
+#include <cstring>
 #include <iostream>
 #include <optional>
 #include <set>
+#include <span>
 #include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 #include "../helper/isviewstream.hpp"
 #include "../helper/osstream.hpp"
+#include "bytecursor.hpp"
 
 #define __STREAM_DEFAULT_TO_BINARY__                                                               \
     /** @brief convert object to vector of bytes                                                   \
+     *                                                                                             \
+     * If the class implements binary_size(), the result is allocated once with the exact size.    \
      *                                                                                             \
      * @param resize_buffer variable for interface compatibility, does not do anything             \
      *                                                                                             \
@@ -33,14 +42,19 @@
     std::string to_binary([[maybe_unused]] bool resize_buffer = true) const                        \
     {                                                                                              \
         std::string result;                                                                        \
-        themachinethatgoesping::tools::helper::osstream buffer_stream(result);                     \
+        themachinethatgoesping::tools::helper::osstream buffer_stream(                             \
+            result,                                                                                \
+            themachinethatgoesping::tools::classhelper::stream::binary_size_hint(*this));          \
                                                                                                    \
         to_stream(buffer_stream);                                                                  \
         return result;                                                                             \
-    };
+    };                                                                                             \
+    __STREAM_DEFAULT_TO_BINARY_INTO__
 
 #define __STREAM_DEFAULT_TO_BINARY_NOT_CONST__                                                     \
     /** @brief convert object to vector of bytes                                                   \
+     *                                                                                             \
+     * If the class implements binary_size(), the result is allocated once with the exact size.    \
      *                                                                                             \
      * @param resize_buffer variable for interface compatibility, does not do anything             \
      *                                                                                             \
@@ -49,26 +63,170 @@
     std::string to_binary([[maybe_unused]] bool resize_buffer = true)                              \
     {                                                                                              \
         std::string result;                                                                        \
-        themachinethatgoesping::tools::helper::osstream buffer_stream(result);                     \
+        themachinethatgoesping::tools::helper::osstream buffer_stream(                             \
+            result,                                                                                \
+            themachinethatgoesping::tools::classhelper::stream::binary_size_hint(*this));          \
                                                                                                    \
         to_stream(buffer_stream);                                                                  \
         return result;                                                                             \
+    };                                                                                             \
+    __STREAM_DEFAULT_TO_BINARY_INTO_NOT_CONST__
+
+#define __STREAM_DEFAULT_TO_BINARY_INTO__                                                          \
+    /** @brief write the binary representation (same as to_binary) into a caller-owned buffer      \
+     * (e.g. shared memory or a memory mapped file region) without allocating                      \
+     *                                                                                             \
+     * @param buffer target buffer                                                                 \
+     * @return number of bytes written                                                             \
+     * @throws std::runtime_error if the buffer is too small                                       \
+     * */                                                                                          \
+    std::size_t to_binary_into(std::span<char> buffer) const                                       \
+    {                                                                                              \
+        themachinethatgoesping::tools::helper::ospanstream buffer_stream(buffer);                  \
+        if (themachinethatgoesping::tools::classhelper::stream::binary_fits(*this,                 \
+                                                                            buffer.size()))        \
+            to_stream(buffer_stream);                                                              \
+        else                                                                                       \
+            buffer_stream.setstate(std::ios_base::badbit);                                         \
+                                                                                                   \
+        themachinethatgoesping::tools::classhelper::stream::check_binary_written(                  \
+            buffer_stream, buffer.size());                                                         \
+        return buffer_stream.size();                                                               \
     };
 
-#define __STREAM_DEFAULT_FROM_BINARY__(T_CLASS)                                                    \
+#define __STREAM_DEFAULT_TO_BINARY_INTO_NOT_CONST__                                                \
+    /** @brief write the binary representation (same as to_binary) into a caller-owned buffer      \
+     * (e.g. shared memory or a memory mapped file region) without allocating                      \
+     *                                                                                             \
+     * @param buffer target buffer                                                                 \
+     * @return number of bytes written                                                             \
+     * @throws std::runtime_error if the buffer is too small                                       \
+     * */                                                                                          \
+    std::size_t to_binary_into(std::span<char> buffer)                                             \
+    {                                                                                              \
+        themachinethatgoesping::tools::helper::ospanstream buffer_stream(buffer);                  \
+        if (themachinethatgoesping::tools::classhelper::stream::binary_fits(*this,                 \
+                                                                            buffer.size()))        \
+            to_stream(buffer_stream);                                                              \
+        else                                                                                       \
+            buffer_stream.setstate(std::ios_base::badbit);                                         \
+                                                                                                   \
+        themachinethatgoesping::tools::classhelper::stream::check_binary_written(                  \
+            buffer_stream, buffer.size());                                                         \
+        return buffer_stream.size();                                                               \
+    };
+
+#define __STREAM_ENCODED_TO_BINARY__                                                               \
     /** @brief convert object to vector of bytes                                                   \
      *                                                                                             \
-     * @param check_buffer_is_read_completely variable for interface compatibility, does not do    \
-     * anything                                                                                    \
+     * For the raw encoding the result is allocated once with the exact size (binary_size).        \
+     *                                                                                             \
+     * @param resize_buffer variable for interface compatibility, does not do anything             \
+     * @param encoding raw (default) or compressed container payloads (see                         \
+     * classhelper::t_binary_encoding), from_binary detects the encoding                           \
+     * @param mp_cores Number of cores to use for parallelization (compressed encoding of large    \
+     * containers)                                                                                 \
      *                                                                                             \
      * @return vector of bytes                                                                     \
      * */                                                                                          \
+    std::string to_binary(                                                                         \
+        [[maybe_unused]] bool                                         resize_buffer = true,        \
+        themachinethatgoesping::tools::classhelper::o_binary_encoding encoding =                   \
+            themachinethatgoesping::tools::classhelper::t_binary_encoding::raw,                    \
+        int mp_cores = 1) const                                                                    \
+    {                                                                                              \
+        std::string result;                                                                        \
+        themachinethatgoesping::tools::helper::osstream buffer_stream(                             \
+            result,                                                                                \
+            encoding == themachinethatgoesping::tools::classhelper::t_binary_encoding::raw         \
+                ? themachinethatgoesping::tools::classhelper::stream::binary_size_hint(*this)      \
+                : themachinethatgoesping::tools::classhelper::stream::default_binary_size_hint);   \
+                                                                                                   \
+        to_stream(buffer_stream, encoding, mp_cores);                                              \
+        return result;                                                                             \
+    };                                                                                             \
+                                                                                                   \
+    /** @brief write the binary representation (same as to_binary) into a caller-owned buffer      \
+     * (e.g. shared memory or a memory mapped file region) without allocating                      \
+     *                                                                                             \
+     * @param buffer target buffer                                                                 \
+     * @param encoding raw (default) or compressed container payloads                              \
+     * @param mp_cores Number of cores to use for parallelization                                  \
+     * @return number of bytes written                                                             \
+     * @throws std::runtime_error if the buffer is too small                                       \
+     * */                                                                                          \
+    std::size_t to_binary_into(                                                                    \
+        std::span<char>                                               buffer,                      \
+        themachinethatgoesping::tools::classhelper::o_binary_encoding encoding =                   \
+            themachinethatgoesping::tools::classhelper::t_binary_encoding::raw,                    \
+        int mp_cores = 1) const                                                                    \
+    {                                                                                              \
+        themachinethatgoesping::tools::helper::ospanstream buffer_stream(buffer);                  \
+        if (encoding != themachinethatgoesping::tools::classhelper::t_binary_encoding::raw ||      \
+            themachinethatgoesping::tools::classhelper::stream::binary_fits(*this, buffer.size())) \
+            to_stream(buffer_stream, encoding, mp_cores);                                          \
+        else                                                                                       \
+            buffer_stream.setstate(std::ios_base::badbit);                                         \
+                                                                                                   \
+        themachinethatgoesping::tools::classhelper::stream::check_binary_written(                  \
+            buffer_stream, buffer.size());                                                         \
+        return buffer_stream.size();                                                               \
+    };
+
+#define __STREAM_ENCODED_FROM_BINARY__(T_CLASS)                                                    \
+    /** @brief create object from a buffer written with to_binary (raw or compressed encoding)     \
+     *                                                                                             \
+     * @param check_buffer_is_read_completely throw if the buffer has trailing bytes (only         \
+     * supported for classes that implement from_cursor)                                           \
+     * @param mp_cores Number of cores to use for parallelization (compressed encoding of large    \
+     * containers)                                                                                 \
+     *                                                                                             \
+     * @return T_CLASS                                                                             \
+     * */                                                                                          \
+    static T_CLASS from_binary(std::string_view      buffer,                                       \
+                               [[maybe_unused]] bool check_buffer_is_read_completely = false,      \
+                               int                   mp_cores                        = 1)          \
+    {                                                                                              \
+        if constexpr (themachinethatgoesping::tools::classhelper::has_from_cursor<T_CLASS>)        \
+        {                                                                                          \
+            themachinethatgoesping::tools::classhelper::ByteCursor cursor(buffer);                 \
+                                                                                                   \
+            auto object = T_CLASS::from_cursor(cursor, mp_cores);                                  \
+            if (check_buffer_is_read_completely)                                                   \
+                cursor.check_at_end();                                                             \
+            return object;                                                                         \
+        }                                                                                          \
+        else                                                                                       \
+        {                                                                                          \
+            themachinethatgoesping::tools::helper::isviewstream buffer_stream(buffer);             \
+                                                                                                   \
+            return from_stream(buffer_stream, mp_cores);                                           \
+        }                                                                                          \
+    };
+
+#define __STREAM_DEFAULT_FROM_BINARY__(T_CLASS)                                                    \
+    /** @brief create object from a buffer written with to_binary                                  \
+     *                                                                                             \
+     * If T_CLASS implements from_cursor(ByteCursor&), the buffer is read without an               \
+     * istream (containers are copied with a single memcpy), otherwise from_stream is used.        \
+     *                                                                                             \
+     * @param check_buffer_is_read_completely throw if the buffer has trailing bytes (only         \
+     * supported for classes that implement from_cursor)                                           \
+     *                                                                                             \
+     * @return T_CLASS                                                                             \
+     * */                                                                                          \
     static T_CLASS from_binary(std::string_view      buffer,                                       \
                                [[maybe_unused]] bool check_buffer_is_read_completely = false)      \
     {                                                                                              \
-        themachinethatgoesping::tools::helper::isviewstream buffer_stream(buffer);                 \
+        if constexpr (themachinethatgoesping::tools::classhelper::has_from_cursor<T_CLASS>)        \
+            return themachinethatgoesping::tools::classhelper::from_binary_cursor<T_CLASS>(        \
+                buffer, check_buffer_is_read_completely);                                          \
+        else                                                                                       \
+        {                                                                                          \
+            themachinethatgoesping::tools::helper::isviewstream buffer_stream(buffer);             \
                                                                                                    \
-        return from_stream(buffer_stream);                                                         \
+            return from_stream(buffer_stream);                                                     \
+        }                                                                                          \
     };
 // this assumes that T_CLASS has from_stream and to_stream functions
 #define __STREAM_DEFAULT_TOFROM_BINARY_FUNCTIONS_NO_HASH__(T_CLASS)                                \
@@ -81,6 +239,13 @@
     __STREAM_DEFAULT_FROM_BINARY__(T_CLASS)                                                        \
     __BINARY_HASH__
 
+// this assumes that T_CLASS has from_stream(is, mp_cores) and to_stream(os, o_binary_encoding,
+// mp_cores) functions and includes classhelper/compression.hpp
+#define __STREAM_ENCODED_TOFROM_BINARY_FUNCTIONS__(T_CLASS)                                        \
+    __STREAM_ENCODED_TO_BINARY__                                                                   \
+    __STREAM_ENCODED_FROM_BINARY__(T_CLASS)                                                        \
+    __BINARY_HASH__
+
 // this assumes that T_CLASS has from_stream and to_stream functions
 #define __STREAM_DEFAULT_TOFROM_BINARY_FUNCTIONS_NOT_CONST__(T_CLASS)                              \
     __STREAM_DEFAULT_TO_BINARY_NOT_CONST__                                                         \
@@ -92,253 +257,451 @@ namespace tools {
 namespace classhelper {
 namespace stream {
 
-template<typename T_container>
-inline void container_to_stream(std::ostream& os, const T_container& container)
+/// initial capacity of to_binary for classes without binary_size (same as helper::osstream)
+inline constexpr size_t default_binary_size_hint = 256;
+
+/**
+ * @brief True if T_class implements size_t binary_size() (exact size of the to_binary result)
+ */
+template<typename T_class>
+concept has_binary_size = requires(T_class& obj) {
+    { obj.binary_size() } -> std::convertible_to<size_t>;
+};
+
+/**
+ * @brief Initial buffer capacity for to_binary (binary_size if implemented)
+ */
+template<typename T_class>
+size_t binary_size_hint(T_class& obj)
 {
-    size_t size = container.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size_t));
-    os.write(reinterpret_cast<const char*>(container.data()),
-             size * sizeof(typename T_container::value_type));
+    if constexpr (has_binary_size<T_class>)
+        return obj.binary_size();
+    else
+        return default_binary_size_hint;
 }
 
-template<typename T_container>
-inline T_container container_from_stream(std::istream& is)
+/**
+ * @brief False if T_class implements binary_size and the object does not fit into buffer_size
+ * bytes (used by to_binary_into to fail before writing)
+ */
+template<typename T_class>
+bool binary_fits(T_class& obj, size_t buffer_size)
 {
-    T_container container;
-    size_t      size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size_t));
-    container.resize(size);
-    is.read(reinterpret_cast<char*>(container.data()),
-            size * sizeof(typename T_container::value_type));
+    if constexpr (has_binary_size<T_class>)
+        return obj.binary_size() <= buffer_size;
+    else
+        return true;
+}
 
-    return container;
+/**
+ * @brief Throw if writing into the buffer of to_binary_into failed (buffer too small)
+ */
+inline void check_binary_written(const std::ostream& os, size_t buffer_size)
+{
+    if (!os)
+        throw std::runtime_error(fmt::format(
+            "ERROR[to_binary_into]: the buffer ({} bytes) is too small for the object",
+            buffer_size));
 }
 
-template<typename t_map>
-inline void map_to_stream(std::ostream& os, const t_map& map)
+/**
+ * @brief Buffered writer for the stream functions below
+ *
+ * Small writes (sizes, keys, values) are collected in a contiguous block that is written to the
+ * stream with a single call, large payloads (POD containers) are written directly. For
+ * helper::osstream and helper::ospanstream (selected at compile time) all writes go directly to
+ * the target buffer without going through the virtual std::streambuf interface. The block is
+ * flushed in the destructor.
+ *
+ * @tparam T_ostream static type of the output stream
+ */
+template<typename T_ostream = std::ostream>
+class StreamWriter
 {
-    size_t size = map.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size_t));
-    for (const auto& [key, value] : map)
+    static constexpr bool is_osstream = helper::has_write_direct<T_ostream>;
+    static constexpr size_t block_size = is_osstream ? 1 : 4096;
+
+    T_ostream&                    _os;
+    std::array<char, block_size> _block;
+    size_t                        _block_pos = 0;
+
+  public:
+    explicit StreamWriter(T_ostream& os)
+        : _os(os)
     {
-        os.write(reinterpret_cast<const char*>(&key), sizeof(typename t_map::key_type));
-        os.write(reinterpret_cast<const char*>(&value), sizeof(typename t_map::mapped_type));
     }
-}
+    StreamWriter(const StreamWriter&)            = delete;
+    StreamWriter& operator=(const StreamWriter&) = delete;
+    ~StreamWriter() { flush(); }
 
-template<typename t_map>
-inline t_map map_from_stream(std::istream& is)
+    void write(const void* data, size_t bytes)
+    {
+        if constexpr (is_osstream)
+            _os.write_direct(static_cast<const char*>(data), bytes);
+        else
+        {
+            if (_block_pos + bytes > block_size)
+            {
+                flush();
+                if (bytes > block_size)
+                {
+                    _os.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+                    return;
+                }
+            }
+
+            std::memcpy(_block.data() + _block_pos, data, bytes);
+            _block_pos += bytes;
+        }
+    }
+
+    /**
+     * @brief Write the object representation of value (sizeof(T) bytes)
+     */
+    template<typename T>
+    void write_value(const T& value)
+    {
+        write(&value, sizeof(T));
+    }
+
+    /**
+     * @brief Write size and data of a contiguous container (same layout as container_to_stream)
+     */
+    template<typename T_container>
+    void write_container(const T_container& container)
+    {
+        const size_t size = container.size();
+        write_value(size);
+        write(container.data(), size * sizeof(typename T_container::value_type));
+    }
+
+    /**
+     * @brief Write the buffered block to the stream
+     */
+    void flush()
+    {
+        if constexpr (!is_osstream)
+            if (_block_pos > 0)
+            {
+                _os.write(_block.data(), static_cast<std::streamsize>(_block_pos));
+                _block_pos = 0;
+            }
+    }
+};
+
+/**
+ * @brief Reader for the stream functions below
+ *
+ * For helper::isviewstream (selected at compile time) the data is copied directly from the
+ * viewed buffer without going through the virtual std::streambuf interface. Other streams are
+ * read with std::istream::read. The reader never reads ahead, so it can be mixed with other
+ * reads from the same stream.
+ *
+ * @tparam T_istream static type of the input stream
+ */
+template<typename T_istream = std::istream>
+class StreamReader
 {
-    t_map  map;
-    size_t size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size_t));
-    for (size_t i = 0; i < size; ++i)
+    static constexpr bool is_isviewstream = std::is_base_of_v<helper::isviewstream, T_istream>;
+
+    T_istream& _is;
+
+  public:
+    explicit StreamReader(T_istream& is)
+        : _is(is)
     {
-        typename t_map::key_type    key;
-        typename t_map::mapped_type value;
-        is.read(reinterpret_cast<char*>(&key), sizeof(typename t_map::key_type));
-        is.read(reinterpret_cast<char*>(&value), sizeof(typename t_map::mapped_type));
-        map[key] = value;
     }
 
-    return map;
+    void read(void* data, size_t bytes)
+    {
+        if constexpr (is_isviewstream)
+            _is.read_direct(static_cast<char*>(data), bytes);
+        else
+            _is.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes));
+    }
+
+    /**
+     * @brief Read the object representation of a value (sizeof(T) bytes)
+     */
+    template<typename T>
+    T read_value()
+    {
+        T value;
+        read(&value, sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Read a container written with write_container / container_to_stream
+     */
+    template<typename T_container>
+    T_container read_container()
+    {
+        T_container container;
+        container.resize(read_value<size_t>());
+        read(container.data(), container.size() * sizeof(typename T_container::value_type));
+
+        return container;
+    }
+};
+
+template<typename T_container, typename T_ostream>
+inline void container_to_stream(T_ostream& os, const T_container& container)
+{
+    StreamWriter<T_ostream> writer(os);
+    writer.write_container(container);
+}
+
+/**
+ * @brief Number of bytes container_to_stream writes for this container (size + data)
+ */
+template<typename T_container>
+inline size_t container_binary_size(const T_container& container)
+{
+    return sizeof(size_t) + container.size() * sizeof(typename T_container::value_type);
+}
+
+template<typename T_container, typename T_istream>
+inline T_container container_from_stream(T_istream& is)
+{
+    return StreamReader<T_istream>(is).template read_container<T_container>();
 }
 
-template<typename t_map>
-inline void map_container_to_stream(std::ostream& os, const t_map& map)
+template<typename t_map, typename T_ostream>
+inline void map_to_stream(T_ostream& os, const t_map& map)
 {
-    size_t size = map.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size_t));
+    StreamWriter<T_ostream> writer(os);
+    writer.write_value(map.size());
     for (const auto& [key, value] : map)
     {
-        os.write(reinterpret_cast<const char*>(&key), sizeof(typename t_map::key_type));
-        container_to_stream(os, value);
+        writer.write_value(key);
+        writer.write_value(value);
     }
 }
 
-template<typename t_map>
-inline t_map map_container_from_stream(std::istream& is)
+template<typename t_map, typename T_istream>
+inline t_map map_from_stream(T_istream& is)
 {
-    t_map  map;
-    size_t size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size_t));
-    for (size_t i = 0; i < size; ++i)
+    using t_key   = typename t_map::key_type;
+    using t_value = typename t_map::mapped_type;
+
+    StreamReader<T_istream> reader(is);
+    t_map                   map;
+    const auto              size = reader.template read_value<size_t>();
+
+    if constexpr (std::is_trivially_copyable_v<t_key> && std::is_trivially_copyable_v<t_value>)
     {
-        typename t_map::key_type    key;
-        typename t_map::mapped_type value;
-        is.read(reinterpret_cast<char*>(&key), sizeof(typename t_map::key_type));
-        value               = container_from_stream<typename t_map::mapped_type>(is);
-        map[std::move(key)] = std::move(value);
+        // read all key/value pairs with a single read
+        constexpr size_t  pair_size = sizeof(t_key) + sizeof(t_value);
+        std::vector<char> block(size * pair_size);
+        reader.read(block.data(), block.size());
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            t_key   key;
+            t_value value;
+            std::memcpy(&key, block.data() + i * pair_size, sizeof(t_key));
+            std::memcpy(&value, block.data() + i * pair_size + sizeof(t_key), sizeof(t_value));
+            map[key] = value;
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            t_key   key;
+            t_value value;
+            reader.read(&key, sizeof(t_key));
+            reader.read(&value, sizeof(t_value));
+            map[key] = value;
+        }
     }
 
     return map;
 }
 
-template<typename T_set_value>
-inline void set_to_stream(std::ostream& os, const std::set<T_set_value>& set)
+template<typename t_map, typename T_ostream>
+inline void map_container_to_stream(T_ostream& os, const t_map& map)
 {
-    size_t size = set.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size_t));
-    for (const auto& value : set)
+    StreamWriter<T_ostream> writer(os);
+    writer.write_value(map.size());
+    for (const auto& [key, value] : map)
     {
-        os.write(reinterpret_cast<const char*>(&value), sizeof(T_set_value));
+        writer.write_value(key);
+        writer.write_container(value);
     }
 }
 
-template<typename T_set_value>
-inline std::set<T_set_value> set_from_stream(std::istream& is)
+template<typename t_map, typename T_istream>
+inline t_map map_container_from_stream(T_istream& is)
 {
-    std::set<T_set_value> set;
-    size_t                size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size_t));
+    StreamReader<T_istream> reader(is);
+    t_map                   map;
+    const auto              size = reader.template read_value<size_t>();
     for (size_t i = 0; i < size; ++i)
     {
-        T_set_value value;
-        is.read(reinterpret_cast<char*>(&value), sizeof(T_set_value));
-        set.insert(value);
+        typename t_map::key_type    key;
+        typename t_map::mapped_type value;
+        reader.read(&key, sizeof(typename t_map::key_type));
+        value = reader.template read_container<typename t_map::mapped_type>();
+        map[std::move(key)] = std::move(value);
     }
 
-    return set;
+    return map;
+}
+
+template<typename T_set_value, typename T_ostream>
+inline void set_to_stream(T_ostream& os, const std::set<T_set_value>& set)
+{
+    StreamWriter<T_ostream> writer(os);
+    writer.write_value(set.size());
+    for (const auto& value : set)
+        writer.write_value(value);
 }
 
-template<unsigned int level, typename T_container>
-inline void container_container_to_stream(std::ostream& os, const T_container& container)
+template<typename T_set_value, typename T_istream>
+inline std::set<T_set_value> set_from_stream(T_istream& is)
 {
-    size_t size = container.size();
-    os.write(reinterpret_cast<const char*>(&size), sizeof(size_t));
+    StreamReader<T_istream> reader(is);
+    std::set<T_set_value>   set;
+    const auto              size = reader.template read_value<size_t>();
 
-    if constexpr (level > 1)
+    if constexpr (std::is_trivially_copyable_v<T_set_value>)
     {
-        for (const auto& sub_container : container)
+        // read all values with a single read (the values are sorted, so insert at the end)
+        std::vector<char> block(size * sizeof(T_set_value));
+        reader.read(block.data(), block.size());
+
+        for (size_t i = 0; i < size; ++i)
         {
-            container_container_to_stream<level - 1, typename T_container::value_type>(
-                os, sub_container);
+            T_set_value value;
+            std::memcpy(&value, block.data() + i * sizeof(T_set_value), sizeof(T_set_value));
+            set.insert(set.end(), value);
         }
     }
     else
     {
-        for (const auto& sub_container : container)
+        for (size_t i = 0; i < size; ++i)
         {
-            container_to_stream(os, sub_container);
+            T_set_value value;
+            reader.read(&value, sizeof(T_set_value));
+            set.insert(value);
         }
     }
+
+    return set;
 }
 
-template<unsigned int level, typename T_container>
-inline T_container container_container_from_stream(std::istream& is)
+template<unsigned int level, typename T_container, typename T_writer>
+inline void container_container_to_writer(T_writer& writer, const T_container& container)
 {
-    T_container container;
-    size_t      size;
-    is.read(reinterpret_cast<char*>(&size), sizeof(size_t));
-    container.resize(size);
+    writer.write_value(container.size());
 
-    if constexpr (level > 1)
+    for (const auto& sub_container : container)
     {
-        for (auto& sub_container : container)
-        {
-            sub_container =
-                container_container_from_stream<level - 1, typename T_container::value_type>(is);
-        }
+        if constexpr (level > 1)
+            container_container_to_writer<level - 1>(writer, sub_container);
+        else
+            writer.write_container(sub_container);
     }
-    else
+}
+
+template<unsigned int level, typename T_container, typename T_reader>
+inline T_container container_container_from_reader(T_reader& reader)
+{
+    T_container container;
+    container.resize(reader.template read_value<size_t>());
+
+    for (auto& sub_container : container)
     {
-        for (auto& sub_container : container)
-        {
-            sub_container = container_from_stream<typename T_container::value_type>(is);
-        }
+        if constexpr (level > 1)
+            sub_container =
+                container_container_from_reader<level - 1, typename T_container::value_type>(
+                    reader);
+        else
+            sub_container = reader.template read_container<typename T_container::value_type>();
     }
 
     return container;
 }
 
-template<typename T_optional>
-inline void optional_to_stream(std::ostream& os, const std::optional<T_optional>& optional)
+template<unsigned int level, typename T_container, typename T_ostream>
+inline void container_container_to_stream(T_ostream& os, const T_container& container)
 {
-    bool has_value = optional.has_value();
-    os.write(reinterpret_cast<const char*>(&has_value), sizeof(bool));
+    StreamWriter<T_ostream> writer(os);
+    container_container_to_writer<level>(writer, container);
+}
 
-    if (has_value)
-    {
-        os.write(reinterpret_cast<const char*>(&optional.value()), sizeof(T_optional));
-    }
+template<unsigned int level, typename T_container, typename T_istream>
+inline T_container container_container_from_stream(T_istream& is)
+{
+    StreamReader<T_istream> reader(is);
+    return container_container_from_reader<level, T_container>(reader);
 }
 
-template<typename T_optional>
-inline std::optional<T_optional> optional_from_stream(std::istream& is)
+template<typename T_optional, typename T_ostream>
+inline void optional_to_stream(T_ostream& os, const std::optional<T_optional>& optional)
 {
-    bool has_value;
-    is.read(reinterpret_cast<char*>(&has_value), sizeof(bool));
+    StreamWriter<T_ostream> writer(os);
+    writer.write_value(optional.has_value());
 
-    if (has_value)
-    {
-        T_optional value;
-        is.read(reinterpret_cast<char*>(&value), sizeof(T_optional));
-        return value;
-    }
+    if (optional.has_value())
+        writer.write_value(optional.value());
+}
+
+template<typename T_optional, typename T_istream>
+inline std::optional<T_optional> optional_from_stream(T_istream& is)
+{
+    StreamReader<T_istream> reader(is);
+
+    if (reader.template read_value<bool>())
+        return reader.template read_value<T_optional>();
     else
-    {
         return std::nullopt;
-    }
 }
 
-template<typename T_optional>
-inline void optional_container_to_stream(std::ostream&                    os,
+template<typename T_optional, typename T_ostream>
+inline void optional_container_to_stream(T_ostream&                       os,
                                          const std::optional<T_optional>& optional)
 {
+    StreamWriter<T_ostream> writer(os);
+    writer.write_value(optional.has_value());
 
-    bool has_value = optional.has_value();
-    os.write(reinterpret_cast<const char*>(&has_value), sizeof(bool));
-
-    if (has_value)
-    {
-        container_to_stream(os, optional.value());
-    }
+    if (optional.has_value())
+        writer.write_container(optional.value());
 }
 
-template<typename T_optional>
-inline std::optional<T_optional> optional_container_from_stream(std::istream& is)
+template<typename T_optional, typename T_istream>
+inline std::optional<T_optional> optional_container_from_stream(T_istream& is)
 {
-    bool has_value;
-    is.read(reinterpret_cast<char*>(&has_value), sizeof(bool));
+    StreamReader<T_istream> reader(is);
 
-    if (has_value)
-    {
-        return container_from_stream<T_optional>(is);
-    }
+    if (reader.template read_value<bool>())
+        return reader.template read_container<T_optional>();
     else
-    {
         return std::nullopt;
-    }
 }
 
-template<typename T_optional_set_value>
-inline void optional_set_to_stream(std::ostream&                                        os,
+template<typename T_optional_set_value, typename T_ostream>
+inline void optional_set_to_stream(T_ostream&                                           os,
                                    const std::optional<std::set<T_optional_set_value>>& optional)
 {
-
-    bool has_value = optional.has_value();
-    os.write(reinterpret_cast<const char*>(&has_value), sizeof(bool));
-
-    if (has_value)
     {
-        set_to_stream(os, optional.value());
+        StreamWriter<T_ostream> writer(os);
+        writer.write_value(optional.has_value());
     }
+
+    if (optional.has_value())
+        set_to_stream(os, optional.value());
 }
 
-template<typename T_optional_set_value>
-inline std::optional<std::set<T_optional_set_value>> optional_set_from_stream(std::istream& is)
+template<typename T_optional_set_value, typename T_istream>
+inline std::optional<std::set<T_optional_set_value>> optional_set_from_stream(T_istream& is)
 {
-    bool has_value;
-    is.read(reinterpret_cast<char*>(&has_value), sizeof(bool));
-
-    if (has_value)
-    {
+    if (StreamReader<T_istream>(is).template read_value<bool>())
         return set_from_stream<T_optional_set_value>(is);
-    }
     else
-    {
         return std::nullopt;
-    }
 }
 
 } // stream
@@ -0,0 +1,466 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief Tagged, length prefixed field layout for forward compatible to_stream / to_binary
+ *
+ * @authors Peter Urban
+ */
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/taggedfields.doc.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "bytecursor.hpp"
+#include "stream.hpp"
+#include "xxhashhelper.hpp"
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+
+/*
+ * Layout of a tagged field record:
+ *
+ *   repeated: t_field_tag tag | uint64_t payload size | payload
+ *   t_field_tag end_of_fields_tag
+ *
+ * Tags identify the fields of a class and must never be reused for a different field. Readers
+ * look up the fields they know and skip everything else (unknown fields written by newer
+ * versions, or fields that are not needed) using the payload size, without decoding it.
+ */
+using t_field_tag = uint16_t;
+
+/// tag that terminates a tagged field record (not a valid field tag)
+inline constexpr t_field_tag end_of_fields_tag = 0;
+
+/// size of the header in front of each field payload (tag + payload size)
+inline constexpr size_t field_header_size = sizeof(t_field_tag) + sizeof(uint64_t);
+
+namespace detail {
+inline void check_field_tag(t_field_tag tag)
+{
+    if (tag == end_of_fields_tag)
+        throw std::invalid_argument(fmt::format(
+            "ERROR[TaggedFieldWriter]: field tag {} is reserved (end of fields)", tag));
+}
+} // namespace detail
+
+/**
+ * @brief Write a tagged field record to a stream
+ *
+ * Writes go through stream::StreamWriter (same buffering and osstream fast path as the stream
+ * functions). finish() writes the end of the record and must be called after the last field.
+ *
+ * TaggedFieldHasher and TaggedFieldSizer have the same interface, so a class can implement one
+ * template function that visits its fields and use it for to_stream, hash_to and binary_size.
+ *
+ * @tparam T_ostream static type of the output stream
+ */
+template<typename T_ostream = std::ostream>
+class TaggedFieldWriter
+{
+    stream::StreamWriter<T_ostream> _writer;
+
+    void write_header(t_field_tag tag, uint64_t payload_size)
+    {
+        detail::check_field_tag(tag);
+        _writer.write_value(tag);
+        _writer.write_value(payload_size);
+    }
+
+  public:
+    explicit TaggedFieldWriter(T_ostream& os)
+        : _writer(os)
+    {
+    }
+
+    /**
+     * @brief Write a trivially copyable value (payload: sizeof(T) bytes)
+     */
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write_value(t_field_tag tag, const T& value)
+    {
+        write_header(tag, sizeof(T));
+        _writer.write_value(value);
+    }
+
+    /**
+     * @brief Write a contiguous container (payload: same layout as stream::container_to_stream)
+     */
+    template<typename T_container>
+    void write_container(t_field_tag tag, const T_container& container)
+    {
+        write_header(tag, stream::container_binary_size(container));
+        _writer.write_container(container);
+    }
+
+    /**
+     * @brief Write already serialized bytes (e.g. the to_binary result of a member object)
+     */
+    void write_bytes(t_field_tag tag, std::string_view bytes)
+    {
+        write_header(tag, bytes.size());
+        _writer.write(bytes.data(), bytes.size());
+    }
+
+    /**
+     * @brief Terminate the record (must be called after the last field)
+     */
+    void finish() { _writer.write_value(end_of_fields_tag); }
+};
+
+/**
+ * @brief Feed the bytes TaggedFieldWriter would write into a BinaryHasher (used by hash_to)
+ */
+class TaggedFieldHasher
+{
+    BinaryHasher& _hasher;
+
+    void update_header(t_field_tag tag, uint64_t payload_size)
+    {
+        detail::check_field_tag(tag);
+        _hasher.update_value(tag);
+        _hasher.update_value(payload_size);
+    }
+
+  public:
+    explicit TaggedFieldHasher(BinaryHasher& hasher)
+        : _hasher(hasher)
+    {
+    }
+
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write_value(t_field_tag tag, const T& value)
+    {
+        update_header(tag, sizeof(T));
+        _hasher.update_value(value);
+    }
+
+    template<typename T_container>
+    void write_container(t_field_tag tag, const T_container& container)
+    {
+        write_container_header(tag, container);
+        _hasher.update_container(container);
+    }
+
+    /**
+     * @brief Hash only the header of a container field, the caller feeds the payload into the
+     * hasher (e.g. stream::compressed_container_to_stream, which hashes while writing)
+     */
+    template<typename T_container>
+    void write_container_header(t_field_tag tag, const T_container& container)
+    {
+        update_header(tag, stream::container_binary_size(container));
+    }
+
+    void write_bytes(t_field_tag tag, std::string_view bytes)
+    {
+        update_header(tag, bytes.size());
+        _hasher.update(bytes.data(), bytes.size());
+    }
+
+    void finish() { _hasher.update_value(end_of_fields_tag); }
+};
+
+/**
+ * @brief Count the bytes TaggedFieldWriter would write (used by binary_size)
+ */
+class TaggedFieldSizer
+{
+    size_t _size = 0;
+
+  public:
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write_value([[maybe_unused]] t_field_tag tag, [[maybe_unused]] const T& value)
+    {
+        _size += field_header_size + sizeof(T);
+    }
+
+    template<typename T_container>
+    void write_container([[maybe_unused]] t_field_tag tag, const T_container& container)
+    {
+        _size += field_header_size + stream::container_binary_size(container);
+    }
+
+    void write_bytes([[maybe_unused]] t_field_tag tag, std::string_view bytes)
+    {
+        _size += field_header_size + bytes.size();
+    }
+
+    void finish() { _size += sizeof(end_of_fields_tag); }
+
+    /**
+     * @brief Number of bytes of the record
+     */
+    size_t size() const { return _size; }
+};
+
+/**
+ * @brief Index of a tagged field record for lazy reading
+ *
+ * Reading a record only parses the field headers: payloads are not decoded until a field is
+ * requested, and fields that are unknown to the reader are skipped. from_cursor borrows the
+ * payloads from the cursor buffer (zero copy), from_stream copies the requested payloads.
+ */
+class TaggedFields
+{
+    struct Field
+    {
+        t_field_tag tag;
+        size_t      offset; ///< offset of the payload in the buffer
+        size_t      size;
+    };
+
+    std::string_view   _borrowed; ///< buffer of from_cursor (owned by the caller)
+    std::string        _storage;  ///< payloads read by from_stream
+    bool               _owning = false;
+    std::vector<Field> _fields;
+
+    std::string_view buffer() const
+    {
+        return _owning ? std::string_view(_storage) : _borrowed;
+    }
+
+    const Field* find(t_field_tag tag) const
+    {
+        auto it = std::find_if(
+            _fields.begin(), _fields.end(), [tag](const Field& field) { return field.tag == tag; });
+        return it == _fields.end() ? nullptr : &(*it);
+    }
+
+    const Field& get(t_field_tag tag, std::string_view function) const
+    {
+        const Field* field = find(tag);
+        if (!field)
+            throw std::runtime_error(fmt::format(
+                "ERROR[TaggedFields::{}]: field {} is missing in the record", function, tag));
+
+        return *field;
+    }
+
+  public:
+    TaggedFields() = default;
+
+    /**
+     * @brief Index a record written with TaggedFieldWriter (zero copy)
+     *
+     * The cursor is moved behind the record. The buffer of the cursor must outlive the returned
+     * object.
+     */
+    static TaggedFields from_cursor(ByteCursor& cursor)
+    {
+        TaggedFields fields;
+        fields._borrowed = cursor.buffer();
+
+        for (auto tag = cursor.read<t_field_tag>(); tag != end_of_fields_tag;
+             tag      = cursor.read<t_field_tag>())
+        {
+            const auto size = cursor.read<uint64_t>();
+            if (size > cursor.remaining())
+                throw std::runtime_error(fmt::format(
+                    "ERROR[TaggedFields::from_cursor]: field {} ({} bytes) exceeds the remaining "
+                    "buffer ({} bytes)",
+                    tag,
+                    size,
+                    cursor.remaining()));
+
+            fields._fields.push_back(Field{ tag, cursor.position(), size_t(size) });
+            cursor.skip(size);
+        }
+
+        return fields;
+    }
+
+    /**
+     * @brief Read a record written with TaggedFieldWriter from a stream
+     *
+     * @param tags fields to read, other fields are skipped without copying them (empty: read
+     * all fields)
+     */
+    static TaggedFields from_stream(std::istream& is, std::initializer_list<t_field_tag> tags = {})
+    {
+        TaggedFields fields;
+        fields._owning = true;
+
+        const auto read = [&is](void* destination, size_t bytes) {
+            is.read(static_cast<char*>(destination), static_cast<std::streamsize>(bytes));
+            if (!is)
+                throw std::runtime_error(
+                    "ERROR[TaggedFields::from_stream]: unexpected end of stream");
+        };
+
+        // payloads are read (or skipped) in blocks, so a corrupt payload size fails at the end of
+        // the stream instead of allocating size bytes up front
+        constexpr uint64_t block_size = uint64_t(16) * 1024 * 1024;
+
+        while (true)
+        {
+            t_field_tag tag;
+            read(&tag, sizeof(tag));
+            if (tag == end_of_fields_tag)
+                break;
+
+            uint64_t size;
+            read(&size, sizeof(size));
+
+            if (tags.size() > 0 && std::find(tags.begin(), tags.end(), tag) == tags.end())
+            {
+                for (uint64_t skipped = 0; skipped < size; skipped += block_size)
+                {
+                    const uint64_t bytes = std::min(block_size, size - skipped);
+                    is.ignore(static_cast<std::streamsize>(bytes));
+                    if (uint64_t(is.gcount()) != bytes)
+                        throw std::runtime_error(
+                            "ERROR[TaggedFields::from_stream]: unexpected end of stream");
+                }
+                continue;
+            }
+
+            const size_t offset = fields._storage.size();
+            for (uint64_t stored = 0; stored < size; stored += block_size)
+            {
+                const size_t bytes = size_t(std::min(block_size, size - stored));
+                fields._storage.resize(offset + stored + bytes);
+                read(fields._storage.data() + offset + stored, bytes);
+            }
+            fields._fields.push_back(Field{ tag, offset, size_t(size) });
+        }
+
+        return fields;
+    }
+
+    // ----- field access -----
+    bool has(t_field_tag tag) const { return find(tag) != nullptr; }
+
+    /**
+     * @brief Tags of all indexed fields (in the order they were written)
+     */
+    std::vector<t_field_tag> get_tags() const
+    {
+        std::vector<t_field_tag> tags;
+        tags.reserve(_fields.size());
+        for (const auto& field : _fields)
+            tags.push_back(field.tag);
+        return tags;
+    }
+
+    /**
+     * @brief Payload of a field (zero copy)
+     *
+     * @throws std::runtime_error if the field is missing
+     */
+    std::string_view get_bytes(t_field_tag tag) const
+    {
+        const auto& field = get(tag, "get_bytes");
+        return buffer().substr(field.offset, field.size);
+    }
+
+    /**
+     * @brief Cursor over the payload of a field (e.g. to read a nested object with from_cursor)
+     */
+    ByteCursor get_cursor(t_field_tag tag) const { return ByteCursor(get_bytes(tag)); }
+
+    /**
+     * @brief Read a value field written with TaggedFieldWriter::write_value
+     *
+     * @throws std::runtime_error if the field is missing or does not have sizeof(T) bytes
+     */
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    T read_value(t_field_tag tag) const
+    {
+        const auto& field = get(tag, "read_value");
+        if (field.size != sizeof(T))
+            throw std::runtime_error(
+                fmt::format("ERROR[TaggedFields::read_value]: field {} has {} bytes, expected {}",
+                            tag,
+                            field.size,
+                            sizeof(T)));
+
+        ByteCursor cursor(buffer().substr(field.offset, field.size));
+        return cursor.read<T>();
+    }
+
+    /**
+     * @brief Read an optional value field (default_value if the field is missing, e.g. records
+     * written before the field was added)
+     */
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    T read_value(t_field_tag tag, T default_value) const
+    {
+        return has(tag) ? read_value<T>(tag) : default_value;
+    }
+
+    /**
+     * @brief Borrow a container field written with TaggedFieldWriter::write_container
+     */
+    template<typename T>
+    ContainerView<T> read_container_view(t_field_tag tag) const
+    {
+        auto cursor = get_cursor(tag);
+        auto view   = cursor.read_container_view<T>();
+        cursor.check_at_end();
+        return view;
+    }
+
+    /**
+     * @brief Read a container field into an owning container (single memcpy)
+     *
+     * Values that are not trivially copyable but written bytewise by write_container (e.g.
+     * Eigen::Quaternion) can not be borrowed, they are copied as stream::container_from_stream
+     * does.
+     */
+    template<typename T_container>
+    T_container read_container(t_field_tag tag) const
+    {
+        using T_value = typename T_container::value_type;
+
+        if constexpr (std::is_trivially_copyable_v<T_value>)
+            return read_container_view<T_value>(tag).template to<T_container>();
+        else
+        {
+            auto         cursor = get_cursor(tag);
+            const size_t size   = cursor.read<size_t>();
+            const auto   bytes  = cursor.read_bytes(cursor.remaining());
+            if (bytes.size() % sizeof(T_value) != 0 || bytes.size() / sizeof(T_value) != size)
+                throw std::runtime_error(
+                    fmt::format("ERROR[TaggedFields::read_container]: field {} has {} payload "
+                                "bytes, expected {} values of {} bytes",
+                                tag,
+                                bytes.size(),
+                                size,
+                                sizeof(T_value)));
+
+            T_container container;
+            container.resize(size);
+            if (size > 0)
+                std::memcpy(static_cast<void*>(container.data()), bytes.data(), bytes.size());
+            return container;
+        }
+    }
+};
+
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
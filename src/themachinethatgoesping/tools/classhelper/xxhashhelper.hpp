@@ -12,6 +12,14 @@
 /* generated doc strings */
 #include ".docstrings/xxhashhelper.doc.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
 #include <boost/iostreams/concepts.hpp> // sink
 #include <boost/iostreams/stream.hpp>
 
@@ -49,28 +57,225 @@ class XXHashSink : public boost::iostreams::sink
     xxh::hash_t<64> hash() { return _hash_state.digest(); }
 };
 
+namespace themachinethatgoesping {
+namespace tools {
+namespace classhelper {
+
+/// containers larger than this are serialized (compressed encoding) in independently encoded
+/// and hashed chunks, see stream::chunked_container_to_stream
+inline constexpr size_t hash_chunk_bytes = size_t(1) << 20;
+
+/**
+ * @brief Number of elements per hash (and serialization) chunk for value type T_value
+ */
+template<typename T_value>
+constexpr size_t hash_chunk_elements()
+{
+    return std::max<size_t>(1, hash_chunk_bytes / sizeof(T_value));
+}
+
+/**
+ * @brief xxhash3 of each hash_chunk_elements sized chunk of a container
+ *
+ * These hashes verify the chunks of the chunked payload. They are not part of binary_hash.
+ *
+ * @param mp_cores Number of cores to use for parallelization
+ */
+template<typename T_container>
+std::vector<uint64_t> chunk_hashes(const T_container& container, int mp_cores = 1)
+{
+    using T_value               = typename T_container::value_type;
+    const size_t chunk_elements = hash_chunk_elements<T_value>();
+    const size_t n_chunks       = (container.size() + chunk_elements - 1) / chunk_elements;
+
+    std::vector<uint64_t> hashes(n_chunks);
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1)
+    for (int64_t i = 0; i < int64_t(n_chunks); ++i)
+    {
+        const size_t begin = size_t(i) * chunk_elements;
+        const size_t size  = std::min(chunk_elements, container.size() - begin);
+        hashes[i]          = xxh::xxhash3<64>(container.data() + begin, size * sizeof(T_value));
+    }
+
+    return hashes;
+}
+
+/**
+ * @brief Hashing visitor that feeds the binary representation of an object directly into a
+ * xxhash3 state
+ *
+ * The update functions mirror the stream functions (classhelper::write_version,
+ * stream::container_to_stream, ...). A hash_to(BinaryHasher&) implementation that visits the
+ * same bytes in the same order as to_stream produces the same hash as the stream based
+ * binary_hash, without serializing the object (binary_hash == xxhash3(to_binary()) also holds
+ * for large containers).
+ */
+class BinaryHasher
+{
+    xxh::hash3_state_t<64> _state;
+
+  public:
+    void update(const void* data, size_t bytes) { _state.update(data, bytes); }
+
+    /**
+     * @brief Same bytes as classhelper::write_version
+     */
+    void update_version(std::string_view name) { update(name.data(), name.size()); }
+
+    /**
+     * @brief Hash the object representation of value (sizeof(T) bytes)
+     */
+    template<typename T>
+    void update_value(const T& value)
+    {
+        update(&value, sizeof(T));
+    }
+
+    /**
+     * @brief Same bytes as stream::container_to_stream (size followed by the data span)
+     */
+    template<typename T_container>
+    void update_container(const T_container& container)
+    {
+        const size_t size = container.size();
+        update_value(size);
+        update(container.data(), size * sizeof(typename T_container::value_type));
+    }
+
+    xxh::hash_t<64> digest() { return _state.digest(); }
+};
+
+/**
+ * @brief Memoized binary_hash, must be invalidated whenever the hashed data changes
+ *
+ * Copies keep the cached hash (the copied data is identical). Concurrent reads of a valid cache
+ * are safe, invalidation must not run concurrently with reads.
+ */
+class HashCache
+{
+    mutable std::atomic<bool>     _valid = false;
+    mutable std::atomic<uint64_t> _hash  = 0;
+
+  public:
+    HashCache() = default;
+    HashCache(const HashCache& other)
+        : _valid(other._valid.load(std::memory_order_acquire))
+        , _hash(other._hash.load(std::memory_order_relaxed))
+    {
+    }
+    HashCache& operator=(const HashCache& other)
+    {
+        _hash.store(other._hash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        _valid.store(other._valid.load(std::memory_order_acquire), std::memory_order_release);
+        return *this;
+    }
+
+    /**
+     * @brief Return the cached hash or compute (and cache) it
+     *
+     * @param compute callable that returns the hash
+     */
+    template<typename T_compute>
+    xxh::hash_t<64> get(T_compute&& compute) const
+    {
+        if (_valid.load(std::memory_order_acquire))
+            return _hash.load(std::memory_order_relaxed);
+
+        const xxh::hash_t<64> hash = compute();
+        _hash.store(hash, std::memory_order_relaxed);
+        _valid.store(true, std::memory_order_release);
+        return hash;
+    }
+
+    /**
+     * @brief Store a hash that was computed elsewhere (e.g. while serializing the object)
+     */
+    void set(xxh::hash_t<64> hash) const
+    {
+        _hash.store(hash, std::memory_order_relaxed);
+        _valid.store(true, std::memory_order_release);
+    }
+
+    void invalidate() { _valid.store(false, std::memory_order_release); }
+    bool is_valid() const { return _valid.load(std::memory_order_acquire); }
+};
+
+/**
+ * @brief True if T_class implements void hash_to(BinaryHasher&) const
+ */
+template<typename T_class>
+concept has_hash_to = requires(const T_class& obj, BinaryHasher& hasher) { obj.hash_to(hasher); };
+
+/**
+ * @brief True if T_class provides a memoized hash (const HashCache& get_binary_hash_cache() const)
+ */
+template<typename T_class>
+concept has_binary_hash_cache = requires(const T_class& obj) {
+    { obj.get_binary_hash_cache() } -> std::same_as<const HashCache&>;
+};
+
+/**
+ * @brief Compute the binary_hash of an object using hash_to (used by binary_hash)
+ *
+ * If the object provides a HashCache (get_binary_hash_cache), the hash is memoized.
+ */
+template<typename T_class>
+xxh::hash_t<64> binary_hash_of(const T_class& obj)
+{
+    auto compute = [&obj]() {
+        BinaryHasher hasher;
+        obj.hash_to(hasher);
+        return hasher.digest();
+    };
+
+    if constexpr (has_binary_hash_cache<T_class>)
+        return obj.get_binary_hash_cache().get(compute);
+    else
+        return compute();
+}
+
+} // namespace classhelper
+} // namespace tools
+} // namespace themachinethatgoesping
+
 #define __BINARY_HASH_NOT_CONST__                                                                  \
     /** @brief compute a 64 bit hash of the object using xxhash and the to_binary function.        \
-     * This function is called binary because the to_binary function object is used                \
+     * This function is called binary because the to_binary function of the object is used.        \
+     * If the class implements hash_to(BinaryHasher&), the data is fed directly into the hash      \
+     * state (same result, no serialization through a stream).                                     \
      */                                                                                            \
     xxh::hash_t<64> binary_hash()                                                                  \
     {                                                                                              \
-        xxh::hash3_state_t<64>               hash;                                                 \
-        boost::iostreams::stream<XXHashSink> stream(hash);                                         \
-        this->to_stream(stream);                                                                   \
-        stream.flush();                                                                            \
-        return hash.digest();                                                                      \
-    }                        
-
-#define __BINARY_HASH__  /** @brief compute a 64 bit hash of the object using xxhash and the       \
-                          * to_binary function. This  function is called binary because the        \
-                          * to_binary  function of the object is used */                           \
+        using t_this_class = std::remove_cvref_t<decltype(*this)>;                                 \
+        if constexpr (themachinethatgoesping::tools::classhelper::has_hash_to<t_this_class>)       \
+            return themachinethatgoesping::tools::classhelper::binary_hash_of(*this);              \
+        else                                                                                       \
+        {                                                                                          \
+            xxh::hash3_state_t<64>               hash;                                             \
+            boost::iostreams::stream<XXHashSink> stream(hash);                                     \
+            this->to_stream(stream);                                                               \
+            stream.flush();                                                                        \
+            return hash.digest();                                                                  \
+        }                                                                                          \
+    }
+
+#define __BINARY_HASH__                                                                            \
+    /** @brief compute a 64 bit hash of the object using xxhash and the to_binary function.        \
+     * This function is called binary because the to_binary function of the object is used.        \
+     * If the class implements hash_to(BinaryHasher&), the data is fed directly into the hash      \
+     * state (same result, no serialization through a stream).                                     \
+     */                                                                                            \
     xxh::hash_t<64> binary_hash() const                                                            \
     {                                                                                              \
-        xxh::hash3_state_t<64>               hash;                                                 \
-        boost::iostreams::stream<XXHashSink> stream(hash);                                         \
-        this->to_stream(stream);                                                                   \
-        stream.flush();                                                                            \
-        return hash.digest();                                                                      \
-    }                                                                                              \
-
+        using t_this_class = std::remove_cvref_t<decltype(*this)>;                                 \
+        if constexpr (themachinethatgoesping::tools::classhelper::has_hash_to<t_this_class>)       \
+            return themachinethatgoesping::tools::classhelper::binary_hash_of(*this);              \
+        else                                                                                       \
+        {                                                                                          \
+            xxh::hash3_state_t<64>               hash;                                             \
+            boost::iostreams::stream<XXHashSink> stream(hash);                                     \
+            this->to_stream(stream);                                                               \
+            stream.flush();                                                                        \
+            return hash.digest();                                                                  \
+        }                                                                                          \
+    }
@@ -1,4 +1,4 @@
-//sourcehash: cc01378feaafa8dc49e210ebad029ebdebf0aed69d5983770a2ec2fdf6d8fe59
+//sourcehash: 541acdcca3e8afdc16922f7644640626742f5a2118bff76fe5a5d3c1f08a53d6
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -41,10 +41,24 @@
 #endif
 
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_IndexSlice =
+R"doc(Half-open index range [start, stop) into a container (python slice
+semantics))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_IndexSlice_operator_eq = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_IndexSlice_size = R"doc(Number of elements within the slice)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_IndexSlice_start = R"doc(< first index of the slice)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_IndexSlice_stop = R"doc(< one past the last index of the slice)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_Range = R"doc(Structure representing a continuous range/section)doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_helper_Range_Range = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_Range_Range_2 = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_Range_contains = R"doc(Check if a value is within this range)doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_helper_Range_intersection =
@@ -58,6 +72,8 @@ static const char *mkd_doc_themachinethatgoesping_tools_helper_Range_max = R"doc
 
 static const char *mkd_doc_themachinethatgoesping_tools_helper_Range_min = R"doc(Minimum value of the range (inclusive))doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_Range_operator_eq = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_Range_overlaps = R"doc(Check if this range overlaps with another)doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_helper_get_sections =
@@ -83,6 +99,57 @@ Returns:
 @note The data must be sorted in ascending order. Behavior is
 undefined for unsorted input.)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_get_shared_section_mask =
+R"doc(Get a boolean mask of the values that fall within the shared sections
+
+Args:
+    containers: Vector of containers, each must be sorted in ascending
+                order
+    max_gap: Maximum allowed gap between consecutive values in any
+             container. If <= 0 or NaN, defaults to only considering
+             container boundaries.
+    mp_cores: Number of threads used to process the containers in
+              parallel
+
+Template Args:
+    T: Container type (must support .size() and element access,
+       contain floating point values)
+
+Returns:
+    std::vector<xt::xtensor<bool, 1>> One mask (same size as the
+        container) per input container
+
+@note All containers must be sorted in ascending order. Behavior is
+undefined for unsorted input.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_get_shared_section_slices =
+R"doc(Get the index slices of the shared sections for each container
+
+For every container one IndexSlice [start, stop) is returned per
+shared section (in the order of get_shared_sections, slices may be
+empty). The slices describe the same elements as
+get_shared_section_indices, without materializing an index array.
+
+Args:
+    containers: Vector of containers, each must be sorted in ascending
+                order
+    max_gap: Maximum allowed gap between consecutive values in any
+             container. If <= 0 or NaN, defaults to only considering
+             container boundaries.
+    mp_cores: Number of threads used to process the containers in
+              parallel
+
+Template Args:
+    T: Container type (must support .size() and element access,
+       contain floating point values)
+
+Returns:
+    std::vector<std::vector<IndexSlice>> One list of slices per input
+        container
+
+@note All containers must be sorted in ascending order. Behavior is
+undefined for unsorted input.)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_get_shared_section_values =
 R"doc(Get values that fall within the shared sections (flattened)
 
@@ -91,12 +158,18 @@ container containing all unique values from any container that fall
 within shared sections. This is useful when you need a common set of
 values for interpolation or alignment.
 
+The values are combined with a k-way merge (removing duplicates on the
+fly). With mp_cores > 1 the containers are merged pairwise as a
+balanced tree in parallel.
+
 Args:
     containers: Vector of containers, each must be sorted in ascending
                 order
     max_gap: Maximum allowed gap between consecutive values in any
              container. If <= 0 or NaN, defaults to only considering
              container boundaries.
+    mp_cores: Number of threads used for the shared sections and the
+              tree merge (1 = sequential k-way merge)
 
 Template Args:
     T: Container type (must support .size() and element access,
@@ -123,6 +196,9 @@ Args:
     max_gap: Maximum allowed gap between consecutive values in any
              container. If <= 0 or NaN, defaults to checking only
              container boundaries.
+    mp_cores: Number of threads. With mp_cores > 1 the sections of the
+              containers are computed in parallel and intersected as a
+              balanced tree.
 
 Template Args:
     T: Container type (must support .size() and element access,
@@ -135,6 +211,20 @@ Returns:
 @note All containers must be sorted in ascending order. Behavior is
 undefined for unsorted input.)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_intersect_sections =
+R"doc(Intersect two sorted lists of non-overlapping sections
+
+Template Args:
+    T: Floating point type of the ranges
+
+Args:
+    ranges1: First list of sections, sorted in ascending order
+    ranges2: Second list of sections, sorted in ascending order
+
+Returns:
+    std::vector<Range<T>> Sorted list of the ranges covered by both
+        lists)doc";
+
 #if defined(__GNUG__)
 #pragma GCC diagnostic pop
 #endif
@@ -1,4 +1,4 @@
-//sourcehash: a503af385c9978417d8310c7e05ee6005230953b122ed47e4c49c873ac4f646d
+//sourcehash: f9cb319a7e7e548d78c1b90710a88d031c4818612d35988f5341831d13c53103
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -41,6 +41,25 @@
 #endif
 
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_gather =
+R"doc(Gather values at the given indices (e.g. the indices returned by
+get_index_downsampling)
+
+For N dimensional tensors the gather is done along the first axis
+(whole rows are copied), so multiple channels that share the first
+axis with the downsampled data can be gathered with the same indices.
+
+Template Args:
+    T: Container type: std::vector or a contiguous, row major xtensor
+
+Args:
+    data: Container of values (or rows)
+    indices: Indices into the first axis of data
+
+Returns:
+    xt::xtensor<T::value_type, N> with shape (indices.size(),
+    data.shape()[1:]...))doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_get_index_downsampling =
 R"doc(Compute indices for downsampling a sorted data container
 
@@ -65,6 +84,10 @@ Args:
              encountered, sampling restarts after the gap. If <= 0 or
              NaN, defaults to 2x downsample_interval (or 10 if no
              downsampling)
+    mp_cores: Number of threads. The gap separated segments are
+              sampled independently, so only data with gaps is
+              processed in parallel. The result is identical to the
+              single threaded result.
 
 Template Args:
     T: Container type (must support .size() and element access,
@@ -76,6 +99,84 @@ Returns:
 @note The data must be sorted in ascending order. Behavior is
 undefined for unsorted input.)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_get_lttb_downsampling =
+R"doc(Largest-Triangle-Three-Buckets (LTTB) downsampling of a sorted x / y
+series
+
+The first and the last value of each gap free segment are buckets of
+their own and are always kept. The values in between are split into
+buckets like in get_minmax_downsampling. For every bucket, the value
+that spans the largest triangle with the previously selected value and
+the average of the next bucket (the last value of the segment for the
+last bucket) is kept (one value per bucket). This preserves the visual
+shape of the series.
+
+Args:
+    x: Container of x values, must be sorted in ascending order
+    y: Container of y values (same size as x)
+    downsample_interval: Bucket width in x units. Use 0, negative, or
+                         NaN to disable downsampling (return all
+                         indices)
+    max_gap: Maximum allowed gap in x before considering it a data
+             gap. If <= 0 or NaN, defaults to 2x downsample_interval
+
+Template Args:
+    TX: Container type of x (floating point values with .data())
+    TY: Container type of y (floating point values with .data())
+
+Returns:
+    xt::xtensor<size_t, 1> containing indices of values to keep)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_get_mean_downsampling =
+R"doc(Mean downsampling of a sorted x / y series
+
+The x values are split into buckets like in get_minmax_downsampling.
+For each non empty bucket the mean x and the mean y value are returned
+(NaN y values are ignored, a bucket with only NaN y values has a NaN
+mean).
+
+Args:
+    x: Container of x values, must be sorted in ascending order
+    y: Container of y values (same size as x)
+    downsample_interval: Bucket width in x units. Use 0, negative, or
+                         NaN to disable downsampling (return copies)
+    max_gap: Maximum allowed gap in x before considering it a data
+             gap. If <= 0 or NaN, defaults to 2x downsample_interval
+
+Template Args:
+    TX: Container type of x (floating point values with .data())
+    TY: Container type of y (floating point values with .data())
+
+Returns:
+    std::tuple of the mean x values and the mean y values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_get_minmax_downsampling =
+R"doc(Min/max (envelope) downsampling of a sorted x / y series
+
+The x values are split into buckets of width downsample_interval
+(aligned to the first value of each gap free segment). For each non
+empty bucket the indices of the minimum and the maximum y value are
+returned (in ascending order, once if they are the same), so that
+spikes are preserved. Gaps larger than max_gap are never bridged by a
+bucket.
+
+Args:
+    x: Container of x values, must be sorted in ascending order
+    y: Container of y values (same size as x). NaN values are only
+       selected if a bucket contains no other values
+    downsample_interval: Bucket width in x units. Use 0, negative, or
+                         NaN to disable downsampling (return all
+                         indices)
+    max_gap: Maximum allowed gap in x before considering it a data
+             gap. If <= 0 or NaN, defaults to 2x downsample_interval
+
+Template Args:
+    TX: Container type of x (floating point values with .data())
+    TY: Container type of y (floating point values with .data())
+
+Returns:
+    xt::xtensor<size_t, 1> containing indices of values to keep)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_get_value_downsampling =
 R"doc(Downsample a sorted data container and return the downsampled values
 
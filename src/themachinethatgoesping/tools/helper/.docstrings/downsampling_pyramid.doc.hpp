@@ -0,0 +1,150 @@
+//sourcehash: ef0a4437b64e51161741e2de10a5fb88538884b371d5875607978a1a7d7b6e35
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid =
+R"doc(Multi-resolution gap index of a sorted series for fast
+get_value_downsampling queries
+
+Level k stores the positions of all gaps larger than 2 * base_interval
+* 2^k (the default max_gap of downsample_interval = base_interval *
+2^k). A query is answered from the coarsest level whose gaps are a
+superset of the gaps of the requested max_gap, so its cost is
+proportional to the output size plus the number of gaps in that level,
+independent of the data size. The result is identical to
+helper::get_value_downsampling(data, ...).
+
+The pyramid does not store the data itself. Queries must pass the same
+(unchanged) data that was used for building the pyramid.
+
+Template Args:
+    T: floating point type of the data values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramidCache =
+R"doc(Lazily built DownsamplingPyramid, must be invalidated whenever the data
+changes
+
+get() builds the pyramid on the first call and is safe to call
+concurrently (e.g. from const methods that are called from several
+threads). The returned pyramid is immutable and stays valid after
+invalidate(). Copies share the built pyramid (the copied data is
+identical). Invalidation must not run concurrently with reads of the
+data.
+
+Template Args:
+    T: floating point type of the data values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramidCache_DownsamplingPyramidCache = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramidCache_DownsamplingPyramidCache_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramidCache_get =
+R"doc(Return the cached pyramid or build (and cache) it for data
+
+The pyramid is rebuilt if the cached pyramid was built for data of a
+different size.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramidCache_get_cached =
+R"doc(Cached pyramid (nullptr if it is not built))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramidCache_invalidate = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramidCache_mutex = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramidCache_operator_assign = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramidCache_pyramid = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid_DownsamplingPyramid =
+R"doc(Build the pyramid for sorted data (O(n) for the first level, levels
+above are filtered from the level below)
+
+Args:
+    data: sorted data values (e.g. the x values of an interpolator)
+    base_interval: finest downsample interval of the pyramid (must be >
+                   0 and finite)
+    n_levels: number of levels (intervals base_interval * 2^k, k = 0 ..
+              n_levels - 1))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid_base_interval = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid_get_base_interval = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid_get_level_gaps =
+R"doc(Gap positions (index of the first value after the gap) of a level)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid_get_level_max_gap =
+R"doc(Gaps of a level are all gaps larger than this value)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid_get_number_of_levels = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid_get_value_downsampling =
+R"doc(Same result as helper::get_value_downsampling(data,
+downsample_interval, max_gap)
+
+Falls back to helper::get_value_downsampling if max_gap is smaller
+than the max_gap of the finest level or if data does not have the size
+of the data used for building the pyramid.
+
+Args:
+    data: the data the pyramid was built for
+    downsample_interval: Interval between samples. Use 0, negative, or
+                         NaN to disable downsampling (copy all values)
+    max_gap: Maximum allowed gap before considering it a data gap. If
+             <= 0 or NaN, defaults to 2x downsample_interval
+
+Returns:
+    xt::xtensor<T, 1> downsampled values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid_levels =
+R"doc(gap positions (index after the gap) per level)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid_size =
+R"doc(Size of the data the pyramid was built for)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_DownsamplingPyramid_size_2 = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -1,4 +1,4 @@
-//sourcehash: 72854a1005166d139ee9fcbad428ce0b5ec74f1f00981624af0ea233697e5242
+//sourcehash: 66da6e31af931e744efc5a5ee29da070d41d9584f1a371cb29189c751f871757
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -64,6 +64,12 @@ https://stackoverflow.com/a/46069245)doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_helper_isviewstream_isviewstream = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_isviewstream_read_direct =
+R"doc(Same as read, but without going through the (virtual) std::streambuf
+interface. Sets failbit and eofbit if the end of the view is reached
+before count bytes are read, and only failbit if the stream was not
+good before (same as std::istream::read).)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_sviewbuf =
 R"doc(string_view-compatible buffer for reading read-only characters from
 memory. Implements a buffer based on stackoverflow discussions.
@@ -86,6 +92,13 @@ $See also:
 
 https://stackoverflow.com/a/46069245)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_sviewbuf_read_direct =
+R"doc(Read without going through the (virtual) std::streambuf interface.
+
+Returns:
+    number of bytes read (smaller than count if the end of the view
+    is reached))doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_sviewbuf_seekoff = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_helper_sviewbuf_seekpos = R"doc()doc";
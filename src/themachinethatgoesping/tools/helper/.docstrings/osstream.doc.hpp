@@ -1,4 +1,4 @@
-//sourcehash: ba1ce42f6a50be007d53e411df309e7d09d34ae0172e85ba78096b9981e92a01
+//sourcehash: 2c3da2478f8a5d98cf5967978dca06671e97dc50f8388a55fb0cc06fa62275a8
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -41,6 +41,24 @@
 #endif
 
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_has_write_direct =
+R"doc(True if T_ostream is (derived from) osstream or ospanstream.
+Serialization code that knows the static stream type can then call
+write_direct instead of std::ostream::write.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_ospanstream =
+R"doc(A std::ostream that writes into a caller-owned, fixed size buffer without
+allocating. The stream state is set to bad if the data does not fit.
+
+Usage: ospanstream os(std::span<char>(data, size)); obj.to_stream(os); if
+(!os) ... // buffer too small)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_ospanstream_ospanstream = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_ospanstream_write_direct =
+R"doc(Write without going through the (virtual) std::streambuf interface (sets
+badbit if the data does not fit).)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_osstream =
 R"doc(A fast std::ostream that writes directly into a caller-owned
 std::string. Drop-in replacement for std::ostringstream in
@@ -53,6 +71,29 @@ Usage:
 
 static const char *mkd_doc_themachinethatgoesping_tools_helper_osstream_osstream = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_span_output_buf =
+R"doc(std::streambuf implementation that writes into a caller-owned, fixed size
+buffer (e.g. a shared memory segment or a memory mapped file region).
+Writing past the end of the buffer writes nothing and is reported as a
+failed write (the stream sets badbit).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_span_output_buf_buffer = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_span_output_buf_overflow = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_span_output_buf_pos = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_span_output_buf_size = R"doc(Number of bytes written.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_span_output_buf_span_output_buf = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_span_output_buf_write_direct =
+R"doc(Write without going through the (virtual) std::streambuf interface.
+Returns false (and writes nothing) if the data does not fit into the
+buffer.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_span_output_buf_xsputn = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_string_output_buf =
 R"doc(std::streambuf implementation that writes into a caller-owned
     std::string.
@@ -74,6 +115,9 @@ static const char *mkd_doc_themachinethatgoesping_tools_helper_string_output_buf
 
 static const char *mkd_doc_themachinethatgoesping_tools_helper_string_output_buf_string_output_buf = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_helper_string_output_buf_write_direct =
+R"doc(Write without going through the (virtual) std::streambuf interface.)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_helper_string_output_buf_xsputn = R"doc()doc";
 
 #if defined(__GNUG__)
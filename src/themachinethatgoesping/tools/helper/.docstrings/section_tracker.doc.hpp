@@ -0,0 +1,160 @@
+//sourcehash: bded8c28832dea80973b3c919d0c1626fc56b8e68b8ffe8bea771b803009cc9a
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker =
+R"doc(Track the gap separated sections of an append only, sorted series of
+values
+
+Appending a chunk costs O(chunk): only the last (open) section is
+extended or new sections are started. At any point get_sections()
+returns the same sections as
+helper::get_sections(all_appended_values, max_gap).
+
+Template Args:
+    T: floating point type of the tracked values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_SectionTracker =
+R"doc(Construct a new Section Tracker object
+
+Args:
+    max_gap: Maximum allowed gap between consecutive values before
+             starting a new section. If <= 0 or NaN, all values are
+             part of a single section.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_append =
+R"doc(Append a single value (must not be smaller than the last appended
+value))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_binary_size =
+R"doc(Number of bytes to_stream writes (used by to_binary to allocate the result
+once))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_clear = R"doc(Reset the tracker (keeps max_gap))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_empty = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_extend =
+R"doc(Append a sorted chunk of values (O(chunk))
+
+The chunk is checked before it is appended: if it is not sorted,
+contains NaN or starts below the last appended value, nothing is
+appended.
+
+Template Args:
+    t_container: Container type (must support .size() and element
+                 access)
+
+Args:
+    values: values to append, sorted in ascending order)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_from_cursor =
+R"doc(Same as from_stream, but reads directly from a buffer (used by
+from_binary))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_from_fields = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_from_stream =
+R"doc(Read a tracker written with to_stream)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_get_max_gap = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_get_open_section =
+R"doc(The open (last) section
+
+Returns:
+    const Range<T>&)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_get_sections =
+R"doc(All sections (the last one is the open section that may still grow))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_get_shared_sections =
+R"doc(Intersect the sections of this tracker with the sections of another
+tracker)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_get_shared_sections_2 =
+R"doc(Intersect the sections of multiple trackers (same result as
+helper::get_shared_sections on the appended values))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_hash_to =
+R"doc(Feed the binary representation (same bytes as to_stream) into a hashing
+visitor (used by binary_hash)
+
+Args:
+    hasher: hashing visitor)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_is_gap =
+R"doc(same gap criterion as helper::get_sections (max_gap <= 0 or NaN: no
+gaps))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_operator_eq = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_size = R"doc(Number of values appended so far)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_t_field =
+R"doc(field tags of the SectionTracker_V2 layout (never reuse a tag for a
+different field))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_t_field_field_max_gap = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_t_field_field_sections = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_t_field_field_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_to_stream =
+R"doc(Write the tracker as tagged fields (SectionTracker_V2, see
+classhelper::TaggedFieldWriter): readers skip fields they do not know,
+so fields can be added without breaking existing files
+
+Template parameter ``T_ostream``:
+    static stream type (to_binary passes helper::osstream, which is
+    written without the std::streambuf interface))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_helper_SectionTracker_visit_fields =
+R"doc(write all fields to a TaggedFieldWriter, TaggedFieldHasher or
+TaggedFieldSizer)doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -11,9 +11,14 @@
 
 #include <algorithm>
 #include <cmath>
-#include <set>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <utility>
 #include <vector>
 
+#include "../math/simd.hpp"
+
 namespace themachinethatgoesping {
 namespace tools {
 namespace helper {
@@ -28,33 +33,342 @@ inline bool is_valid_gap(double max_gap)
 }
 
 /**
- * @brief Helper to intersect two vectors of ranges
+ * @brief Intersect a list of section lists as a balanced tree (pairwise, one parallel loop per
+ * tree level)
+ */
+template<typename value_type>
+std::vector<Range<value_type>> intersect_sections_tree(
+    std::vector<std::vector<Range<value_type>>>&& all_sections,
+    int                                           mp_cores)
+{
+    while (all_sections.size() > 1)
+    {
+        std::vector<std::vector<Range<value_type>>> next((all_sections.size() + 1) / 2);
+
+#pragma omp parallel for num_threads(mp_cores)
+        for (int64_t p = 0; p < int64_t(next.size()); ++p)
+        {
+            if (size_t(2 * p + 1) < all_sections.size())
+                next[p] = intersect_sections(all_sections[2 * p], all_sections[2 * p + 1]);
+            else
+                next[p] = std::move(all_sections[2 * p]);
+        }
+
+        all_sections = std::move(next);
+    }
+
+    return std::move(all_sections[0]);
+}
+
+/**
+ * @brief Index slices [start, stop) of the elements of a sorted container within each of the
+ * sorted, non-overlapping sections (one slice per section, O(S log N))
  */
 template<typename T>
-std::vector<Range<T>> intersect_ranges(const std::vector<Range<T>>& ranges1,
-                                       const std::vector<Range<T>>& ranges2)
+std::vector<IndexSlice> slices_in_sections(
+    const T&                                          container,
+    const std::vector<Range<typename T::value_type>>& sections)
 {
-    std::vector<Range<T>> result;
+    std::vector<IndexSlice> slices;
+    slices.reserve(sections.size());
+
+    const auto begin = container.begin();
+    const auto end   = container.end();
+    auto       first = begin;
+
+    for (const auto& section : sections)
+    {
+        first     = std::lower_bound(first, end, section.min);
+        auto last = std::upper_bound(first, end, section.max);
+
+        slices.push_back({ size_t(first - begin), size_t(last - begin) });
+        first = last;
+    }
+
+    return slices;
+}
+
+/**
+ * @brief Total number of elements within the slices
+ */
+inline size_t total_size(const std::vector<IndexSlice>& slices)
+{
+    size_t size = 0;
+    for (const auto& slice : slices)
+    {
+        size += slice.size();
+    }
+    return size;
+}
+
+/**
+ * @brief Cursor over the elements of a container within index slices (see slices_in_sections)
+ */
+template<typename T>
+class SliceCursor
+{
+    using value_type = typename T::value_type;
+
+    const T*                _container;
+    std::vector<IndexSlice> _slices;
+    size_t                  _slice = 0;
+    size_t                  _index = 0;
+
+  public:
+    SliceCursor(const T& container, std::vector<IndexSlice> slices)
+        : _container(&container)
+        , _slices(std::move(slices))
+    {
+        if (!_slices.empty())
+            _index = _slices.front().start;
+        seek();
+    }
+
+    bool       valid() const { return _slice < _slices.size(); }
+    value_type value() const { return static_cast<value_type>((*_container)[_index]); }
+
+    void next()
+    {
+        ++_index;
+        seek();
+    }
+
+  private:
+    /// move to the next slice if the current one is exhausted (skips empty slices)
+    void seek()
+    {
+        while (_slice < _slices.size() && _index >= _slices[_slice].stop)
+        {
+            if (++_slice < _slices.size())
+                _index = _slices[_slice].start;
+        }
+    }
+};
+
+/**
+ * @brief Return a 1D tensor with the first n values of buffer (buffer itself if it has size n)
+ *
+ * xtensor storage can not shrink without reallocating, so the n values are copied once if
+ * duplicates were dropped.
+ */
+template<typename value_type>
+xt::xtensor<value_type, 1> shrink_to(xt::xtensor<value_type, 1>&& buffer, size_t n)
+{
+    if (n == buffer.size())
+    {
+        return std::move(buffer);
+    }
+
+    xt::xtensor<value_type, 1> result = xt::empty<value_type>({ n });
+    std::copy_n(buffer.data(), n, result.data());
+    return result;
+}
+
+/**
+ * @brief Merge two sorted sequences into out, dropping duplicates. Returns the number of values
+ * written (out must hold a.size() + b.size() values).
+ */
+template<typename value_type>
+size_t merge_unique(const std::vector<value_type>& a,
+                    const std::vector<value_type>& b,
+                    value_type*                    out)
+{
+    size_t n = 0, i = 0, j = 0;
+    auto   write = [&](value_type val) {
+        if (n == 0 || out[n - 1] != val)
+        {
+            out[n++] = val;
+        }
+    };
+
+    while (i < a.size() && j < b.size())
+    {
+        if (b[j] < a[i])
+            write(b[j++]);
+        else
+            write(a[i++]);
+    }
+    for (; i < a.size(); ++i)
+        write(a[i]);
+    for (; j < b.size(); ++j)
+        write(b[j]);
+
+    return n;
+}
+
+/**
+ * @brief k-way merge (binary heap over the container cursors) of all in-section values with
+ * on-the-fly deduplication, written into a pre-sized tensor
+ */
+template<typename T>
+xt::xtensor<typename T::value_type, 1> merge_values_in_sections(
+    const std::vector<T>&                             containers,
+    const std::vector<Range<typename T::value_type>>& sections)
+{
+    using value_type = typename T::value_type;
+    using head_type  = std::pair<value_type, size_t>; // value, container
+
+    // the index slices (binary search, values are not touched) give the upper bound of the
+    // output size: number of in-section values of all containers
+    size_t                      max_size = 0;
+    std::vector<SliceCursor<T>> cursors;
+    std::vector<head_type>      heap;
+    cursors.reserve(containers.size());
+    heap.reserve(containers.size());
+
+    for (size_t c = 0; c < containers.size(); ++c)
+    {
+        auto slices = slices_in_sections(containers[c], sections);
+        max_size += total_size(slices);
 
-    for (const auto& r1 : ranges1)
+        cursors.emplace_back(containers[c], std::move(slices));
+        if (cursors.back().valid())
+        {
+            heap.emplace_back(cursors.back().value(), c);
+        }
+    }
+
+    xt::xtensor<value_type, 1> result = xt::empty<value_type>({ max_size });
+    value_type*                out    = result.data();
+    size_t                     n      = 0;
+
+    const auto later = std::greater<head_type>(); // min-heap
+    std::make_heap(heap.begin(), heap.end(), later);
+
+    while (!heap.empty())
     {
-        for (const auto& r2 : ranges2)
+        std::pop_heap(heap.begin(), heap.end(), later);
+        auto [val, c] = heap.back();
+        heap.pop_back();
+
+        if (n == 0 || out[n - 1] != val)
         {
-            if (r1.overlaps(r2))
+            out[n++] = val;
+        }
+
+        auto& cursor = cursors[c];
+        cursor.next();
+        if (cursor.valid())
+        {
+            heap.emplace_back(cursor.value(), c);
+            std::push_heap(heap.begin(), heap.end(), later);
+        }
+    }
+
+    return shrink_to(std::move(result), n);
+}
+
+/**
+ * @brief Parallel variant of merge_values_in_sections: the in-section values of each container
+ * are extracted in parallel and then merged pairwise as a balanced tree (one parallel loop per
+ * tree level). The last merge writes into the output tensor.
+ */
+template<typename T>
+xt::xtensor<typename T::value_type, 1> tree_merge_values_in_sections(
+    const std::vector<T>&                             containers,
+    const std::vector<Range<typename T::value_type>>& sections,
+    int                                               mp_cores)
+{
+    using value_type = typename T::value_type;
+
+    std::vector<std::vector<value_type>> runs(containers.size());
+
+#pragma omp parallel for num_threads(mp_cores)
+    for (int64_t c = 0; c < int64_t(containers.size()); ++c)
+    {
+        const auto& container = containers[c];
+        const auto  slices    = slices_in_sections(container, sections);
+
+        auto& run = runs[c];
+        run.resize(total_size(slices));
+        size_t n = 0;
+        for (const auto& slice : slices)
+        {
+            for (size_t i = slice.start; i < slice.stop; ++i)
             {
-                auto intersection = r1.intersection(r2);
-                if (intersection.is_valid())
+                const auto val = static_cast<value_type>(container[i]);
+                if (n == 0 || run[n - 1] != val)
                 {
-                    result.push_back(intersection);
+                    run[n++] = val;
                 }
             }
         }
+        run.resize(n);
     }
 
-    return result;
+    while (runs.size() > 2)
+    {
+        std::vector<std::vector<value_type>> merged((runs.size() + 1) / 2);
+
+#pragma omp parallel for num_threads(mp_cores)
+        for (int64_t p = 0; p < int64_t(merged.size()); ++p)
+        {
+            if (size_t(2 * p + 1) < runs.size())
+            {
+                const auto& a = runs[2 * p];
+                const auto& b = runs[2 * p + 1];
+                merged[p].resize(a.size() + b.size());
+                merged[p].resize(merge_unique(a, b, merged[p].data()));
+            }
+            else
+            {
+                merged[p] = std::move(runs[2 * p]);
+            }
+        }
+
+        runs = std::move(merged);
+    }
+
+    static const std::vector<value_type> empty_run;
+    const auto&                          a = runs[0];
+    const auto&                          b = runs.size() > 1 ? runs[1] : empty_run;
+
+    xt::xtensor<value_type, 1> result = xt::empty<value_type>({ a.size() + b.size() });
+    size_t                     n      = merge_unique(a, b, result.data());
+
+    return shrink_to(std::move(result), n);
 }
 } // anonymous namespace
 
+template<typename T>
+std::vector<Range<T>> intersect_sections(const std::vector<Range<T>>& ranges1,
+                                         const std::vector<Range<T>>& ranges2)
+{
+    // Two-pointer sweep: O(R1 + R2). After each step the range that ends first
+    // cannot overlap any later range of the other list and is skipped.
+    std::vector<Range<T>> result;
+    result.reserve(std::max(ranges1.size(), ranges2.size()));
+
+    size_t i = 0, j = 0;
+    while (i < ranges1.size() && j < ranges2.size())
+    {
+        const auto& r1 = ranges1[i];
+        const auto& r2 = ranges2[j];
+
+        if (r1.overlaps(r2))
+        {
+            auto intersection = r1.intersection(r2);
+            if (intersection.is_valid())
+            {
+                result.push_back(intersection);
+            }
+        }
+
+        // advance the range that ends first (both if they end together)
+        if (r1.max < r2.max)
+            ++i;
+        else if (r2.max < r1.max)
+            ++j;
+        else
+        {
+            ++i;
+            ++j;
+        }
+    }
+
+    return result;
+}
+
 template<typename T>
 std::vector<Range<typename T::value_type>> get_sections(const T& data, double max_gap)
 {
@@ -80,34 +394,30 @@ std::vector<Range<typename T::value_type>> get_sections(const T& data, double ma
         return sections;
     }
 
-    // Find sections by detecting gaps
-    value_type section_start = static_cast<value_type>(data[0]);
-    value_type prev_value    = section_start;
+    // Find sections by detecting gaps (SIMD, differences are computed in value_type)
+    const value_type* values = data.data();
+    const auto        gaps   = math::find_gaps_dispatch(
+        values, math::gap_threshold<value_type>(max_gap), data.size());
 
-    for (size_t i = 1; i < data.size(); ++i)
+    sections.reserve(gaps.size() + 1);
+    size_t section_start = 0;
+    for (size_t gap : gaps)
     {
-        value_type current_value = static_cast<value_type>(data[i]);
-        double     gap           = static_cast<double>(current_value - prev_value);
-
-        if (gap > max_gap)
-        {
-            // End current section and start new one
-            sections.emplace_back(section_start, prev_value);
-            section_start = current_value;
-        }
-
-        prev_value = current_value;
+        // End current section and start new one
+        sections.emplace_back(values[section_start], values[gap - 1]);
+        section_start = gap;
     }
 
     // Add the last section
-    sections.emplace_back(section_start, prev_value);
+    sections.emplace_back(values[section_start], values[data.size() - 1]);
 
     return sections;
 }
 
 template<typename T>
 std::vector<Range<typename T::value_type>> get_shared_sections(const std::vector<T>& containers,
-                                                               double                max_gap)
+                                                               double                max_gap,
+                                                               int                   mp_cores)
 {
     using value_type = typename T::value_type;
 
@@ -122,12 +432,17 @@ std::vector<Range<typename T::value_type>> get_shared_sections(const std::vector
     }
 
     // Get sections for each container
-    std::vector<std::vector<Range<value_type>>> all_sections;
-    all_sections.reserve(containers.size());
+    std::vector<std::vector<Range<value_type>>> all_sections(containers.size());
 
-    for (const auto& container : containers)
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1)
+    for (int64_t c = 0; c < int64_t(containers.size()); ++c)
     {
-        all_sections.push_back(get_sections(container, max_gap));
+        all_sections[c] = get_sections(containers[c], max_gap);
+    }
+
+    if (mp_cores > 1)
+    {
+        return intersect_sections_tree(std::move(all_sections), mp_cores);
     }
 
     // Intersect all sections progressively
@@ -135,7 +450,7 @@ std::vector<Range<typename T::value_type>> get_shared_sections(const std::vector
 
     for (size_t i = 1; i < all_sections.size(); ++i)
     {
-        result = intersect_ranges(result, all_sections[i]);
+        result = intersect_sections(result, all_sections[i]);
 
         // Early exit if no shared sections remain
         if (result.empty())
@@ -148,14 +463,11 @@ std::vector<Range<typename T::value_type>> get_shared_sections(const std::vector
 }
 
 template<typename T>
-std::vector<xt::xtensor<typename T::value_type, 1>> cut_to_shared_sections(
-    const std::vector<T>& containers,
-    double                max_gap)
+std::vector<std::vector<IndexSlice>> get_shared_section_slices(const std::vector<T>& containers,
+                                                               double                max_gap,
+                                                               int                   mp_cores)
 {
-    using value_type = typename T::value_type;
-
-    std::vector<xt::xtensor<value_type, 1>> result;
-    result.reserve(containers.size());
+    std::vector<std::vector<IndexSlice>> result(containers.size());
 
     if (containers.empty())
     {
@@ -163,59 +475,58 @@ std::vector<xt::xtensor<typename T::value_type, 1>> cut_to_shared_sections(
     }
 
     // Get the shared sections
-    auto shared_sections = get_shared_sections(containers, max_gap);
+    auto shared_sections = get_shared_sections(containers, max_gap, mp_cores);
 
-    if (shared_sections.empty())
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1)
+    for (int64_t c = 0; c < int64_t(containers.size()); ++c)
     {
-        // Return empty containers
-        for (size_t i = 0; i < containers.size(); ++i)
-        {
-            result.push_back(xt::xtensor<value_type, 1>::from_shape({ 0 }));
-        }
-        return result;
+        result[c] = slices_in_sections(containers[c], shared_sections);
     }
 
-    // For each container, extract values that fall within shared sections
-    for (const auto& container : containers)
+    return result;
+}
+
+template<typename T>
+std::vector<xt::xtensor<bool, 1>> get_shared_section_mask(const std::vector<T>& containers,
+                                                          double                max_gap,
+                                                          int                   mp_cores)
+{
+    std::vector<xt::xtensor<bool, 1>> result(containers.size());
+
+    if (containers.empty())
     {
-        std::vector<value_type> values;
-        values.reserve(container.size());
+        return result;
+    }
 
-        for (size_t i = 0; i < container.size(); ++i)
-        {
-            value_type val = static_cast<value_type>(container[i]);
+    // Get the shared sections
+    auto shared_sections = get_shared_sections(containers, max_gap, mp_cores);
 
-            // Check if this value falls within any shared section
-            for (const auto& section : shared_sections)
-            {
-                if (section.contains(val))
-                {
-                    values.push_back(val);
-                    break;
-                }
-            }
-        }
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1)
+    for (int64_t c = 0; c < int64_t(containers.size()); ++c)
+    {
+        xt::xtensor<bool, 1> mask = xt::empty<bool>({ size_t(containers[c].size()) });
+        bool*                out  = mask.data();
+        std::fill_n(out, mask.size(), false);
 
-        // Convert to xtensor
-        xt::xtensor<value_type, 1> tensor = xt::empty<value_type>({ values.size() });
-        for (size_t i = 0; i < values.size(); ++i)
+        for (const auto& slice : slices_in_sections(containers[c], shared_sections))
         {
-            tensor(i) = values[i];
+            std::fill(out + slice.start, out + slice.stop, true);
         }
-        result.push_back(std::move(tensor));
+        result[c] = std::move(mask);
     }
 
     return result;
 }
 
 template<typename T>
-std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(const std::vector<T>& containers,
-                                                               double                max_gap)
+std::vector<xt::xtensor<typename T::value_type, 1>> cut_to_shared_sections(
+    const std::vector<T>& containers,
+    double                max_gap,
+    int                   mp_cores)
 {
     using value_type = typename T::value_type;
 
-    std::vector<xt::xtensor<size_t, 1>> result;
-    result.reserve(containers.size());
+    std::vector<xt::xtensor<value_type, 1>> result(containers.size());
 
     if (containers.empty())
     {
@@ -223,46 +534,56 @@ std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(const std::vector
     }
 
     // Get the shared sections
-    auto shared_sections = get_shared_sections(containers, max_gap);
+    auto shared_sections = get_shared_sections(containers, max_gap, mp_cores);
 
-    if (shared_sections.empty())
+    // For each container, copy the slices that fall within shared sections into the output
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1)
+    for (int64_t c = 0; c < int64_t(containers.size()); ++c)
     {
-        // Return empty index arrays
-        for (size_t i = 0; i < containers.size(); ++i)
+        const auto& container = containers[c];
+        const auto  slices    = slices_in_sections(container, shared_sections);
+
+        xt::xtensor<value_type, 1> tensor = xt::empty<value_type>({ total_size(slices) });
+        value_type*                out    = tensor.data();
+        for (const auto& slice : slices)
         {
-            result.push_back(xt::xtensor<size_t, 1>::from_shape({ 0 }));
+            out = std::copy(container.begin() + slice.start, container.begin() + slice.stop, out);
         }
-        return result;
+        result[c] = std::move(tensor);
     }
 
-    // For each container, find indices of values that fall within shared sections
-    for (const auto& container : containers)
+    return result;
+}
+
+template<typename T>
+std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(const std::vector<T>& containers,
+                                                               double                max_gap,
+                                                               int                   mp_cores)
+{
+    std::vector<xt::xtensor<size_t, 1>> result(containers.size());
+
+    if (containers.empty())
     {
-        std::vector<size_t> indices;
-        indices.reserve(container.size());
+        return result;
+    }
 
-        for (size_t i = 0; i < container.size(); ++i)
-        {
-            value_type val = static_cast<value_type>(container[i]);
+    // Get the shared sections
+    auto shared_sections = get_shared_sections(containers, max_gap, mp_cores);
 
-            // Check if this value falls within any shared section
-            for (const auto& section : shared_sections)
-            {
-                if (section.contains(val))
-                {
-                    indices.push_back(i);
-                    break;
-                }
-            }
-        }
+    // For each container, write the indices of the shared section slices into the output
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1)
+    for (int64_t c = 0; c < int64_t(containers.size()); ++c)
+    {
+        const auto slices = slices_in_sections(containers[c], shared_sections);
 
-        // Convert to xtensor
-        xt::xtensor<size_t, 1> tensor = xt::empty<size_t>({ indices.size() });
-        for (size_t i = 0; i < indices.size(); ++i)
+        xt::xtensor<size_t, 1> tensor = xt::empty<size_t>({ total_size(slices) });
+        size_t*                out    = tensor.data();
+        for (const auto& slice : slices)
         {
-            tensor(i) = indices[i];
+            std::iota(out, out + slice.size(), slice.start);
+            out += slice.size();
         }
-        result.push_back(std::move(tensor));
+        result[c] = std::move(tensor);
     }
 
     return result;
@@ -270,7 +591,8 @@ std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(const std::vector
 
 template<typename T>
 xt::xtensor<typename T::value_type, 1> get_shared_section_values(const std::vector<T>& containers,
-                                                                 double                max_gap)
+                                                                 double                max_gap,
+                                                                 int                   mp_cores)
 {
     using value_type = typename T::value_type;
 
@@ -280,45 +602,30 @@ xt::xtensor<typename T::value_type, 1> get_shared_section_values(const std::vect
     }
 
     // Get the shared sections
-    auto shared_sections = get_shared_sections(containers, max_gap);
+    auto shared_sections = get_shared_sections(containers, max_gap, mp_cores);
 
     if (shared_sections.empty())
     {
         return xt::xtensor<value_type, 1>::from_shape({ 0 });
     }
 
-    // Collect all unique values from all containers that fall within shared sections
-    std::set<value_type> unique_values;
-
-    for (const auto& container : containers)
-    {
-        for (size_t i = 0; i < container.size(); ++i)
-        {
-            value_type val = static_cast<value_type>(container[i]);
-
-            // Check if this value falls within any shared section
-            for (const auto& section : shared_sections)
-            {
-                if (section.contains(val))
-                {
-                    unique_values.insert(val);
-                    break;
-                }
-            }
-        }
-    }
-
-    // Convert to xtensor (std::set is already sorted)
-    xt::xtensor<value_type, 1> result = xt::empty<value_type>({ unique_values.size() });
-    size_t                     idx    = 0;
-    for (const auto& val : unique_values)
+    // Merge all unique values from all containers that fall within shared sections
+    if (mp_cores > 1 && containers.size() > 2)
     {
-        result(idx++) = val;
+        return tree_merge_values_in_sections(containers, shared_sections, mp_cores);
     }
 
-    return result;
+    return merge_values_in_sections(containers, shared_sections);
 }
 
+// Explicit instantiations for intersect_sections
+template std::vector<Range<float>> intersect_sections(const std::vector<Range<float>>& ranges1,
+                                                      const std::vector<Range<float>>& ranges2);
+
+template std::vector<Range<double>> intersect_sections(
+    const std::vector<Range<double>>& ranges1,
+    const std::vector<Range<double>>& ranges2);
+
 // Explicit instantiations for get_sections
 template std::vector<Range<float>> get_sections(const std::vector<float>& data, double max_gap);
 
@@ -331,70 +638,127 @@ template std::vector<Range<double>> get_sections(const xt::xtensor<double, 1>& d
 // Explicit instantiations for get_shared_sections
 template std::vector<Range<float>> get_shared_sections(
     const std::vector<std::vector<float>>& containers,
-    double                                 max_gap);
+    double                                 max_gap,
+    int                                    mp_cores);
 
 template std::vector<Range<double>> get_shared_sections(
     const std::vector<std::vector<double>>& containers,
-    double                                  max_gap);
+    double                                  max_gap,
+    int                                     mp_cores);
 
 template std::vector<Range<float>> get_shared_sections(
     const std::vector<xt::xtensor<float, 1>>& containers,
-    double                                    max_gap);
+    double                                    max_gap,
+    int                                       mp_cores);
 
 template std::vector<Range<double>> get_shared_sections(
     const std::vector<xt::xtensor<double, 1>>& containers,
-    double                                     max_gap);
+    double                                     max_gap,
+    int                                        mp_cores);
 
 // Explicit instantiations for cut_to_shared_sections
 template std::vector<xt::xtensor<float, 1>> cut_to_shared_sections(
     const std::vector<std::vector<float>>& containers,
-    double                                 max_gap);
+    double                                 max_gap,
+    int                                    mp_cores);
 
 template std::vector<xt::xtensor<double, 1>> cut_to_shared_sections(
     const std::vector<std::vector<double>>& containers,
-    double                                  max_gap);
+    double                                  max_gap,
+    int                                     mp_cores);
 
 template std::vector<xt::xtensor<float, 1>> cut_to_shared_sections(
     const std::vector<xt::xtensor<float, 1>>& containers,
-    double                                    max_gap);
+    double                                    max_gap,
+    int                                       mp_cores);
 
 template std::vector<xt::xtensor<double, 1>> cut_to_shared_sections(
     const std::vector<xt::xtensor<double, 1>>& containers,
-    double                                     max_gap);
+    double                                     max_gap,
+    int                                        mp_cores);
 
 // Explicit instantiations for get_shared_section_indices
 template std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
     const std::vector<std::vector<float>>& containers,
-    double                                 max_gap);
+    double                                 max_gap,
+    int                                    mp_cores);
 
 template std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
     const std::vector<std::vector<double>>& containers,
-    double                                  max_gap);
+    double                                  max_gap,
+    int                                     mp_cores);
 
 template std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
     const std::vector<xt::xtensor<float, 1>>& containers,
-    double                                    max_gap);
+    double                                    max_gap,
+    int                                       mp_cores);
 
 template std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
     const std::vector<xt::xtensor<double, 1>>& containers,
-    double                                     max_gap);
+    double                                     max_gap,
+    int                                        mp_cores);
+
+// Explicit instantiations for get_shared_section_slices and get_shared_section_mask
+template std::vector<std::vector<IndexSlice>> get_shared_section_slices(
+    const std::vector<std::vector<float>>& containers,
+    double                                 max_gap,
+    int                                    mp_cores);
+
+template std::vector<std::vector<IndexSlice>> get_shared_section_slices(
+    const std::vector<std::vector<double>>& containers,
+    double                                  max_gap,
+    int                                     mp_cores);
+
+template std::vector<std::vector<IndexSlice>> get_shared_section_slices(
+    const std::vector<xt::xtensor<float, 1>>& containers,
+    double                                    max_gap,
+    int                                       mp_cores);
+
+template std::vector<std::vector<IndexSlice>> get_shared_section_slices(
+    const std::vector<xt::xtensor<double, 1>>& containers,
+    double                                     max_gap,
+    int                                        mp_cores);
+
+template std::vector<xt::xtensor<bool, 1>> get_shared_section_mask(
+    const std::vector<std::vector<float>>& containers,
+    double                                 max_gap,
+    int                                    mp_cores);
+
+template std::vector<xt::xtensor<bool, 1>> get_shared_section_mask(
+    const std::vector<std::vector<double>>& containers,
+    double                                  max_gap,
+    int                                     mp_cores);
+
+template std::vector<xt::xtensor<bool, 1>> get_shared_section_mask(
+    const std::vector<xt::xtensor<float, 1>>& containers,
+    double                                    max_gap,
+    int                                       mp_cores);
+
+template std::vector<xt::xtensor<bool, 1>> get_shared_section_mask(
+    const std::vector<xt::xtensor<double, 1>>& containers,
+    double                                     max_gap,
+    int                                        mp_cores);
 
 // Explicit instantiations for get_shared_section_values
 template xt::xtensor<float, 1> get_shared_section_values(
     const std::vector<std::vector<float>>& containers,
-    double                                 max_gap);
+    double                                 max_gap,
+    int                                    mp_cores);
 
 template xt::xtensor<double, 1> get_shared_section_values(
     const std::vector<std::vector<double>>& containers,
-    double                                  max_gap);
+    double                                  max_gap,
+    int                                     mp_cores);
 
 template xt::xtensor<float, 1> get_shared_section_values(
     const std::vector<xt::xtensor<float, 1>>& containers,
-    double                                    max_gap);
+    double                                    max_gap,
+    int                                       mp_cores);
 
 template xt::xtensor<double, 1> get_shared_section_values(
     const std::vector<xt::xtensor<double, 1>>& containers,
-    double                                     max_gap);
+    double                                     max_gap,
+    int                                        mp_cores);
 
 } // namespace helper
 } // namespace tools
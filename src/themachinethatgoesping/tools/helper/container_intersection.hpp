@@ -32,9 +32,10 @@ namespace helper {
 template<typename T>
 struct Range
 {
-    T min; ///< Minimum value of the range (inclusive)
-    T max; ///< Maximum value of the range (inclusive)
+    T min = 0; ///< Minimum value of the range (inclusive)
+    T max = 0; ///< Maximum value of the range (inclusive)
 
+    Range() = default;
     Range(T min_val, T max_val)
         : min(min_val)
         , max(max_val)
@@ -64,6 +65,24 @@ struct Range
      * @brief Check if range is valid (min <= max)
      */
     bool is_valid() const { return min <= max; }
+
+    bool operator==(const Range& other) const = default;
+};
+
+/**
+ * @brief Half-open index range [start, stop) into a container (python slice semantics)
+ */
+struct IndexSlice
+{
+    size_t start = 0; ///< first index of the slice
+    size_t stop  = 0; ///< one past the last index of the slice
+
+    /**
+     * @brief Number of elements within the slice
+     */
+    size_t size() const { return stop - start; }
+
+    bool operator==(const IndexSlice& other) const = default;
 };
 
 /**
@@ -85,6 +104,18 @@ std::vector<Range<typename T::value_type>> get_sections(
     const T& data,
     double   max_gap = std::numeric_limits<double>::quiet_NaN());
 
+/**
+ * @brief Intersect two sorted lists of non-overlapping sections
+ *
+ * @tparam T Floating point type of the ranges
+ * @param ranges1 First list of sections, sorted in ascending order
+ * @param ranges2 Second list of sections, sorted in ascending order
+ * @return std::vector<Range<T>> Sorted list of the ranges covered by both lists
+ */
+template<typename T>
+std::vector<Range<T>> intersect_sections(const std::vector<Range<T>>& ranges1,
+                                         const std::vector<Range<T>>& ranges2);
+
 /**
  * @brief Find the intersection of sections from multiple containers
  *
@@ -96,6 +127,8 @@ std::vector<Range<typename T::value_type>> get_sections(
  * @param containers Vector of containers, each must be sorted in ascending order
  * @param max_gap Maximum allowed gap between consecutive values in any container.
  *                If <= 0 or NaN, defaults to checking only container boundaries.
+ * @param mp_cores Number of threads. With mp_cores > 1 the sections of the containers are
+ *                 computed in parallel and intersected as a balanced tree.
  * @return std::vector<Range<value_type>> Vector of ranges where all containers have overlapping data
  *
  * @note All containers must be sorted in ascending order. Behavior is undefined for unsorted input.
@@ -103,7 +136,8 @@ std::vector<Range<typename T::value_type>> get_sections(
 template<typename T>
 std::vector<Range<typename T::value_type>> get_shared_sections(
     const std::vector<T>& containers,
-    double                max_gap = std::numeric_limits<double>::quiet_NaN());
+    double                max_gap  = std::numeric_limits<double>::quiet_NaN(),
+    int                   mp_cores = 1);
 
 /**
  * @brief Cut containers to their shared/intersecting ranges
@@ -117,6 +151,7 @@ std::vector<Range<typename T::value_type>> get_shared_sections(
  * @param containers Vector of containers, each must be sorted in ascending order
  * @param max_gap Maximum allowed gap between consecutive values in any container.
  *                If <= 0 or NaN, defaults to only considering container boundaries.
+ * @param mp_cores Number of threads used to process the containers in parallel
  * @return std::vector<xt::xtensor<value_type, 1>> Vector of containers cut to shared ranges
  *
  * @note All containers must be sorted in ascending order. Behavior is undefined for unsorted input.
@@ -126,18 +161,22 @@ std::vector<Range<typename T::value_type>> get_shared_sections(
 template<typename T>
 std::vector<xt::xtensor<typename T::value_type, 1>> cut_to_shared_sections(
     const std::vector<T>& containers,
-    double                max_gap = std::numeric_limits<double>::quiet_NaN());
+    double                max_gap  = std::numeric_limits<double>::quiet_NaN(),
+    int                   mp_cores = 1);
 
 /**
  * @brief Get indices of values that fall within the shared sections
  *
  * This function takes multiple sorted containers and returns indices into each
  * container for values that fall within ranges shared by all input containers.
+ * Use get_shared_section_slices or get_shared_section_mask to avoid materializing the
+ * index arrays.
  *
  * @tparam T Container type (must support .size() and element access, contain floating point values)
  * @param containers Vector of containers, each must be sorted in ascending order
  * @param max_gap Maximum allowed gap between consecutive values in any container.
  *                If <= 0 or NaN, defaults to only considering container boundaries.
+ * @param mp_cores Number of threads used to process the containers in parallel
  * @return std::vector<xt::xtensor<size_t, 1>> Vector of index arrays, one per input container
  *
  * @note All containers must be sorted in ascending order. Behavior is undefined for unsorted input.
@@ -145,7 +184,49 @@ std::vector<xt::xtensor<typename T::value_type, 1>> cut_to_shared_sections(
 template<typename T>
 std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
     const std::vector<T>& containers,
-    double                max_gap = std::numeric_limits<double>::quiet_NaN());
+    double                max_gap  = std::numeric_limits<double>::quiet_NaN(),
+    int                   mp_cores = 1);
+
+/**
+ * @brief Get the index slices of the shared sections for each container
+ *
+ * For every container one IndexSlice [start, stop) is returned per shared section (in the
+ * order of get_shared_sections, slices may be empty). The slices describe the same elements
+ * as get_shared_section_indices, without materializing an index array.
+ *
+ * @tparam T Container type (must support .size() and element access, contain floating point values)
+ * @param containers Vector of containers, each must be sorted in ascending order
+ * @param max_gap Maximum allowed gap between consecutive values in any container.
+ *                If <= 0 or NaN, defaults to only considering container boundaries.
+ * @param mp_cores Number of threads used to process the containers in parallel
+ * @return std::vector<std::vector<IndexSlice>> One list of slices per input container
+ *
+ * @note All containers must be sorted in ascending order. Behavior is undefined for unsorted input.
+ */
+template<typename T>
+std::vector<std::vector<IndexSlice>> get_shared_section_slices(
+    const std::vector<T>& containers,
+    double                max_gap  = std::numeric_limits<double>::quiet_NaN(),
+    int                   mp_cores = 1);
+
+/**
+ * @brief Get a boolean mask of the values that fall within the shared sections
+ *
+ * @tparam T Container type (must support .size() and element access, contain floating point values)
+ * @param containers Vector of containers, each must be sorted in ascending order
+ * @param max_gap Maximum allowed gap between consecutive values in any container.
+ *                If <= 0 or NaN, defaults to only considering container boundaries.
+ * @param mp_cores Number of threads used to process the containers in parallel
+ * @return std::vector<xt::xtensor<bool, 1>> One mask (same size as the container) per input
+ * container
+ *
+ * @note All containers must be sorted in ascending order. Behavior is undefined for unsorted input.
+ */
+template<typename T>
+std::vector<xt::xtensor<bool, 1>> get_shared_section_mask(
+    const std::vector<T>& containers,
+    double                max_gap  = std::numeric_limits<double>::quiet_NaN(),
+    int                   mp_cores = 1);
 
 /**
  * @brief Get values that fall within the shared sections (flattened)
@@ -154,10 +235,15 @@ std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
  * containing all unique values from any container that fall within shared sections.
  * This is useful when you need a common set of values for interpolation or alignment.
  *
+ * The values are combined with a k-way merge (removing duplicates on the fly).
+ * With mp_cores > 1 the containers are merged pairwise as a balanced tree in parallel.
+ *
  * @tparam T Container type (must support .size() and element access, contain floating point values)
  * @param containers Vector of containers, each must be sorted in ascending order
  * @param max_gap Maximum allowed gap between consecutive values in any container.
  *                If <= 0 or NaN, defaults to only considering container boundaries.
+ * @param mp_cores Number of threads used for the shared sections and the tree merge
+ *                 (1 = sequential k-way merge)
  * @return xt::xtensor<value_type, 1> Sorted unique values from all containers within shared sections
  *
  * @note All containers must be sorted in ascending order. Behavior is undefined for unsorted input.
@@ -165,9 +251,18 @@ std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
 template<typename T>
 xt::xtensor<typename T::value_type, 1> get_shared_section_values(
     const std::vector<T>& containers,
-    double                max_gap = std::numeric_limits<double>::quiet_NaN());
+    double                max_gap  = std::numeric_limits<double>::quiet_NaN(),
+    int                   mp_cores = 1);
 
 // Explicit instantiation declarations for common types
+extern template std::vector<Range<float>> intersect_sections(
+    const std::vector<Range<float>>& ranges1,
+    const std::vector<Range<float>>& ranges2);
+
+extern template std::vector<Range<double>> intersect_sections(
+    const std::vector<Range<double>>& ranges1,
+    const std::vector<Range<double>>& ranges2);
+
 extern template std::vector<Range<float>> get_sections(
     const std::vector<float>& data,
     double                    max_gap);
@@ -186,67 +281,123 @@ extern template std::vector<Range<double>> get_sections(
 
 extern template std::vector<Range<float>> get_shared_sections(
     const std::vector<std::vector<float>>& containers,
-    double                                 max_gap);
+    double                                 max_gap,
+    int                                    mp_cores);
 
 extern template std::vector<Range<double>> get_shared_sections(
     const std::vector<std::vector<double>>& containers,
-    double                                  max_gap);
+    double                                  max_gap,
+    int                                     mp_cores);
 
 extern template std::vector<Range<float>> get_shared_sections(
     const std::vector<xt::xtensor<float, 1>>& containers,
-    double                                    max_gap);
+    double                                    max_gap,
+    int                                       mp_cores);
 
 extern template std::vector<Range<double>> get_shared_sections(
     const std::vector<xt::xtensor<double, 1>>& containers,
-    double                                     max_gap);
+    double                                     max_gap,
+    int                                        mp_cores);
 
 extern template std::vector<xt::xtensor<float, 1>> cut_to_shared_sections(
     const std::vector<std::vector<float>>& containers,
-    double                                 max_gap);
+    double                                 max_gap,
+    int                                    mp_cores);
 
 extern template std::vector<xt::xtensor<double, 1>> cut_to_shared_sections(
     const std::vector<std::vector<double>>& containers,
-    double                                  max_gap);
+    double                                  max_gap,
+    int                                     mp_cores);
 
 extern template std::vector<xt::xtensor<float, 1>> cut_to_shared_sections(
     const std::vector<xt::xtensor<float, 1>>& containers,
-    double                                    max_gap);
+    double                                    max_gap,
+    int                                       mp_cores);
 
 extern template std::vector<xt::xtensor<double, 1>> cut_to_shared_sections(
     const std::vector<xt::xtensor<double, 1>>& containers,
-    double                                     max_gap);
+    double                                     max_gap,
+    int                                        mp_cores);
 
 extern template std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
     const std::vector<std::vector<float>>& containers,
-    double                                 max_gap);
+    double                                 max_gap,
+    int                                    mp_cores);
 
 extern template std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
     const std::vector<std::vector<double>>& containers,
-    double                                  max_gap);
+    double                                  max_gap,
+    int                                     mp_cores);
 
 extern template std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
     const std::vector<xt::xtensor<float, 1>>& containers,
-    double                                    max_gap);
+    double                                    max_gap,
+    int                                       mp_cores);
 
 extern template std::vector<xt::xtensor<size_t, 1>> get_shared_section_indices(
     const std::vector<xt::xtensor<double, 1>>& containers,
-    double                                     max_gap);
+    double                                     max_gap,
+    int                                        mp_cores);
+
+extern template std::vector<std::vector<IndexSlice>> get_shared_section_slices(
+    const std::vector<std::vector<float>>& containers,
+    double                                 max_gap,
+    int                                    mp_cores);
+
+extern template std::vector<std::vector<IndexSlice>> get_shared_section_slices(
+    const std::vector<std::vector<double>>& containers,
+    double                                  max_gap,
+    int                                     mp_cores);
+
+extern template std::vector<std::vector<IndexSlice>> get_shared_section_slices(
+    const std::vector<xt::xtensor<float, 1>>& containers,
+    double                                    max_gap,
+    int                                       mp_cores);
+
+extern template std::vector<std::vector<IndexSlice>> get_shared_section_slices(
+    const std::vector<xt::xtensor<double, 1>>& containers,
+    double                                     max_gap,
+    int                                        mp_cores);
+
+extern template std::vector<xt::xtensor<bool, 1>> get_shared_section_mask(
+    const std::vector<std::vector<float>>& containers,
+    double                                 max_gap,
+    int                                    mp_cores);
+
+extern template std::vector<xt::xtensor<bool, 1>> get_shared_section_mask(
+    const std::vector<std::vector<double>>& containers,
+    double                                  max_gap,
+    int                                     mp_cores);
+
+extern template std::vector<xt::xtensor<bool, 1>> get_shared_section_mask(
+    const std::vector<xt::xtensor<float, 1>>& containers,
+    double                                    max_gap,
+    int                                       mp_cores);
+
+extern template std::vector<xt::xtensor<bool, 1>> get_shared_section_mask(
+    const std::vector<xt::xtensor<double, 1>>& containers,
+    double                                     max_gap,
+    int                                        mp_cores);
 
 extern template xt::xtensor<float, 1> get_shared_section_values(
     const std::vector<std::vector<float>>& containers,
-    double                                 max_gap);
+    double                                 max_gap,
+    int                                    mp_cores);
 
 extern template xt::xtensor<double, 1> get_shared_section_values(
     const std::vector<std::vector<double>>& containers,
-    double                                  max_gap);
+    double                                  max_gap,
+    int                                     mp_cores);
 
 extern template xt::xtensor<float, 1> get_shared_section_values(
     const std::vector<xt::xtensor<float, 1>>& containers,
-    double                                    max_gap);
+    double                                    max_gap,
+    int                                       mp_cores);
 
 extern template xt::xtensor<double, 1> get_shared_section_values(
     const std::vector<xt::xtensor<double, 1>>& containers,
-    double                                     max_gap);
+    double                                     max_gap,
+    int                                        mp_cores);
 
 } // namespace helper
 } // namespace tools
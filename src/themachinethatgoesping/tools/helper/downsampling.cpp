@@ -4,6 +4,15 @@
 
 #include "downsampling.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+#include <fmt/format.h>
+
+#include "../math/simd.hpp"
+
 namespace themachinethatgoesping {
 namespace tools {
 namespace helper {
@@ -38,12 +47,125 @@ inline double get_value(const T& data, size_t i)
         return static_cast<double>(data[i]);
     }
 }
+
+// Check that x and y of the xy downsampling functions have the same size
+inline void check_xy_size(const char* function_name, size_t x_size, size_t y_size)
+{
+    if (x_size != y_size)
+        throw std::invalid_argument(
+            fmt::format("ERROR[{}]: x and y must have the same size (x: {}, y: {})",
+                        function_name,
+                        x_size,
+                        y_size));
+}
+
+// Return all indices [0, n) (downsampling disabled)
+inline xt::xtensor<size_t, 1> get_all_indices(size_t n)
+{
+    xt::xtensor<size_t, 1> result = xt::xtensor<size_t, 1>::from_shape({ n });
+    std::iota(result.begin(), result.end(), size_t(0));
+    return result;
+}
+
+// Bounds of the gap free segments: segment s is [segment_bounds[s], segment_bounds[s + 1]).
+// The gap candidates are found with SIMD in the value type (one ulp below the threshold, so that
+// no gap that is larger than max_gap in double is missed), then the exact double criterion is
+// applied to the candidates (same gaps as the element wise double comparison).
+template<typename T>
+std::vector<size_t> get_segment_bounds(const T& data, double max_gap)
+{
+    using value_type = typename T::value_type;
+
+    const value_type threshold = std::nextafter(math::gap_threshold<value_type>(max_gap),
+                                                -std::numeric_limits<value_type>::infinity());
+    const auto candidates = math::find_gaps_dispatch(data.data(), threshold, data.size());
+
+    std::vector<size_t> segment_bounds;
+    segment_bounds.reserve(candidates.size() + 2);
+    segment_bounds.push_back(0);
+    for (size_t i : candidates)
+        if (get_value(data, i) - get_value(data, i - 1) > max_gap)
+            segment_bounds.push_back(i);
+    segment_bounds.push_back(data.size());
+    return segment_bounds;
+}
+
+// Bounds of the buckets of the segment [segment_begin, segment_end): bucket b is
+// [bucket_bounds[b], bucket_bounds[b + 1]). Buckets are downsample_interval wide and aligned
+// to the first value of the segment; empty buckets are skipped.
+template<typename T>
+void get_bucket_bounds(const T&             x,
+                       size_t               segment_begin,
+                       size_t               segment_end,
+                       double               downsample_interval,
+                       std::vector<size_t>& bucket_bounds)
+{
+    bucket_bounds.clear();
+    bucket_bounds.push_back(segment_begin);
+
+    const double x0         = get_value(x, segment_begin);
+    double       bucket_end = x0 + downsample_interval;
+    for (size_t i = segment_begin + 1; i < segment_end; ++i)
+    {
+        const double value = get_value(x, i);
+        if (value >= bucket_end)
+        {
+            bucket_bounds.push_back(i);
+            bucket_end =
+                x0 + (std::floor((value - x0) / downsample_interval) + 1) * downsample_interval;
+        }
+    }
+
+    bucket_bounds.push_back(segment_end);
+}
+
+// Select the indices of the gap free segments [segment_bounds[s], segment_bounds[s + 1])
+// for s in [first_segment, last_segment). The first value of each segment is always
+// selected (sampling restarts after a gap)
+template<typename T>
+void downsample_segments(const T&                   data,
+                         const std::vector<size_t>& segment_bounds,
+                         size_t                     first_segment,
+                         size_t                     last_segment,
+                         double                     downsample_interval,
+                         std::vector<size_t>&       indices)
+{
+    const size_t begin = segment_bounds[first_segment];
+    const size_t end   = segment_bounds[last_segment];
+
+    // Estimate capacity
+    double t_min             = get_value(data, begin);
+    double t_max             = get_value(data, end - 1);
+    size_t estimated_samples = static_cast<size_t>((t_max - t_min) / downsample_interval) + 1;
+    indices.reserve(std::min(estimated_samples + (last_segment - first_segment), end - begin));
+
+    for (size_t s = first_segment; s < last_segment; ++s)
+    {
+        const size_t segment_start = segment_bounds[s];
+        const size_t segment_end   = segment_bounds[s + 1];
+
+        indices.push_back(segment_start);
+        double last_selected_value = get_value(data, segment_start);
+
+        for (size_t i = segment_start + 1; i < segment_end; ++i)
+        {
+            // Check if enough distance since last selected value
+            double current_value = get_value(data, i);
+            if (current_value - last_selected_value >= downsample_interval)
+            {
+                indices.push_back(i);
+                last_selected_value = current_value;
+            }
+        }
+    }
+}
 } // anonymous namespace
 
 template<typename T>
 xt::xtensor<size_t, 1> get_index_downsampling(const T& data,
                                               double   downsample_interval,
-                                              double   max_gap)
+                                              double   max_gap,
+                                              int      mp_cores)
 {
     const size_t n = data.size();
     if (n == 0)
@@ -56,52 +178,53 @@ xt::xtensor<size_t, 1> get_index_downsampling(const T& data,
     // If downsampling disabled, return all indices
     if (is_downsampling_disabled(downsample_interval))
     {
-        xt::xtensor<size_t, 1> result = xt::xtensor<size_t, 1>::from_shape({ n });
-        for (size_t i = 0; i < n; ++i)
-        {
-            result[i] = i;
-        }
-        return result;
+        return get_all_indices(n);
     }
 
-    // Estimate capacity and collect indices in a vector first
-    double t_min = get_value(data, 0);
-    double t_max = get_value(data, n - 1);
-    size_t estimated_samples = static_cast<size_t>((t_max - t_min) / downsample_interval) + 1;
-    
-    std::vector<size_t> indices;
-    indices.reserve(std::min(estimated_samples, n));
+    const auto   segment_bounds = get_segment_bounds(data, max_gap);
+    const size_t n_segments     = segment_bounds.size() - 1;
 
-    // Start with the first value
-    indices.push_back(0);
-    double last_selected_value = t_min;
+    // Segments are independent, so they can be sampled in parallel. Group them into chunks
+    // of similar element count (a few per thread for load balancing); a chunk always contains
+    // whole segments
+    std::vector<size_t> chunk_bounds = { 0 };
+    if (mp_cores > 1)
+    {
+        const size_t min_chunk_size = n / (size_t(mp_cores) * 4) + 1;
+        for (size_t s = 1; s < n_segments; ++s)
+            if (segment_bounds[s] - segment_bounds[chunk_bounds.back()] >= min_chunk_size)
+                chunk_bounds.push_back(s);
+    }
+    chunk_bounds.push_back(n_segments);
+    const size_t n_chunks = chunk_bounds.size() - 1;
+
+    std::vector<std::vector<size_t>> chunk_indices(n_chunks);
 
-    for (size_t i = 1; i < n; ++i)
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1 && n_chunks > 1)
+    for (int64_t c = 0; c < int64_t(n_chunks); ++c)
     {
-        double current_value = get_value(data, i);
-        double prev_value    = get_value(data, i - 1);
+        downsample_segments(data,
+                            segment_bounds,
+                            chunk_bounds[c],
+                            chunk_bounds[c + 1],
+                            downsample_interval,
+                            chunk_indices[c]);
+    }
 
-        // Check for gap between consecutive original values
-        double gap = current_value - prev_value;
-        if (gap > max_gap)
-        {
-            // Gap detected - restart sampling from this value
-            indices.push_back(i);
-            last_selected_value = current_value;
-            continue;
-        }
+    // Concatenate the chunks (prefix sum over the chunk sizes gives the output offsets)
+    std::vector<size_t> offsets(n_chunks + 1, 0);
+    for (size_t c = 0; c < n_chunks; ++c)
+        offsets[c + 1] = offsets[c] + chunk_indices[c].size();
 
-        // Check if enough distance since last selected value
-        if (current_value - last_selected_value >= downsample_interval)
-        {
-            indices.push_back(i);
-            last_selected_value = current_value;
-        }
+    xt::xtensor<size_t, 1> result = xt::xtensor<size_t, 1>::from_shape({ offsets.back() });
+
+#pragma omp parallel for num_threads(mp_cores) if (mp_cores > 1 && n_chunks > 1)
+    for (int64_t c = 0; c < int64_t(n_chunks); ++c)
+    {
+        std::copy(
+            chunk_indices[c].begin(), chunk_indices[c].end(), result.begin() + offsets[c]);
     }
 
-    // Convert to xtensor
-    xt::xtensor<size_t, 1> result = xt::xtensor<size_t, 1>::from_shape({ indices.size() });
-    std::copy(indices.begin(), indices.end(), result.begin());
     return result;
 }
 
@@ -184,22 +307,243 @@ xt::xtensor<typename T::value_type, 1> get_value_downsampling(const T& data,
     return result;
 }
 
+template<typename TX, typename TY>
+xt::xtensor<size_t, 1> get_minmax_downsampling(const TX& x,
+                                               const TY& y,
+                                               double    downsample_interval,
+                                               double    max_gap)
+{
+    check_xy_size("get_minmax_downsampling", x.size(), y.size());
+
+    const size_t n = x.size();
+    if (n == 0 || is_downsampling_disabled(downsample_interval))
+    {
+        return get_all_indices(n);
+    }
+
+    max_gap = get_effective_max_gap(max_gap, downsample_interval);
+
+    const auto* values = y.data();
+
+    std::vector<size_t> indices;
+    std::vector<size_t> bucket_bounds;
+
+    const auto segment_bounds = get_segment_bounds(x, max_gap);
+    for (size_t s = 0; s + 1 < segment_bounds.size(); ++s)
+    {
+        get_bucket_bounds(
+            x, segment_bounds[s], segment_bounds[s + 1], downsample_interval, bucket_bounds);
+
+        for (size_t b = 0; b + 1 < bucket_bounds.size(); ++b)
+        {
+            // NaN values are only selected if the bucket contains no other values
+            size_t i_min = bucket_bounds[b];
+            size_t i_max = bucket_bounds[b];
+            for (size_t i = bucket_bounds[b] + 1; i < bucket_bounds[b + 1]; ++i)
+            {
+                if (values[i] < values[i_min] || std::isnan(values[i_min]))
+                    i_min = i;
+                if (values[i] > values[i_max] || std::isnan(values[i_max]))
+                    i_max = i;
+            }
+
+            // keep the original order
+            indices.push_back(std::min(i_min, i_max));
+            if (i_min != i_max)
+                indices.push_back(std::max(i_min, i_max));
+        }
+    }
+
+    xt::xtensor<size_t, 1> result = xt::xtensor<size_t, 1>::from_shape({ indices.size() });
+    std::copy(indices.begin(), indices.end(), result.begin());
+    return result;
+}
+
+template<typename TX, typename TY>
+std::tuple<xt::xtensor<typename TX::value_type, 1>, xt::xtensor<typename TY::value_type, 1>>
+get_mean_downsampling(const TX& x, const TY& y, double downsample_interval, double max_gap)
+{
+    using x_type = typename TX::value_type;
+    using y_type = typename TY::value_type;
+
+    check_xy_size("get_mean_downsampling", x.size(), y.size());
+
+    const size_t n = x.size();
+    if (n == 0 || is_downsampling_disabled(downsample_interval))
+    {
+        xt::xtensor<x_type, 1> x_result = xt::xtensor<x_type, 1>::from_shape({ n });
+        xt::xtensor<y_type, 1> y_result = xt::xtensor<y_type, 1>::from_shape({ n });
+        std::copy(x.data(), x.data() + n, x_result.begin());
+        std::copy(y.data(), y.data() + n, y_result.begin());
+        return { std::move(x_result), std::move(y_result) };
+    }
+
+    max_gap = get_effective_max_gap(max_gap, downsample_interval);
+
+    const auto* values = y.data();
+
+    std::vector<x_type> x_means;
+    std::vector<y_type> y_means;
+    std::vector<size_t> bucket_bounds;
+
+    const auto segment_bounds = get_segment_bounds(x, max_gap);
+    for (size_t s = 0; s + 1 < segment_bounds.size(); ++s)
+    {
+        get_bucket_bounds(
+            x, segment_bounds[s], segment_bounds[s + 1], downsample_interval, bucket_bounds);
+
+        for (size_t b = 0; b + 1 < bucket_bounds.size(); ++b)
+        {
+            // accumulate in double, NaN y values are ignored
+            double x_sum = 0, y_sum = 0;
+            size_t y_count = 0;
+            for (size_t i = bucket_bounds[b]; i < bucket_bounds[b + 1]; ++i)
+            {
+                x_sum += get_value(x, i);
+                if (!std::isnan(values[i]))
+                {
+                    y_sum += static_cast<double>(values[i]);
+                    ++y_count;
+                }
+            }
+
+            const double bucket_size = double(bucket_bounds[b + 1] - bucket_bounds[b]);
+            x_means.push_back(static_cast<x_type>(x_sum / bucket_size));
+            y_means.push_back(y_count > 0 ? static_cast<y_type>(y_sum / double(y_count))
+                                          : std::numeric_limits<y_type>::quiet_NaN());
+        }
+    }
+
+    xt::xtensor<x_type, 1> x_result = xt::xtensor<x_type, 1>::from_shape({ x_means.size() });
+    xt::xtensor<y_type, 1> y_result = xt::xtensor<y_type, 1>::from_shape({ y_means.size() });
+    std::copy(x_means.begin(), x_means.end(), x_result.begin());
+    std::copy(y_means.begin(), y_means.end(), y_result.begin());
+    return { std::move(x_result), std::move(y_result) };
+}
+
+template<typename TX, typename TY>
+xt::xtensor<size_t, 1> get_lttb_downsampling(const TX& x,
+                                             const TY& y,
+                                             double    downsample_interval,
+                                             double    max_gap)
+{
+    check_xy_size("get_lttb_downsampling", x.size(), y.size());
+
+    const size_t n = x.size();
+    if (n == 0 || is_downsampling_disabled(downsample_interval))
+    {
+        return get_all_indices(n);
+    }
+
+    max_gap = get_effective_max_gap(max_gap, downsample_interval);
+
+    std::vector<size_t> indices;
+    std::vector<size_t> bucket_bounds;
+
+    const auto segment_bounds = get_segment_bounds(x, max_gap);
+    for (size_t s = 0; s + 1 < segment_bounds.size(); ++s)
+    {
+        const size_t segment_begin = segment_bounds[s];
+        const size_t segment_end   = segment_bounds[s + 1];
+
+        // the first and the last value of each segment are fixed buckets of their own (as in
+        // standard LTTB), the values in between are split into the x interval buckets
+        indices.push_back(segment_begin);
+        if (segment_end - segment_begin == 1)
+            continue;
+
+        const size_t last = segment_end - 1;
+        get_bucket_bounds(x, segment_begin, segment_end, downsample_interval, bucket_bounds);
+        bucket_bounds.front() = segment_begin + 1;
+        bucket_bounds.back()  = last;
+        if (bucket_bounds[0] == bucket_bounds[1])
+            bucket_bounds.erase(bucket_bounds.begin());
+        if (bucket_bounds.size() > 1 && bucket_bounds[bucket_bounds.size() - 2] == last)
+            bucket_bounds.pop_back();
+        const size_t n_buckets = bucket_bounds.size() - 1;
+
+        size_t selected = segment_begin;
+        for (size_t b = 0; b < n_buckets; ++b)
+        {
+            const double xa = get_value(x, selected);
+            const double ya = get_value(y, selected);
+
+            // average point of the next bucket (NaN y values are ignored),
+            // the last value of the segment for the last bucket
+            double xc = 0, yc = 0;
+            size_t yc_count = 0;
+            if (b + 1 < n_buckets)
+            {
+                for (size_t i = bucket_bounds[b + 1]; i < bucket_bounds[b + 2]; ++i)
+                {
+                    xc += get_value(x, i);
+                    if (const double value = get_value(y, i); !std::isnan(value))
+                    {
+                        yc += value;
+                        ++yc_count;
+                    }
+                }
+                xc /= double(bucket_bounds[b + 2] - bucket_bounds[b + 1]);
+            }
+            else
+            {
+                xc = get_value(x, last);
+                if (const double value = get_value(y, last); !std::isnan(value))
+                {
+                    yc       = value;
+                    yc_count = 1;
+                }
+            }
+            yc = yc_count > 0 ? yc / double(yc_count) : ya;
+
+            // select the point of this bucket that spans the largest triangle with the
+            // last selected point and the average of the next bucket
+            // (x is taken relative to the selected point to avoid cancellation for timestamps)
+            size_t best      = bucket_bounds[b];
+            double best_area = -1;
+            for (size_t i = bucket_bounds[b]; i < bucket_bounds[b + 1]; ++i)
+            {
+                const double area = std::abs((get_value(x, i) - xa) * (yc - ya) -
+                                             (xc - xa) * (get_value(y, i) - ya));
+                if (area > best_area)
+                {
+                    best      = i;
+                    best_area = area;
+                }
+            }
+
+            indices.push_back(best);
+            selected = best;
+        }
+
+        indices.push_back(last);
+    }
+
+    xt::xtensor<size_t, 1> result = xt::xtensor<size_t, 1>::from_shape({ indices.size() });
+    std::copy(indices.begin(), indices.end(), result.begin());
+    return result;
+}
+
 // Explicit instantiations for get_index_downsampling
 template xt::xtensor<size_t, 1> get_index_downsampling(const std::vector<float>& data,
                                                        double downsample_interval,
-                                                       double max_gap);
+                                                       double max_gap,
+                                                       int mp_cores);
 
 template xt::xtensor<size_t, 1> get_index_downsampling(const std::vector<double>& data,
                                                        double downsample_interval,
-                                                       double max_gap);
+                                                       double max_gap,
+                                                       int mp_cores);
 
 template xt::xtensor<size_t, 1> get_index_downsampling(const xt::xtensor<float, 1>& data,
                                                        double downsample_interval,
-                                                       double max_gap);
+                                                       double max_gap,
+                                                       int mp_cores);
 
 template xt::xtensor<size_t, 1> get_index_downsampling(const xt::xtensor<double, 1>& data,
                                                        double downsample_interval,
-                                                       double max_gap);
+                                                       double max_gap,
+                                                       int mp_cores);
 
 // Explicit instantiations for get_value_downsampling
 template xt::xtensor<float, 1> get_value_downsampling(const std::vector<float>& data,
@@ -218,6 +562,105 @@ template xt::xtensor<double, 1> get_value_downsampling(const xt::xtensor<double,
                                                        double downsample_interval,
                                                        double max_gap);
 
+// Explicit instantiations for get_minmax_downsampling
+template xt::xtensor<size_t, 1> get_minmax_downsampling(const std::vector<double>& x,
+                                                        const std::vector<double>& y,
+                                                        double downsample_interval,
+                                                        double max_gap);
+
+template xt::xtensor<size_t, 1> get_minmax_downsampling(const std::vector<double>& x,
+                                                        const std::vector<float>& y,
+                                                        double downsample_interval,
+                                                        double max_gap);
+
+template xt::xtensor<size_t, 1> get_minmax_downsampling(const std::vector<float>& x,
+                                                        const std::vector<float>& y,
+                                                        double downsample_interval,
+                                                        double max_gap);
+
+template xt::xtensor<size_t, 1> get_minmax_downsampling(const xt::xtensor<double, 1>& x,
+                                                        const xt::xtensor<double, 1>& y,
+                                                        double downsample_interval,
+                                                        double max_gap);
+
+template xt::xtensor<size_t, 1> get_minmax_downsampling(const xt::xtensor<double, 1>& x,
+                                                        const xt::xtensor<float, 1>& y,
+                                                        double downsample_interval,
+                                                        double max_gap);
+
+template xt::xtensor<size_t, 1> get_minmax_downsampling(const xt::xtensor<float, 1>& x,
+                                                        const xt::xtensor<float, 1>& y,
+                                                        double downsample_interval,
+                                                        double max_gap);
+
+// Explicit instantiations for get_mean_downsampling
+template std::tuple<xt::xtensor<double, 1>, xt::xtensor<double, 1>> get_mean_downsampling(
+    const std::vector<double>& x,
+    const std::vector<double>& y,
+    double downsample_interval,
+    double max_gap);
+
+template std::tuple<xt::xtensor<double, 1>, xt::xtensor<float, 1>> get_mean_downsampling(
+    const std::vector<double>& x,
+    const std::vector<float>& y,
+    double downsample_interval,
+    double max_gap);
+
+template std::tuple<xt::xtensor<float, 1>, xt::xtensor<float, 1>> get_mean_downsampling(
+    const std::vector<float>& x,
+    const std::vector<float>& y,
+    double downsample_interval,
+    double max_gap);
+
+template std::tuple<xt::xtensor<double, 1>, xt::xtensor<double, 1>> get_mean_downsampling(
+    const xt::xtensor<double, 1>& x,
+    const xt::xtensor<double, 1>& y,
+    double downsample_interval,
+    double max_gap);
+
+template std::tuple<xt::xtensor<double, 1>, xt::xtensor<float, 1>> get_mean_downsampling(
+    const xt::xtensor<double, 1>& x,
+    const xt::xtensor<float, 1>& y,
+    double downsample_interval,
+    double max_gap);
+
+template std::tuple<xt::xtensor<float, 1>, xt::xtensor<float, 1>> get_mean_downsampling(
+    const xt::xtensor<float, 1>& x,
+    const xt::xtensor<float, 1>& y,
+    double downsample_interval,
+    double max_gap);
+
+// Explicit instantiations for get_lttb_downsampling
+template xt::xtensor<size_t, 1> get_lttb_downsampling(const std::vector<double>& x,
+                                                      const std::vector<double>& y,
+                                                      double downsample_interval,
+                                                      double max_gap);
+
+template xt::xtensor<size_t, 1> get_lttb_downsampling(const std::vector<double>& x,
+                                                      const std::vector<float>& y,
+                                                      double downsample_interval,
+                                                      double max_gap);
+
+template xt::xtensor<size_t, 1> get_lttb_downsampling(const std::vector<float>& x,
+                                                      const std::vector<float>& y,
+                                                      double downsample_interval,
+                                                      double max_gap);
+
+template xt::xtensor<size_t, 1> get_lttb_downsampling(const xt::xtensor<double, 1>& x,
+                                                      const xt::xtensor<double, 1>& y,
+                                                      double downsample_interval,
+                                                      double max_gap);
+
+template xt::xtensor<size_t, 1> get_lttb_downsampling(const xt::xtensor<double, 1>& x,
+                                                      const xt::xtensor<float, 1>& y,
+                                                      double downsample_interval,
+                                                      double max_gap);
+
+template xt::xtensor<size_t, 1> get_lttb_downsampling(const xt::xtensor<float, 1>& x,
+                                                      const xt::xtensor<float, 1>& y,
+                                                      double downsample_interval,
+                                                      double max_gap);
+
 } // namespace helper
 } // namespace tools
 } // namespace themachinethatgoesping
@@ -13,9 +13,13 @@
 #include ".docstrings/downsampling.doc.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <concepts>
+#include <limits>
 #include <stdexcept>
+#include <string>
+#include <tuple>
 #include <vector>
 
 #include <xtensor/containers/xadapt.hpp>
@@ -45,6 +49,9 @@ namespace helper {
  * @param max_gap Maximum allowed gap in the original data before considering it a data gap.
  *                When a gap larger than this is encountered, sampling restarts after the gap.
  *                If <= 0 or NaN, defaults to 2x downsample_interval (or 10 if no downsampling)
+ * @param mp_cores Number of threads. The gap separated segments are sampled independently,
+ *                 so only data with gaps is processed in parallel. The result is identical
+ *                 to the single threaded result.
  * @return xt::xtensor<size_t, 1> containing indices of values to keep
  *
  * @note The data must be sorted in ascending order. Behavior is undefined for unsorted input.
@@ -52,7 +59,8 @@ namespace helper {
 template<typename T>
 xt::xtensor<size_t, 1> get_index_downsampling(const T& data,
                                               double   downsample_interval,
-                                              double   max_gap = std::numeric_limits<double>::quiet_NaN());
+                                              double   max_gap = std::numeric_limits<double>::quiet_NaN(),
+                                              int      mp_cores = 1);
 
 /**
  * @brief Downsample a sorted data container and return the downsampled values
@@ -81,22 +89,150 @@ xt::xtensor<typename T::value_type, 1> get_value_downsampling(const T& data,
                                                               double   downsample_interval,
                                                               double   max_gap = std::numeric_limits<double>::quiet_NaN());
 
+/**
+ * @brief Min/max (envelope) downsampling of a sorted x / y series
+ *
+ * The x values are split into buckets of width downsample_interval (aligned to the first
+ * value of each gap free segment). For each non empty bucket the indices of the minimum and
+ * the maximum y value are returned (in ascending order, once if they are the same), so that
+ * spikes are preserved. Gaps larger than max_gap are never bridged by a bucket.
+ *
+ * @tparam TX Container type of x (floating point values with .data())
+ * @tparam TY Container type of y (floating point values with .data())
+ * @param x Container of x values, must be sorted in ascending order
+ * @param y Container of y values (same size as x). NaN values are only selected if a bucket
+ *          contains no other values
+ * @param downsample_interval Bucket width in x units.
+ *                            Use 0, negative, or NaN to disable downsampling (return all indices)
+ * @param max_gap Maximum allowed gap in x before considering it a data gap.
+ *                If <= 0 or NaN, defaults to 2x downsample_interval
+ * @return xt::xtensor<size_t, 1> containing indices of values to keep
+ */
+template<typename TX, typename TY>
+xt::xtensor<size_t, 1> get_minmax_downsampling(
+    const TX& x,
+    const TY& y,
+    double    downsample_interval,
+    double    max_gap = std::numeric_limits<double>::quiet_NaN());
+
+/**
+ * @brief Mean downsampling of a sorted x / y series
+ *
+ * The x values are split into buckets like in get_minmax_downsampling. For each non empty
+ * bucket the mean x and the mean y value are returned (NaN y values are ignored, a bucket
+ * with only NaN y values has a NaN mean).
+ *
+ * @tparam TX Container type of x (floating point values with .data())
+ * @tparam TY Container type of y (floating point values with .data())
+ * @param x Container of x values, must be sorted in ascending order
+ * @param y Container of y values (same size as x)
+ * @param downsample_interval Bucket width in x units.
+ *                            Use 0, negative, or NaN to disable downsampling (return copies)
+ * @param max_gap Maximum allowed gap in x before considering it a data gap.
+ *                If <= 0 or NaN, defaults to 2x downsample_interval
+ * @return std::tuple of the mean x values and the mean y values
+ */
+template<typename TX, typename TY>
+std::tuple<xt::xtensor<typename TX::value_type, 1>, xt::xtensor<typename TY::value_type, 1>>
+get_mean_downsampling(const TX& x,
+                      const TY& y,
+                      double    downsample_interval,
+                      double    max_gap = std::numeric_limits<double>::quiet_NaN());
+
+/**
+ * @brief Largest-Triangle-Three-Buckets (LTTB) downsampling of a sorted x / y series
+ *
+ * The first and the last value of each gap free segment are buckets of their own and are always
+ * kept. The values in between are split into buckets like in get_minmax_downsampling. For every
+ * bucket, the value that spans the largest triangle with the previously selected value and the
+ * average of the next bucket (the last value of the segment for the last bucket) is kept (one
+ * value per bucket). This preserves the visual shape of the series.
+ *
+ * @tparam TX Container type of x (floating point values with .data())
+ * @tparam TY Container type of y (floating point values with .data())
+ * @param x Container of x values, must be sorted in ascending order
+ * @param y Container of y values (same size as x)
+ * @param downsample_interval Bucket width in x units.
+ *                            Use 0, negative, or NaN to disable downsampling (return all indices)
+ * @param max_gap Maximum allowed gap in x before considering it a data gap.
+ *                If <= 0 or NaN, defaults to 2x downsample_interval
+ * @return xt::xtensor<size_t, 1> containing indices of values to keep
+ */
+template<typename TX, typename TY>
+xt::xtensor<size_t, 1> get_lttb_downsampling(
+    const TX& x,
+    const TY& y,
+    double    downsample_interval,
+    double    max_gap = std::numeric_limits<double>::quiet_NaN());
+
+/**
+ * @brief Gather values at the given indices (e.g. the indices returned by get_index_downsampling)
+ *
+ * For N dimensional tensors the gather is done along the first axis (whole rows are copied),
+ * so multiple channels that share the first axis with the downsampled data can be gathered
+ * with the same indices.
+ *
+ * @tparam T Container type: std::vector or a contiguous, row major xtensor
+ * @param data Container of values (or rows)
+ * @param indices Indices into the first axis of data
+ * @return xt::xtensor<T::value_type, N> with shape (indices.size(), data.shape()[1:]...)
+ */
+template<typename T>
+auto gather(const T& data, const xt::xtensor<size_t, 1>& indices)
+{
+    using value_type = typename T::value_type;
+
+    constexpr size_t dim = [] {
+        if constexpr (requires { std::tuple_size<typename T::shape_type>::value; })
+            return std::tuple_size<typename T::shape_type>::value;
+        else
+            return size_t(1);
+    }();
+
+    std::array<size_t, dim> shape;
+    if constexpr (requires { data.shape(); })
+        std::copy_n(data.shape().begin(), dim, shape.begin());
+    else
+        shape[0] = data.size();
+
+    const size_t n_rows   = shape[0];
+    const size_t row_size = n_rows > 0 ? data.size() / n_rows : 0;
+
+    shape[0]    = indices.size();
+    auto result = xt::xtensor<value_type, dim>::from_shape(shape);
+
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        if (indices[i] >= n_rows)
+            throw std::out_of_range("ERROR[gather]: index " + std::to_string(indices[i]) +
+                                    " is out of range (size " + std::to_string(n_rows) + ")");
+
+        std::copy_n(data.data() + indices[i] * row_size, row_size, result.data() + i * row_size);
+    }
+
+    return result;
+}
+
 // Explicit instantiation declarations for common types
 extern template xt::xtensor<size_t, 1> get_index_downsampling(const std::vector<float>& data,
                                                               double downsample_interval,
-                                                              double max_gap = std::numeric_limits<double>::quiet_NaN());
+                                                              double max_gap = std::numeric_limits<double>::quiet_NaN(),
+                                                              int mp_cores = 1);
 
 extern template xt::xtensor<size_t, 1> get_index_downsampling(const std::vector<double>& data,
                                                               double downsample_interval,
-                                                              double max_gap = std::numeric_limits<double>::quiet_NaN());
+                                                              double max_gap = std::numeric_limits<double>::quiet_NaN(),
+                                                              int mp_cores = 1);
 
 extern template xt::xtensor<size_t, 1> get_index_downsampling(const xt::xtensor<float, 1>& data,
                                                               double downsample_interval,
-                                                              double max_gap = std::numeric_limits<double>::quiet_NaN());
+                                                              double max_gap = std::numeric_limits<double>::quiet_NaN(),
+                                                              int mp_cores = 1);
 
 extern template xt::xtensor<size_t, 1> get_index_downsampling(const xt::xtensor<double, 1>& data,
                                                               double downsample_interval,
-                                                              double max_gap = std::numeric_limits<double>::quiet_NaN());
+                                                              double max_gap = std::numeric_limits<double>::quiet_NaN(),
+                                                              int mp_cores = 1);
 
 extern template xt::xtensor<float, 1> get_value_downsampling(const std::vector<float>& data,
                                                              double downsample_interval,
@@ -114,6 +250,102 @@ extern template xt::xtensor<double, 1> get_value_downsampling(const xt::xtensor<
                                                               double downsample_interval,
                                                               double max_gap = std::numeric_limits<double>::quiet_NaN());
 
+extern template xt::xtensor<size_t, 1> get_minmax_downsampling(const std::vector<double>& x,
+                                                               const std::vector<double>& y,
+                                                               double downsample_interval,
+                                                               double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_minmax_downsampling(const std::vector<double>& x,
+                                                               const std::vector<float>& y,
+                                                               double downsample_interval,
+                                                               double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_minmax_downsampling(const std::vector<float>& x,
+                                                               const std::vector<float>& y,
+                                                               double downsample_interval,
+                                                               double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_minmax_downsampling(const xt::xtensor<double, 1>& x,
+                                                               const xt::xtensor<double, 1>& y,
+                                                               double downsample_interval,
+                                                               double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_minmax_downsampling(const xt::xtensor<double, 1>& x,
+                                                               const xt::xtensor<float, 1>& y,
+                                                               double downsample_interval,
+                                                               double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_minmax_downsampling(const xt::xtensor<float, 1>& x,
+                                                               const xt::xtensor<float, 1>& y,
+                                                               double downsample_interval,
+                                                               double max_gap);
+
+extern template std::tuple<xt::xtensor<double, 1>, xt::xtensor<double, 1>> get_mean_downsampling(
+    const std::vector<double>& x,
+    const std::vector<double>& y,
+    double downsample_interval,
+    double max_gap);
+
+extern template std::tuple<xt::xtensor<double, 1>, xt::xtensor<float, 1>> get_mean_downsampling(
+    const std::vector<double>& x,
+    const std::vector<float>& y,
+    double downsample_interval,
+    double max_gap);
+
+extern template std::tuple<xt::xtensor<float, 1>, xt::xtensor<float, 1>> get_mean_downsampling(
+    const std::vector<float>& x,
+    const std::vector<float>& y,
+    double downsample_interval,
+    double max_gap);
+
+extern template std::tuple<xt::xtensor<double, 1>, xt::xtensor<double, 1>> get_mean_downsampling(
+    const xt::xtensor<double, 1>& x,
+    const xt::xtensor<double, 1>& y,
+    double downsample_interval,
+    double max_gap);
+
+extern template std::tuple<xt::xtensor<double, 1>, xt::xtensor<float, 1>> get_mean_downsampling(
+    const xt::xtensor<double, 1>& x,
+    const xt::xtensor<float, 1>& y,
+    double downsample_interval,
+    double max_gap);
+
+extern template std::tuple<xt::xtensor<float, 1>, xt::xtensor<float, 1>> get_mean_downsampling(
+    const xt::xtensor<float, 1>& x,
+    const xt::xtensor<float, 1>& y,
+    double downsample_interval,
+    double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_lttb_downsampling(const std::vector<double>& x,
+                                                             const std::vector<double>& y,
+                                                             double downsample_interval,
+                                                             double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_lttb_downsampling(const std::vector<double>& x,
+                                                             const std::vector<float>& y,
+                                                             double downsample_interval,
+                                                             double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_lttb_downsampling(const std::vector<float>& x,
+                                                             const std::vector<float>& y,
+                                                             double downsample_interval,
+                                                             double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_lttb_downsampling(const xt::xtensor<double, 1>& x,
+                                                             const xt::xtensor<double, 1>& y,
+                                                             double downsample_interval,
+                                                             double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_lttb_downsampling(const xt::xtensor<double, 1>& x,
+                                                             const xt::xtensor<float, 1>& y,
+                                                             double downsample_interval,
+                                                             double max_gap);
+
+extern template xt::xtensor<size_t, 1> get_lttb_downsampling(const xt::xtensor<float, 1>& x,
+                                                             const xt::xtensor<float, 1>& y,
+                                                             double downsample_interval,
+                                                             double max_gap);
+
 } // namespace helper
 } // namespace tools
 } // namespace themachinethatgoesping
@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "downsampling_pyramid.hpp"
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "../math/simd.hpp"
+#include "downsampling.hpp"
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace helper {
+
+namespace {
+/// gap between data[i - 1] and data[i], computed like in get_value_downsampling (in double)
+template<std::floating_point T>
+inline double gap_before(const std::vector<T>& data, size_t i)
+{
+    return static_cast<double>(data[i]) - static_cast<double>(data[i - 1]);
+}
+} // namespace
+
+template<std::floating_point T>
+DownsamplingPyramid<T>::DownsamplingPyramid(const std::vector<T>& data,
+                                            double                base_interval,
+                                            size_t                n_levels)
+    : _base_interval(base_interval)
+    , _size(data.size())
+{
+    if (!(base_interval > 0) || !std::isfinite(base_interval))
+        throw std::invalid_argument(fmt::format(
+            "ERROR[DownsamplingPyramid]: base_interval must be positive and finite (got {})",
+            base_interval));
+    if (n_levels == 0 || n_levels > 64)
+        throw std::invalid_argument(fmt::format(
+            "ERROR[DownsamplingPyramid]: n_levels must be in [1, 64] (got {})", n_levels));
+
+    _levels.resize(n_levels);
+    if (data.size() < 2)
+        return;
+
+    // level 0: SIMD pre-selection in T (one ulp below the threshold, so that no gap that is
+    // larger than max_gap in double is missed), then the exact double criterion
+    const T threshold = std::nextafter(math::gap_threshold<T>(get_level_max_gap(0)),
+                                       -std::numeric_limits<T>::infinity());
+    auto candidates = math::find_gaps_dispatch(data.data(), threshold, data.size());
+
+    for (size_t level = 0; level < n_levels; ++level)
+    {
+        const auto& source  = level == 0 ? candidates : _levels[level - 1];
+        const auto  max_gap = get_level_max_gap(level);
+
+        auto& gaps = _levels[level];
+        for (size_t i : source)
+            if (gap_before(data, i) > max_gap)
+                gaps.push_back(i);
+        gaps.shrink_to_fit();
+    }
+}
+
+template<std::floating_point T>
+xt::xtensor<T, 1> DownsamplingPyramid<T>::get_value_downsampling(const std::vector<T>& data,
+                                                                 double downsample_interval,
+                                                                 double max_gap) const
+{
+    const size_t n = data.size();
+
+    // special cases (disabled downsampling, empty data) and queries the pyramid cannot answer
+    if (n < 2 || data.size() != _size || downsample_interval <= 0 ||
+        !std::isfinite(downsample_interval))
+        return helper::get_value_downsampling(data, downsample_interval, max_gap);
+
+    if (max_gap <= 0 || !std::isfinite(max_gap))
+        max_gap = 2.0 * downsample_interval;
+
+    // coarsest level that still contains all gaps > max_gap
+    if (max_gap < get_level_max_gap(0))
+        return helper::get_value_downsampling(data, downsample_interval, max_gap);
+
+    size_t level = 0;
+    while (level + 1 < _levels.size() && get_level_max_gap(level + 1) <= max_gap)
+        ++level;
+    const auto& gaps = _levels[level];
+
+    // same sample sequence as get_value_downsampling, but instead of walking through all data
+    // values only the gaps of the level are visited:
+    // a sample lies in a gap if data[gap - 1] < sample <= data[gap]
+    const double t_min = data.front();
+    const double t_max = data.back();
+
+    std::vector<T> temp_result;
+    temp_result.reserve(static_cast<size_t>((t_max - t_min) / downsample_interval) + 1);
+
+    size_t gap_idx        = 0;
+    double current_sample = t_min;
+    temp_result.push_back(static_cast<T>(current_sample));
+    current_sample += downsample_interval;
+
+    while (current_sample <= t_max)
+    {
+        // skip gaps that end before the current sample and gaps that are not larger than max_gap
+        while (gap_idx < gaps.size() &&
+               (static_cast<double>(data[gaps[gap_idx]]) < current_sample ||
+                !(gap_before(data, gaps[gap_idx]) > max_gap)))
+            ++gap_idx;
+
+        if (gap_idx < gaps.size() && static_cast<double>(data[gaps[gap_idx] - 1]) < current_sample)
+        {
+            // gap detected - restart at the first value after the gap
+            const size_t data_idx = gaps[gap_idx++];
+            current_sample        = data[data_idx];
+            temp_result.push_back(static_cast<T>(current_sample));
+
+            // get_value_downsampling stops when the last value is reached
+            if (data_idx == n - 1)
+                break;
+
+            current_sample += downsample_interval;
+            continue;
+        }
+
+        temp_result.push_back(static_cast<T>(current_sample));
+        current_sample += downsample_interval;
+    }
+
+    xt::xtensor<T, 1> result = xt::xtensor<T, 1>::from_shape({ temp_result.size() });
+    std::copy(temp_result.begin(), temp_result.end(), result.begin());
+    return result;
+}
+
+template class DownsamplingPyramid<float>;
+template class DownsamplingPyramid<double>;
+
+} // namespace helper
+} // namespace tools
+} // namespace themachinethatgoesping
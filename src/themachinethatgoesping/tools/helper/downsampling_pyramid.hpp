@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief Cached multi-level gap index for repeated get_value_downsampling calls on the same data
+ * @authors Peter Urban
+ */
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/downsampling_pyramid.doc.hpp"
+
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <xtensor/containers/xtensor.hpp>
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace helper {
+
+/**
+ * @brief Multi-resolution gap index of a sorted series for fast get_value_downsampling queries
+ *
+ * Level k stores the positions of all gaps larger than 2 * base_interval * 2^k (the default
+ * max_gap of downsample_interval = base_interval * 2^k). A query is answered from the coarsest
+ * level whose gaps are a superset of the gaps of the requested max_gap, so its cost is
+ * proportional to the output size plus the number of gaps in that level, independent of the
+ * data size. The result is identical to helper::get_value_downsampling(data, ...).
+ *
+ * The pyramid does not store the data itself. Queries must pass the same (unchanged) data that
+ * was used for building the pyramid.
+ *
+ * @tparam T floating point type of the data values
+ */
+template<std::floating_point T>
+class DownsamplingPyramid
+{
+    double                           _base_interval = 0;
+    size_t                           _size          = 0;
+    std::vector<std::vector<size_t>> _levels; ///< gap positions (index after the gap) per level
+
+  public:
+    /**
+     * @brief Build the pyramid for sorted data (O(n) for the first level, levels above are
+     * filtered from the level below)
+     *
+     * @param data sorted data values (e.g. the x values of an interpolator)
+     * @param base_interval finest downsample interval of the pyramid (must be > 0 and finite)
+     * @param n_levels number of levels (intervals base_interval * 2^k, k = 0 .. n_levels - 1)
+     */
+    DownsamplingPyramid(const std::vector<T>& data, double base_interval, size_t n_levels = 16);
+
+    /**
+     * @brief Same result as helper::get_value_downsampling(data, downsample_interval, max_gap)
+     *
+     * Falls back to helper::get_value_downsampling if max_gap is smaller than the max_gap of the
+     * finest level or if data does not have the size of the data used for building the pyramid.
+     *
+     * @param data the data the pyramid was built for
+     * @param downsample_interval Interval between samples.
+     *                            Use 0, negative, or NaN to disable downsampling (copy all values)
+     * @param max_gap Maximum allowed gap before considering it a data gap.
+     *                If <= 0 or NaN, defaults to 2x downsample_interval
+     * @return xt::xtensor<T, 1> downsampled values
+     */
+    xt::xtensor<T, 1> get_value_downsampling(
+        const std::vector<T>& data,
+        double                downsample_interval,
+        double                max_gap = std::numeric_limits<double>::quiet_NaN()) const;
+
+    // ----- getters -----
+    double get_base_interval() const { return _base_interval; }
+    size_t get_number_of_levels() const { return _levels.size(); }
+
+    /**
+     * @brief Size of the data the pyramid was built for
+     */
+    size_t size() const { return _size; }
+
+    /**
+     * @brief Gaps of a level are all gaps larger than this value
+     */
+    double get_level_max_gap(size_t level) const
+    {
+        return std::ldexp(2.0 * _base_interval, int(level));
+    }
+
+    /**
+     * @brief Gap positions (index of the first value after the gap) of a level
+     */
+    const std::vector<size_t>& get_level_gaps(size_t level) const { return _levels.at(level); }
+};
+
+/**
+ * @brief Lazily built DownsamplingPyramid, must be invalidated whenever the data changes
+ *
+ * get() builds the pyramid on the first call and is safe to call concurrently (e.g. from const
+ * methods that are called from several threads). The returned pyramid is immutable and stays
+ * valid after invalidate(). Copies share the built pyramid (the copied data is identical).
+ * Invalidation must not run concurrently with reads of the data.
+ *
+ * @tparam T floating point type of the data values
+ */
+template<std::floating_point T>
+class DownsamplingPyramidCache
+{
+    mutable std::shared_ptr<const DownsamplingPyramid<T>> _pyramid;
+    mutable std::mutex                                    _mutex;
+
+  public:
+    DownsamplingPyramidCache() = default;
+    DownsamplingPyramidCache(const DownsamplingPyramidCache& other)
+        : _pyramid(other.get_cached())
+    {
+    }
+    DownsamplingPyramidCache& operator=(const DownsamplingPyramidCache& other)
+    {
+        if (this != &other)
+        {
+            auto pyramid = other.get_cached();
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pyramid = std::move(pyramid);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Return the cached pyramid or build (and cache) it for data
+     *
+     * The pyramid is rebuilt if the cached pyramid was built for data of a different size.
+     */
+    std::shared_ptr<const DownsamplingPyramid<T>> get(const std::vector<T>& data,
+                                                      double                base_interval,
+                                                      size_t                n_levels) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_pyramid || _pyramid->size() != data.size())
+            _pyramid =
+                std::make_shared<const DownsamplingPyramid<T>>(data, base_interval, n_levels);
+
+        return _pyramid;
+    }
+
+    /**
+     * @brief Cached pyramid (nullptr if it is not built)
+     */
+    std::shared_ptr<const DownsamplingPyramid<T>> get_cached() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _pyramid;
+    }
+
+    void invalidate()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pyramid.reset();
+    }
+};
+
+extern template class DownsamplingPyramid<float>;
+extern template class DownsamplingPyramid<double>;
+
+} // namespace helper
+} // namespace tools
+} // namespace themachinethatgoesping
@@ -25,6 +25,7 @@
 /* generated doc strings */
 #include ".docstrings/isviewstream.doc.hpp"
 
+#include <cstring>
 #include <istream>
 #include <streambuf>
 #include <string_view>
@@ -77,6 +78,25 @@ class sviewbuf : public std::streambuf
         : sviewbuf(str.data(), str.size())
     {
     }
+
+    /**
+     * Read without going through the (virtual) std::streambuf interface.
+     *
+     * @return number of bytes read (smaller than count if the end of the view is reached)
+     */
+    std::size_t read_direct(char* s, std::size_t count)
+    {
+        const auto available = static_cast<std::size_t>(egptr() - gptr());
+        if (count > available)
+            count = available;
+
+        if (count > 0)
+        {
+            std::memcpy(s, gptr(), count);
+            setg(eback(), gptr() + count, egptr());
+        }
+        return count;
+    }
 };
 
 /**
@@ -100,6 +120,21 @@ class isviewstream
         , std::istream(static_cast<std::streambuf*>(this))
     {
     }
+
+    /**
+     * Same as read, but without going through the (virtual) std::streambuf interface.
+     * Sets failbit and eofbit if the end of the view is reached before count bytes are read,
+     * and only failbit if the stream was not good before (same as std::istream::read).
+     */
+    isviewstream& read_direct(char* s, std::size_t count)
+    {
+        if (!good())
+            setstate(std::ios_base::failbit);
+        else if (sviewbuf::read_direct(s, count) != count)
+            setstate(std::ios_base::failbit | std::ios_base::eofbit);
+
+        return *this;
+    }
 };
 
 } // namespace themachinethatgoesping::tools::helper
\ No newline at end of file
@@ -19,8 +19,10 @@
 
 #include <cstring>
 #include <ostream>
+#include <span>
 #include <streambuf>
 #include <string>
+#include <type_traits>
 
 namespace themachinethatgoesping::tools::helper {
 
@@ -44,11 +46,9 @@ class string_output_buf : public std::streambuf
     /// Get the current size of the buffer.
     std::size_t size() const { return _buffer.size(); }
 
-  protected:
-    std::streamsize xsputn(const char* s, std::streamsize n) override
+    /// Write without going through the (virtual) std::streambuf interface.
+    void write_direct(const char* s, std::size_t count)
     {
-        const auto count = static_cast<std::size_t>(n);
-
         if (_pos == _buffer.size())
         {
             // Fast path: appending at end (common case, no zero-fill overhead)
@@ -63,6 +63,12 @@ class string_output_buf : public std::streambuf
             std::memcpy(_buffer.data() + _pos, s, count);
         }
         _pos += count;
+    }
+
+  protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        write_direct(s, static_cast<std::size_t>(n));
         return n;
     }
 
@@ -130,6 +136,98 @@ class osstream
 
     /// Get the current size of the buffer.
     using string_output_buf::size;
+
+    /// Write without going through the (virtual) std::streambuf interface.
+    using string_output_buf::write_direct;
 };
 
+/**
+ * std::streambuf implementation that writes into a caller-owned, fixed size buffer (e.g. a
+ * shared memory segment or a memory mapped file region). Writing past the end of the buffer
+ * writes nothing and is reported as a failed write (the stream sets badbit).
+ */
+class span_output_buf : public std::streambuf
+{
+  public:
+    explicit span_output_buf(std::span<char> buffer)
+        : _buffer(buffer)
+        , _pos(0)
+    {
+    }
+
+    /// Number of bytes written.
+    std::size_t size() const { return _pos; }
+
+    /// Write without going through the (virtual) std::streambuf interface.
+    /// Returns false (and writes nothing) if the data does not fit into the buffer.
+    bool write_direct(const char* s, std::size_t count)
+    {
+        if (count > _buffer.size() - _pos)
+            return false;
+
+        std::memcpy(_buffer.data() + _pos, s, count);
+        _pos += count;
+        return true;
+    }
+
+  protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        return write_direct(s, static_cast<std::size_t>(n)) ? n : 0;
+    }
+
+    int_type overflow(int_type ch) override
+    {
+        if (ch == traits_type::eof())
+            return ch;
+
+        const auto c = static_cast<char>(ch);
+        return write_direct(&c, 1) ? ch : traits_type::eof();
+    }
+
+  private:
+    std::span<char> _buffer;
+    std::size_t     _pos;
+};
+
+/**
+ * A std::ostream that writes into a caller-owned, fixed size buffer without allocating.
+ * The stream state is set to bad if the data does not fit.
+ *
+ * Usage:
+ *   ospanstream os(std::span<char>(data, size));
+ *   obj.to_stream(os);
+ *   if (!os) ... // buffer too small
+ */
+class ospanstream
+    : private span_output_buf
+    , public std::ostream
+{
+  public:
+    explicit ospanstream(std::span<char> buffer)
+        : span_output_buf(buffer)
+        , std::ostream(static_cast<std::streambuf*>(this))
+    {
+    }
+
+    /// Number of bytes written.
+    using span_output_buf::size;
+
+    /// Write without going through the (virtual) std::streambuf interface (sets badbit if the
+    /// data does not fit).
+    void write_direct(const char* s, std::size_t count)
+    {
+        if (!span_output_buf::write_direct(s, count))
+            setstate(std::ios_base::badbit);
+    }
+};
+
+/**
+ * True if T_ostream is (derived from) osstream or ospanstream. Serialization code that knows the
+ * static stream type can then call write_direct instead of std::ostream::write.
+ */
+template<typename T_ostream>
+inline constexpr bool has_write_direct =
+    std::is_base_of_v<osstream, T_ostream> || std::is_base_of_v<ospanstream, T_ostream>;
+
 } // namespace themachinethatgoesping::tools::helper
@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+// This file provides explicit instantiations of the SectionTracker
+// The instantiations are marked extern in the header to avoid instantiation with header inclusion
+
+#include "section_tracker.hpp"
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace helper {
+
+template class SectionTracker<float>;
+template class SectionTracker<double>;
+
+} // namespace helper
+} // namespace tools
+} // namespace themachinethatgoesping
@@ -0,0 +1,331 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief Incremental (append only) version of get_sections for growing time series
+ * @authors Peter Urban
+ */
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/section_tracker.doc.hpp"
+
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "../classhelper/classversion.hpp"
+#include "../classhelper/objectprinter.hpp"
+#include "../classhelper/stream.hpp"
+#include "../classhelper/taggedfields.hpp"
+#include "container_intersection.hpp"
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace helper {
+
+/**
+ * @brief Track the gap separated sections of an append only, sorted series of values
+ *
+ * Appending a chunk costs O(chunk): only the last (open) section is extended or new
+ * sections are started. At any point get_sections() returns the same sections as
+ * helper::get_sections(all_appended_values, max_gap).
+ *
+ * @tparam T floating point type of the tracked values
+ */
+template<std::floating_point T>
+class SectionTracker
+{
+    double                _max_gap = std::numeric_limits<double>::quiet_NaN();
+    size_t                _size    = 0;
+    std::vector<Range<T>> _sections; ///< closed sections followed by the open (last) section
+
+    /// same gap criterion as helper::get_sections (max_gap <= 0 or NaN: no gaps)
+    bool is_gap(double gap) const
+    {
+        return std::isfinite(_max_gap) && _max_gap > 0 && gap > _max_gap;
+    }
+
+  public:
+    /**
+     * @brief Construct a new Section Tracker object
+     *
+     * @param max_gap Maximum allowed gap between consecutive values before starting a new section.
+     *                If <= 0 or NaN, all values are part of a single section.
+     */
+    explicit SectionTracker(double max_gap = std::numeric_limits<double>::quiet_NaN())
+        : _max_gap(max_gap)
+    {
+    }
+
+    bool operator==(const SectionTracker& other) const
+    {
+        // NaN max_gap (the default) should compare equal
+        bool same_max_gap = _max_gap == other._max_gap ||
+                            (std::isnan(_max_gap) && std::isnan(other._max_gap));
+
+        return same_max_gap && _size == other._size && _sections == other._sections;
+    }
+
+    /**
+     * @brief Append a single value (must not be smaller than the last appended value)
+     */
+    void append(T value)
+    {
+        if (_sections.empty())
+        {
+            _sections.emplace_back(value, value);
+            ++_size;
+            return;
+        }
+
+        auto& open_section = _sections.back();
+        if (!(value >= open_section.max))
+            throw std::invalid_argument(fmt::format(
+                "ERROR[SectionTracker::append]: values must be appended in ascending order "
+                "(got {} after {})",
+                value,
+                open_section.max));
+
+        if (is_gap(static_cast<double>(value - open_section.max)))
+            _sections.emplace_back(value, value);
+        else
+            open_section.max = value;
+
+        ++_size;
+    }
+
+    /**
+     * @brief Append a sorted chunk of values (O(chunk))
+     *
+     * The chunk is checked before it is appended: if it is not sorted, contains NaN or starts
+     * below the last appended value, nothing is appended.
+     *
+     * @tparam t_container Container type (must support .size() and element access)
+     * @param values values to append, sorted in ascending order
+     */
+    template<typename t_container>
+    void extend(const t_container& values)
+    {
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            const T value = static_cast<T>(values[i]);
+            if (std::isnan(value))
+                throw std::invalid_argument(fmt::format(
+                    "ERROR[SectionTracker::extend]: value {} of the chunk is NaN", i));
+
+            if (i == 0 && _sections.empty())
+                continue;
+
+            const T previous = i > 0 ? static_cast<T>(values[i - 1]) : _sections.back().max;
+            if (!(value >= previous))
+                throw std::invalid_argument(fmt::format(
+                    "ERROR[SectionTracker::extend]: values must be appended in ascending order "
+                    "(got {} after {} at chunk index {})",
+                    value,
+                    previous,
+                    i));
+        }
+
+        for (size_t i = 0; i < values.size(); ++i)
+            append(static_cast<T>(values[i]));
+    }
+
+    /**
+     * @brief Reset the tracker (keeps max_gap)
+     */
+    void clear()
+    {
+        _sections.clear();
+        _size = 0;
+    }
+
+    // ----- getters -----
+    double get_max_gap() const { return _max_gap; }
+
+    /**
+     * @brief Number of values appended so far
+     */
+    size_t size() const { return _size; }
+    bool   empty() const { return _size == 0; }
+
+    /**
+     * @brief All sections (the last one is the open section that may still grow)
+     */
+    const std::vector<Range<T>>& get_sections() const { return _sections; }
+
+    /**
+     * @brief The open (last) section
+     *
+     * @return const Range<T>&
+     */
+    const Range<T>& get_open_section() const
+    {
+        if (_sections.empty())
+            throw std::runtime_error(
+                "ERROR[SectionTracker::get_open_section]: no values have been appended");
+
+        return _sections.back();
+    }
+
+    /**
+     * @brief Intersect the sections of this tracker with the sections of another tracker
+     */
+    std::vector<Range<T>> get_shared_sections(const SectionTracker& other) const
+    {
+        return intersect_sections(_sections, other._sections);
+    }
+
+    /**
+     * @brief Intersect the sections of multiple trackers (same result as
+     * helper::get_shared_sections on the appended values)
+     */
+    static std::vector<Range<T>> get_shared_sections(const std::vector<SectionTracker>& trackers)
+    {
+        if (trackers.empty())
+            return {};
+
+        std::vector<Range<T>> result = trackers[0]._sections;
+        for (size_t i = 1; i < trackers.size() && !result.empty(); ++i)
+            result = intersect_sections(result, trackers[i]._sections);
+
+        return result;
+    }
+
+    // ----- file I/O -----
+    /**
+     * @brief Read a tracker written with to_stream
+     */
+    static SectionTracker from_stream(std::istream& is)
+    {
+        classhelper::read_version(is, "SectionTracker_V2", "SectionTracker");
+        return from_fields(classhelper::TaggedFields::from_stream(is));
+    }
+
+    /**
+     * @brief Same as from_stream, but reads directly from a buffer (used by from_binary)
+     */
+    static SectionTracker from_cursor(classhelper::ByteCursor& cursor)
+    {
+        cursor.read_version("SectionTracker_V2", "SectionTracker");
+        return from_fields(classhelper::TaggedFields::from_cursor(cursor));
+    }
+
+    /**
+     * @brief Write the tracker as tagged fields (SectionTracker_V2, see
+     * classhelper::TaggedFieldWriter): readers skip fields they do not know, so fields can be
+     * added without breaking existing files
+     *
+     * @tparam T_ostream static stream type (to_binary passes helper::osstream, which is written
+     * without the std::streambuf interface)
+     */
+    template<typename T_ostream>
+    void to_stream(T_ostream& os) const
+    {
+        classhelper::write_version(os, "SectionTracker_V2");
+
+        classhelper::TaggedFieldWriter<T_ostream> fields(os);
+        visit_fields(fields);
+    }
+
+    /**
+     * @brief Feed the same bytes as to_stream into a hasher (used by binary_hash)
+     */
+    void hash_to(classhelper::BinaryHasher& hasher) const
+    {
+        hasher.update_version("SectionTracker_V2");
+
+        classhelper::TaggedFieldHasher fields(hasher);
+        visit_fields(fields);
+    }
+
+    /**
+     * @brief Number of bytes to_stream writes (used by to_binary to allocate the result once)
+     */
+    size_t binary_size() const
+    {
+        classhelper::TaggedFieldSizer fields;
+        visit_fields(fields);
+        return std::string_view("SectionTracker_V2").size() + fields.size();
+    }
+
+  private:
+    /// field tags of the SectionTracker_V2 layout (never reuse a tag for a different field)
+    enum t_field : classhelper::t_field_tag
+    {
+        field_max_gap  = 1,
+        field_size     = 2,
+        field_sections = 3
+    };
+
+    /// write all fields to a TaggedFieldWriter, TaggedFieldHasher or TaggedFieldSizer
+    template<typename T_fields>
+    void visit_fields(T_fields& fields) const
+    {
+        fields.write_value(field_max_gap, _max_gap);
+        fields.write_value(field_size, _size);
+        fields.write_container(field_sections, _sections);
+        fields.finish();
+    }
+
+    static SectionTracker from_fields(const classhelper::TaggedFields& fields)
+    {
+        SectionTracker tracker;
+        tracker._max_gap  = fields.read_value<double>(field_max_gap);
+        tracker._size     = fields.read_value<size_t>(field_size);
+        tracker._sections = fields.read_container<std::vector<Range<T>>>(field_sections);
+
+        return tracker;
+    }
+
+  public:
+    classhelper::ObjectPrinter __printer__(unsigned int float_precision,
+                                           bool         superscript_exponents) const
+    {
+        classhelper::ObjectPrinter printer(
+            "SectionTracker", float_precision, superscript_exponents);
+
+        printer.register_value("max_gap", _max_gap);
+        printer.register_value("size", _size, "values");
+        printer.register_value("sections", _sections.size());
+
+        if (!_sections.empty())
+        {
+            std::vector<T> section_min, section_max;
+            section_min.reserve(_sections.size());
+            section_max.reserve(_sections.size());
+            for (const auto& section : _sections)
+            {
+                section_min.push_back(section.min);
+                section_max.push_back(section.max);
+            }
+
+            printer.register_section("sections");
+            printer.register_container("min", section_min);
+            printer.register_container("max", section_max);
+        }
+
+        return printer;
+    }
+
+  public:
+    // -- class helper function macros --
+    // define to_binary and from_binary functions (based on to/from stream)
+    __STREAM_DEFAULT_TOFROM_BINARY_FUNCTIONS__(SectionTracker)
+    // define info_string and print functions (needs the __printer__ function)
+    __CLASSHELPER_DEFAULT_PRINTING_FUNCTIONS__
+};
+
+extern template class SectionTracker<float>;
+extern template class SectionTracker<double>;
+
+} // namespace helper
+} // namespace tools
+} // namespace themachinethatgoesping
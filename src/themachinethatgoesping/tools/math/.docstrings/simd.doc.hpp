@@ -1,4 +1,4 @@
-//sourcehash: bbcd780ff8796ac6c969e15f8eea571ba7aa7027e668e5ae7f7da28dbc4a1fb8
+//sourcehash: a84b545595d772693dece3de93ebebee15c5a4297a9302cd9cce847fea0a25bd
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -41,6 +41,86 @@
 #endif
 
 
+static const char *mkd_doc_themachinethatgoesping_tools_math_c_convertible_input =
+R"doc(Input types supported by fma_convert_dispatch for a given output type.
+int16/uint16 raw counts -> float/double, float storage -> double.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_find_gaps_dispatch =
+R"doc(Find the positions of gaps in an array: all i in [1, n) with x[i] - x[i -
+1] > threshold
+
+The differences are computed in T. NaN differences are never gaps. Use
+gap_threshold<T>(max_gap) to convert a double max_gap into an
+equivalent threshold.
+
+Template parameter ``T``:
+    Floating-point element type (float or double).
+
+Parameter ``gaps``:
+    Output array of gap positions, must hold at least n - 1 elements.
+
+Parameter ``x``:
+    Input array, must hold at least ``n`` elements.
+
+Parameter ``threshold``:
+    A difference larger than threshold is a gap.
+
+Parameter ``n``:
+    Number of elements of x.
+
+Returns:
+    number of gaps written to ``gaps``)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_find_gaps_dispatch_2 =
+R"doc(Returning variant: positions i in [1, n) with x[i] - x[i - 1] >
+threshold
+
+Processes the array in blocks, so no n sized temporary buffer is
+needed.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_find_gaps_dispatch_kernel = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_find_gaps_dispatch_kernel_operator_call = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_fma_convert_dispatch =
+R"doc(Compute out[i] = TOut(x[i]) * slope + base (decode + calibrate in one
+pass)
+
+Converts raw samples (int16/uint16 counts, or float storage for double
+output) to the output precision inside the SIMD registers, so no
+intermediate full-size converted array is needed.
+
+Template parameter ``TOut``:
+    Floating-point output type (float or double).
+
+Template parameter ``TIn``:
+    Input type: int16_t, uint16_t, or float (only for double output).
+
+Parameter ``out``:
+    Output array, must hold at least ``n`` elements.
+
+Parameter ``x``:
+    Input array, must hold at least ``n`` elements.
+
+Parameter ``slope``:
+    Scalar multiplier (scale).
+
+Parameter ``base``:
+    Scalar addend (offset).
+
+Parameter ``n``:
+    Number of elements to process.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_fma_convert_dispatch_2 = R"doc(Returning variant: out = fma_convert_dispatch(x, slope, base))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_fma_convert_dispatch_3 =
+R"doc(Write into an xtensor view/container: fma_convert_dispatch(view, x,
+slope, base))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_fma_convert_dispatch_kernel = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_fma_convert_dispatch_kernel_operator_call = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_math_fma_dispatch = R"doc(Returning variant: out = fma_dispatch(x, slope, base))doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_math_fma_dispatch_2 =
@@ -64,6 +144,34 @@ static const char *mkd_doc_themachinethatgoesping_tools_math_fma_xtensor_2 =
 R"doc(Write into an xtensor view/container: fma_xtensor(view, x, slope,
 base))doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_math_fmab_convert_dispatch =
+R"doc(Compute out[i] = double(x[i]) * slope + base[i] (float storage,
+double accumulation)
+
+With out == base this accumulates a float array into a double
+accumulator in-place.
+
+Parameter ``out``:
+    Output array, must hold at least ``n`` elements.
+
+Parameter ``x``:
+    Float input array, must hold at least ``n`` elements.
+
+Parameter ``slope``:
+    Scalar multiplier.
+
+Parameter ``base``:
+    Per-element double addend array, must hold at least ``n`` elements.
+
+Parameter ``n``:
+    Number of elements to process.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_fmab_convert_dispatch_2 = R"doc(Returning variant: out = fmab_convert_dispatch(x, slope, base_arr))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_fmab_convert_dispatch_kernel = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_fmab_convert_dispatch_kernel_operator_call = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_math_fmab_dispatch = R"doc(Returning variant: out = fmab_dispatch(x, slope, base_arr))doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_math_fmab_dispatch_2 =
@@ -74,10 +182,100 @@ static const char *mkd_doc_themachinethatgoesping_tools_math_fmab_dispatch_kerne
 
 static const char *mkd_doc_themachinethatgoesping_tools_math_fmab_dispatch_kernel_operator_call = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_math_float_to_half =
+R"doc(Convert a float to the bit pattern of the nearest IEEE 754 half value
+(round to nearest even). Values above the half range become +-inf, NaN
+becomes quiet NaN.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_float_to_half_dispatch =
+R"doc(Convert floats to IEEE 754 half bit patterns (round to nearest even)
+
+Parameter ``out``:
+    Output array of half bit patterns, must hold at least ``n`` elements.
+
+Parameter ``x``:
+    Float input array, must hold at least ``n`` elements.
+
+Parameter ``n``:
+    Number of elements to process.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_float_to_half_dispatch_2 = R"doc(Returning variant: out = float_to_half_dispatch(x))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_float_to_half_dispatch_kernel = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_float_to_half_dispatch_kernel_operator_call = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_gap_threshold =
+R"doc(Largest T that is <= max_gap
+
+For T values a, b: (a - b) > gap_threshold<T>(max_gap) <=> (a - b) >
+max_gap, so gaps defined by a double max_gap can be detected without
+converting float data to double. Non finite max_gap values are
+returned unchanged (converted to T).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_get_streaming_store_threshold =
+R"doc(Get the output size in bytes above which t_store_mode::automatic uses
+streaming stores)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_half_to_float = R"doc(Convert the bit pattern of an IEEE 754 half value to float (exact))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_half_to_float_dispatch =
+R"doc(Convert IEEE 754 half bit patterns to floats
+
+Parameter ``out``:
+    Float output array, must hold at least ``n`` elements.
+
+Parameter ``x``:
+    Input array of half bit patterns, must hold at least ``n`` elements.
+
+Parameter ``n``:
+    Number of elements to process.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_half_to_float_dispatch_2 = R"doc(Returning variant: out = half_to_float_dispatch(x))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_half_to_float_dispatch_kernel = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_half_to_float_dispatch_kernel_operator_call = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_math_operator_call = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_math_operator_call_2 = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_math_prefetch_read =
+R"doc(Prefetch the cache line at ptr for reading (non-temporal hint))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_set_streaming_store_threshold =
+R"doc(Set the output size in bytes above which t_store_mode::automatic uses
+streaming stores (process wide). Use 0 to always stream, SIZE_MAX to
+never stream.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_store_stream =
+R"doc(Non-temporal store of a batch (out must be aligned to Arch::alignment())
+Falls back to an aligned regular store where no streaming store is
+available.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_stream_fence =
+R"doc(Order streaming stores before subsequent stores (must follow a
+store_stream loop))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_t_store_mode = R"doc(store mode of fma_dispatch / fmab_dispatch)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_t_store_mode_automatic =
+R"doc(streaming stores if the output exceeds get_streaming_store_threshold())doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_t_store_mode_regular = R"doc(regular (cached) stores)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_t_store_mode_streaming =
+R"doc(non-temporal stores + software prefetch (x86; regular stores on AArch64))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_use_streaming_stores =
+R"doc(Resolve a t_store_mode for an output of output_bytes bytes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_math_with_simd_modes =
+R"doc(Call f(load_mode, std::bool_constant<streaming>) with the tags selected
+by the runtime flags, so that the kernel loop is compiled once per
+combination without branches inside.)doc";
+
 #if defined(__GNUG__)
 #pragma GCC diagnostic pop
 #endif
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief Aligned allocator and container typedefs for SIMD-heavy code paths.
+ *
+ * Buffers allocated with aligned_allocator start on a 64 byte boundary
+ * (one cache line, one AVX-512 register). The dispatch kernels in simd.hpp
+ * detect such buffers and switch to aligned loads/stores, avoiding loads
+ * that are split across two cache lines.
+ *
+ * @authors Peter Urban
+ */
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/aligned.doc.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <xsimd/xsimd.hpp>
+#include <xtensor/containers/xtensor.hpp>
+
+namespace themachinethatgoesping {
+namespace tools {
+namespace math {
+
+/// Alignment (in bytes) of buffers allocated by aligned_allocator.
+/// 64 bytes = one cache line = the widest register of dispatch_arch_list (avx512).
+inline constexpr size_t simd_alignment = 64;
+
+template<typename T>
+using aligned_allocator = xsimd::aligned_allocator<T, simd_alignment>;
+
+template<typename T>
+using aligned_vector = std::vector<T, aligned_allocator<T>>;
+
+template<typename T, size_t Dim>
+using aligned_xtensor = xt::xtensor<T, Dim, xt::layout_type::row_major, aligned_allocator<T>>;
+
+/**
+ * @brief Create an uninitialized 1D aligned_xtensor of size n
+ */
+template<typename T>
+inline aligned_xtensor<T, 1> make_aligned_xtensor(size_t n)
+{
+    return aligned_xtensor<T, 1>::from_shape({ n });
+}
+
+/**
+ * @brief Check if ptr is aligned to a multiple of alignment bytes
+ */
+inline bool is_aligned(const void* ptr, size_t alignment = simd_alignment) noexcept
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+} // namespace math
+} // namespace tools
+} // namespace themachinethatgoesping
@@ -4,6 +4,10 @@
 
 #include "simd.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
 #include <xtensor/containers/xadapt.hpp>
 #include <xtensor/core/xmath.hpp>
 #include <xtensor/core/xnoalias.hpp>
@@ -31,6 +35,64 @@ std::string fma_dispatch_arch()
     return xsimd::dispatch<dispatch_arch_list>(arch_name_kernel{})();
 }
 
+// ---------------------------------------------------------------------------
+// streaming store threshold (process wide)
+// ---------------------------------------------------------------------------
+namespace {
+std::atomic<size_t> streaming_store_threshold{ default_streaming_store_threshold };
+} // anonymous namespace
+
+void set_streaming_store_threshold(size_t bytes)
+{
+    streaming_store_threshold.store(bytes, std::memory_order_relaxed);
+}
+
+size_t get_streaming_store_threshold()
+{
+    return streaming_store_threshold.load(std::memory_order_relaxed);
+}
+
+// ---------------------------------------------------------------------------
+// parallel chunking for the mp_cores variants
+// ---------------------------------------------------------------------------
+namespace {
+
+/**
+ * @brief Split [0, n) into one chunk per thread and call process_chunk(offset, count) in parallel.
+ * Chunk borders are placed on cache line boundaries of out, so that no two threads write to the
+ * same cache line and every chunk (except the first) starts aligned.
+ */
+template<typename T, typename t_function>
+void for_each_chunk(T* out, size_t n, int mp_cores, t_function&& process_chunk)
+{
+    const size_t max_threads = n * sizeof(T) / parallel_min_bytes_per_thread;
+    const size_t threads     = std::min(size_t(std::max(mp_cores, 1)), max_threads);
+
+    if (threads <= 1)
+    {
+        process_chunk(size_t(0), n);
+        return;
+    }
+
+    constexpr size_t line = simd_alignment / sizeof(T); // elements per cache line
+    // elements until out reaches the next cache line boundary
+    const size_t misalignment = reinterpret_cast<std::uintptr_t>(out) % simd_alignment;
+    const size_t head         = ((simd_alignment - misalignment) % simd_alignment) / sizeof(T);
+    const size_t chunk = ((n + threads - 1) / threads + line - 1) / line * line;
+
+#pragma omp parallel for num_threads(int(threads)) schedule(static)
+    for (int64_t t = 0; t < int64_t(threads); ++t)
+    {
+        const size_t begin = t == 0 ? 0 : std::min(n, head + size_t(t) * chunk);
+        const size_t end =
+            size_t(t) + 1 == threads ? n : std::min(n, head + size_t(t + 1) * chunk);
+        if (begin < end)
+            process_chunk(begin, end - begin);
+    }
+}
+
+} // anonymous namespace
+
 // ---------------------------------------------------------------------------
 // fma_dispatch — the dispatch call itself needs NO architecture-specific flags.
 // The per-arch template instantiations live in simd_x86_64_v{1..4}.cpp,
@@ -38,28 +100,123 @@ std::string fma_dispatch_arch()
 // ---------------------------------------------------------------------------
 
 template <std::floating_point T>
-void fma_dispatch(T* out, const T* x, T slope, T base, size_t n)
+void fma_dispatch(
+    T* out, const T* x, T slope, T base, size_t n, t_store_mode store_mode, int mp_cores)
 {
-    xsimd::dispatch<dispatch_arch_list>(fma_dispatch_kernel{})(out, x, slope, base, n);
+    const bool streaming = use_streaming_stores(store_mode, n * sizeof(T));
+    auto       kernel    = xsimd::dispatch<dispatch_arch_list>(fma_dispatch_kernel{});
+
+    for_each_chunk(out, n, mp_cores, [&](size_t offset, size_t count) {
+        kernel(out + offset, x + offset, slope, base, count, streaming);
+    });
 }
 
 // Explicit instantiations
-template void fma_dispatch<float>(float*, const float*, float, float, size_t);
-template void fma_dispatch<double>(double*, const double*, double, double, size_t);
+template void fma_dispatch<float>(float*, const float*, float, float, size_t, t_store_mode, int);
+template void fma_dispatch<double>(
+    double*, const double*, double, double, size_t, t_store_mode, int);
 
 // ---------------------------------------------------------------------------
 // fmab_dispatch — FMA with array base
 // ---------------------------------------------------------------------------
 
 template <std::floating_point T>
-void fmab_dispatch(T* out, const T* x, T slope, const T* base, size_t n)
+void fmab_dispatch(
+    T* out, const T* x, T slope, const T* base, size_t n, t_store_mode store_mode, int mp_cores)
 {
-    xsimd::dispatch<dispatch_arch_list>(fmab_dispatch_kernel{})(out, x, slope, base, n);
+    const bool streaming = use_streaming_stores(store_mode, n * sizeof(T));
+    auto       kernel    = xsimd::dispatch<dispatch_arch_list>(fmab_dispatch_kernel{});
+
+    for_each_chunk(out, n, mp_cores, [&](size_t offset, size_t count) {
+        kernel(out + offset, x + offset, slope, base + offset, count, streaming);
+    });
 }
 
 // Explicit instantiations
-template void fmab_dispatch<float>(float*, const float*, float, const float*, size_t);
-template void fmab_dispatch<double>(double*, const double*, double, const double*, size_t);
+template void fmab_dispatch<float>(
+    float*, const float*, float, const float*, size_t, t_store_mode, int);
+template void fmab_dispatch<double>(
+    double*, const double*, double, const double*, size_t, t_store_mode, int);
+
+// ---------------------------------------------------------------------------
+// fma_convert_dispatch — mixed precision FMA (converting load)
+// ---------------------------------------------------------------------------
+
+template <std::floating_point TOut, typename TIn>
+    requires c_convertible_input<TIn, TOut>
+void fma_convert_dispatch(TOut* out, const TIn* x, TOut slope, TOut base, size_t n)
+{
+    xsimd::dispatch<dispatch_arch_list>(fma_convert_dispatch_kernel{})(out, x, slope, base, n);
+}
+
+// Explicit instantiations
+template void fma_convert_dispatch<float, int16_t>(float*, const int16_t*, float, float, size_t);
+template void fma_convert_dispatch<float, uint16_t>(float*, const uint16_t*, float, float, size_t);
+template void fma_convert_dispatch<double, int16_t>(double*, const int16_t*, double, double, size_t);
+template void fma_convert_dispatch<double, uint16_t>(double*, const uint16_t*, double, double, size_t);
+template void fma_convert_dispatch<double, float>(double*, const float*, double, double, size_t);
+
+// ---------------------------------------------------------------------------
+// fmab_convert_dispatch — float storage, double accumulation
+// ---------------------------------------------------------------------------
+
+void fmab_convert_dispatch(double* out, const float* x, double slope, const double* base, size_t n)
+{
+    xsimd::dispatch<dispatch_arch_list>(fmab_convert_dispatch_kernel{})(out, x, slope, base, n);
+}
+
+// ---------------------------------------------------------------------------
+// float <-> half conversion
+// ---------------------------------------------------------------------------
+
+void float_to_half_dispatch(uint16_t* out, const float* x, size_t n)
+{
+    xsimd::dispatch<dispatch_arch_list>(float_to_half_dispatch_kernel{})(out, x, n);
+}
+
+void half_to_float_dispatch(float* out, const uint16_t* x, size_t n)
+{
+    xsimd::dispatch<dispatch_arch_list>(half_to_float_dispatch_kernel{})(out, x, n);
+}
+
+// ---------------------------------------------------------------------------
+// find_gaps_dispatch — gap positions of sorted series
+// ---------------------------------------------------------------------------
+
+template<std::floating_point T>
+size_t find_gaps_dispatch(size_t* gaps, const T* x, T threshold, size_t n)
+{
+    return xsimd::dispatch<dispatch_arch_list>(find_gaps_dispatch_kernel{})(gaps, x, threshold, n);
+}
+
+template<std::floating_point T>
+std::vector<size_t> find_gaps_dispatch(const T* x, T threshold, size_t n)
+{
+    // gap positions are collected per block into a small buffer (gaps are rare, so the
+    // result usually stays much smaller than n)
+    constexpr size_t block_size = 4096;
+
+    std::vector<size_t> gaps;
+    std::vector<size_t> block_gaps(block_size);
+    auto                kernel = xsimd::dispatch<dispatch_arch_list>(find_gaps_dispatch_kernel{});
+
+    // each block checks the positions [start, stop), the kernel also reads x[start - 1]
+    for (size_t start = 1; start < n; start += block_size)
+    {
+        const size_t stop   = std::min(start + block_size, n);
+        const size_t n_gaps = kernel(block_gaps.data(), x + start - 1, threshold, stop - start + 1);
+
+        for (size_t g = 0; g < n_gaps; ++g)
+            gaps.push_back(block_gaps[g] + start - 1);
+    }
+
+    return gaps;
+}
+
+template size_t find_gaps_dispatch<float>(size_t*, const float*, float, size_t);
+template size_t find_gaps_dispatch<double>(size_t*, const double*, double, size_t);
+template std::vector<size_t> find_gaps_dispatch<float>(const float*, float, size_t);
+template std::vector<size_t> find_gaps_dispatch<double>(const double*, double, size_t);
 
 // ---------------------------------------------------------------------------
 // fma_xtensor — xt::fma, uses compile-time SIMD
@@ -9,6 +9,20 @@
  *  - fma_dispatch: uses xsimd::dispatch for runtime SIMD selection (works without -march=native)
  *  - fma_xtensor:  uses xt::fma which relies on compile-time SIMD via -march=native
  *
+ * Mixed-precision kernels (same dispatch mechanism):
+ *  - fma_convert_dispatch:  out = TOut(x) * slope + base   (int16/uint16 -> float/double, float -> double)
+ *  - fmab_convert_dispatch: out = double(x) * slope + base[i] (float storage, double accumulation)
+ *  - float_to_half_dispatch / half_to_float_dispatch: IEEE 754 binary16 <-> float conversion
+ *    (half values are passed as their uint16_t bit pattern)
+ *
+ * Gap detection:
+ *  - find_gaps_dispatch: positions i where x[i] - x[i-1] > threshold (used by
+ *    helper::get_sections and helper::get_index_downsampling)
+ *
+ * Alignment: fma/fmab kernels peel scalar elements until the output is aligned
+ * and use aligned loads when the inputs share that alignment. The returning
+ * overloads allocate 64 byte aligned buffers (aligned_xtensor, see aligned.hpp).
+ *
  * The dispatch pattern follows the xsimd documentation:
  *   - The kernel template is declared in the struct but defined OUT OF CLASS
  *     (critical: in-class definitions bypass extern template).
@@ -34,14 +48,21 @@
 /* generated doc strings */
 #include ".docstrings/simd.doc.hpp"
 
+#include <bit>
 #include <cmath>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <xsimd/xsimd.hpp>
 #include <xtensor/containers/xtensor.hpp>
 
+#include "aligned.hpp"
+
 // Architecture detection macros
 #if defined(__x86_64__) || defined(_M_X64)
 #define TOOLS_SIMD_X86_64
@@ -70,6 +91,141 @@ using dispatch_arch_list = xsimd::arch_list<xsimd::neon64>;
  */
 std::string fma_dispatch_arch();
 
+// ---------------------------------------------------------------------------
+// Streaming (non-temporal) stores and software prefetch for large arrays
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief store mode of fma_dispatch / fmab_dispatch
+ *
+ */
+enum class t_store_mode : uint8_t
+{
+    automatic = 0, ///< streaming stores if the output exceeds get_streaming_store_threshold()
+    regular   = 1, ///< regular (cached) stores
+    streaming = 2  ///< non-temporal stores + software prefetch (x86; regular stores on AArch64)
+};
+
+/// Default output size in bytes above which t_store_mode::automatic switches to streaming stores.
+/// Chosen well above the last level cache (slice) of current CPUs.
+inline constexpr size_t default_streaming_store_threshold = size_t(64) * 1024 * 1024;
+
+/// Prefetch distance of the streaming loops in bytes
+inline constexpr size_t streaming_prefetch_distance = 1024;
+
+/// Minimum output size in bytes per thread for the mp_cores variants of fma_dispatch /
+/// fmab_dispatch. Smaller arrays use fewer threads (single-threaded below 2x this size),
+/// because the thread start up costs more than the memory bound kernel saves.
+inline constexpr size_t parallel_min_bytes_per_thread = size_t(256) * 1024;
+
+/**
+ * @brief Set the output size in bytes above which t_store_mode::automatic uses streaming stores
+ * (process wide). Use 0 to always stream, SIZE_MAX to never stream.
+ */
+void set_streaming_store_threshold(size_t bytes);
+
+/**
+ * @brief Get the output size in bytes above which t_store_mode::automatic uses streaming stores
+ */
+size_t get_streaming_store_threshold();
+
+/**
+ * @brief Resolve a t_store_mode for an output of output_bytes bytes
+ */
+inline bool use_streaming_stores(t_store_mode store_mode, size_t output_bytes)
+{
+    switch (store_mode)
+    {
+        case t_store_mode::regular:
+            return false;
+        case t_store_mode::streaming:
+            return true;
+        default:
+            return output_bytes >= get_streaming_store_threshold();
+    }
+}
+
+/**
+ * @brief Non-temporal store of a batch (out must be aligned to Arch::alignment())
+ * Falls back to an aligned regular store where no streaming store is available.
+ */
+template<class Arch, std::floating_point T>
+inline void store_stream(T* out, const xsimd::batch<T, Arch>& value) noexcept
+{
+#if defined(TOOLS_SIMD_X86_64)
+    if constexpr (std::is_base_of_v<xsimd::avx512f, Arch>)
+    {
+        if constexpr (std::is_same_v<T, float>)
+            _mm512_stream_ps(out, value);
+        else
+            _mm512_stream_pd(out, value);
+    }
+    else if constexpr (std::is_base_of_v<xsimd::avx, Arch>)
+    {
+        if constexpr (std::is_same_v<T, float>)
+            _mm256_stream_ps(out, value);
+        else
+            _mm256_stream_pd(out, value);
+    }
+    else if constexpr (std::is_base_of_v<xsimd::sse2, Arch>)
+    {
+        if constexpr (std::is_same_v<T, float>)
+            _mm_stream_ps(out, value);
+        else
+            _mm_stream_pd(out, value);
+    }
+    else
+        value.store_aligned(out);
+#else
+    value.store_aligned(out);
+#endif
+}
+
+/**
+ * @brief Order streaming stores before subsequent stores (must follow a store_stream loop)
+ */
+inline void stream_fence() noexcept
+{
+#if defined(TOOLS_SIMD_X86_64)
+    _mm_sfence();
+#endif
+}
+
+/**
+ * @brief Prefetch the cache line at ptr for reading (non-temporal hint)
+ */
+inline void prefetch_read(const void* ptr) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr, 0, 0);
+#elif defined(TOOLS_SIMD_X86_64)
+    _mm_prefetch(static_cast<const char*>(ptr), _MM_HINT_NTA);
+#endif
+}
+
+/**
+ * @brief Call f(load_mode, std::bool_constant<streaming>) with the tags selected by the runtime
+ * flags, so that the kernel loop is compiled once per combination without branches inside.
+ */
+template<typename t_function>
+inline void with_simd_modes(bool aligned_loads, bool streaming, t_function&& f)
+{
+    if (aligned_loads)
+    {
+        if (streaming)
+            f(xsimd::aligned_mode{}, std::true_type{});
+        else
+            f(xsimd::aligned_mode{}, std::false_type{});
+    }
+    else
+    {
+        if (streaming)
+            f(xsimd::unaligned_mode{}, std::true_type{});
+        else
+            f(xsimd::unaligned_mode{}, std::false_type{});
+    }
+}
+
 // ---------------------------------------------------------------------------
 // fma_dispatch kernel — declared in-class, defined OUT OF CLASS.
 // (In-class and inline definitions bypass the extern template mechanism.)
@@ -78,12 +234,14 @@ std::string fma_dispatch_arch();
 struct fma_dispatch_kernel
 {
     template <class Arch, std::floating_point T>
-    void operator()(Arch, T* out, const T* x, T slope, T base, size_t n) const noexcept;
+    void operator()(
+        Arch, T* out, const T* x, T slope, T base, size_t n, bool streaming = false) const noexcept;
 };
 
 // Out-of-class definition
 template <class Arch, std::floating_point T>
-void fma_dispatch_kernel::operator()(Arch, T* out, const T* x, T slope, T base, size_t n) const noexcept
+void fma_dispatch_kernel::operator()(
+    Arch, T* out, const T* x, T slope, T base, size_t n, bool streaming) const noexcept
 {
     using batch_t              = xsimd::batch<T, Arch>;
     constexpr size_t simd_size = batch_t::size;
@@ -92,12 +250,32 @@ void fma_dispatch_kernel::operator()(Arch, T* out, const T* x, T slope, T base,
     const batch_t vbase  = batch_t::broadcast(base);
 
     size_t i = 0;
-    for (; i + simd_size <= n; i += simd_size)
-    {
-        auto vx = batch_t::load_unaligned(x + i);
-        auto vr = xsimd::fma(vx, vslope, vbase);
-        vr.store_unaligned(out + i);
-    }
+    // peel loop: scalar until out is aligned (no-op for aligned_xtensor/aligned_vector buffers)
+    for (; i < n && !is_aligned(out + i, Arch::alignment()); ++i)
+        out[i] = std::fma(x[i], slope, base);
+
+    const bool aligned_loads = is_aligned(x + i, Arch::alignment());
+
+    with_simd_modes(aligned_loads, streaming, [&](auto load_mode, auto stream) {
+        constexpr size_t prefetch_distance = streaming_prefetch_distance / sizeof(T);
+        for (; i + simd_size <= n; i += simd_size)
+        {
+            if constexpr (decltype(stream)::value)
+                if (i + prefetch_distance < n)
+                    prefetch_read(x + i + prefetch_distance);
+
+            auto vx = batch_t::load(x + i, load_mode);
+            auto vr = xsimd::fma(vx, vslope, vbase);
+
+            if constexpr (decltype(stream)::value)
+                store_stream(out + i, vr);
+            else
+                vr.store(out + i, xsimd::aligned_mode{});
+        }
+    });
+    if (streaming)
+        stream_fence();
+
     // scalar tail
     for (; i < n; ++i)
         out[i] = std::fma(x[i], slope, base);
@@ -106,21 +284,21 @@ void fma_dispatch_kernel::operator()(Arch, T* out, const T* x, T slope, T base,
 // Suppress implicit instantiation — provided by per-arch .cpp files
 #if defined(TOOLS_SIMD_X86_64)
 // x86-64-v4 (avx512bw)  — simd_x86_64_v4.cpp
-extern template void fma_dispatch_kernel::operator()<xsimd::avx512bw, float>(xsimd::avx512bw, float*, const float*, float, float, size_t) const noexcept;
-extern template void fma_dispatch_kernel::operator()<xsimd::avx512bw, double>(xsimd::avx512bw, double*, const double*, double, double, size_t) const noexcept;
+extern template void fma_dispatch_kernel::operator()<xsimd::avx512bw, float>(xsimd::avx512bw, float*, const float*, float, float, size_t, bool) const noexcept;
+extern template void fma_dispatch_kernel::operator()<xsimd::avx512bw, double>(xsimd::avx512bw, double*, const double*, double, double, size_t, bool) const noexcept;
 // x86-64-v3 (fma3<avx2>) — simd_x86_64_v3.cpp
-extern template void fma_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, float>(xsimd::fma3<xsimd::avx2>, float*, const float*, float, float, size_t) const noexcept;
-extern template void fma_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, double>(xsimd::fma3<xsimd::avx2>, double*, const double*, double, double, size_t) const noexcept;
+extern template void fma_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, float>(xsimd::fma3<xsimd::avx2>, float*, const float*, float, float, size_t, bool) const noexcept;
+extern template void fma_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, double>(xsimd::fma3<xsimd::avx2>, double*, const double*, double, double, size_t, bool) const noexcept;
 // x86-64-v2 (sse4_2)    — simd_x86_64_v2.cpp
-extern template void fma_dispatch_kernel::operator()<xsimd::sse4_2, float>(xsimd::sse4_2, float*, const float*, float, float, size_t) const noexcept;
-extern template void fma_dispatch_kernel::operator()<xsimd::sse4_2, double>(xsimd::sse4_2, double*, const double*, double, double, size_t) const noexcept;
+extern template void fma_dispatch_kernel::operator()<xsimd::sse4_2, float>(xsimd::sse4_2, float*, const float*, float, float, size_t, bool) const noexcept;
+extern template void fma_dispatch_kernel::operator()<xsimd::sse4_2, double>(xsimd::sse4_2, double*, const double*, double, double, size_t, bool) const noexcept;
 // x86-64-v1 (sse2)      — simd_x86_64_v1.cpp
-extern template void fma_dispatch_kernel::operator()<xsimd::sse2, float>(xsimd::sse2, float*, const float*, float, float, size_t) const noexcept;
-extern template void fma_dispatch_kernel::operator()<xsimd::sse2, double>(xsimd::sse2, double*, const double*, double, double, size_t) const noexcept;
+extern template void fma_dispatch_kernel::operator()<xsimd::sse2, float>(xsimd::sse2, float*, const float*, float, float, size_t, bool) const noexcept;
+extern template void fma_dispatch_kernel::operator()<xsimd::sse2, double>(xsimd::sse2, double*, const double*, double, double, size_t, bool) const noexcept;
 #elif defined(TOOLS_SIMD_AARCH64)
 // AArch64 (neon64)       — simd_aarch64_neon.cpp
-extern template void fma_dispatch_kernel::operator()<xsimd::neon64, float>(xsimd::neon64, float*, const float*, float, float, size_t) const noexcept;
-extern template void fma_dispatch_kernel::operator()<xsimd::neon64, double>(xsimd::neon64, double*, const double*, double, double, size_t) const noexcept;
+extern template void fma_dispatch_kernel::operator()<xsimd::neon64, float>(xsimd::neon64, float*, const float*, float, float, size_t, bool) const noexcept;
+extern template void fma_dispatch_kernel::operator()<xsimd::neon64, double>(xsimd::neon64, double*, const double*, double, double, size_t, bool) const noexcept;
 #else
 #error "Unsupported architecture for SIMD dispatch"
 #endif
@@ -141,9 +319,18 @@ extern template void fma_dispatch_kernel::operator()<xsimd::neon64, double>(xsim
  * @param slope  Scalar multiplier.
  * @param base   Scalar addend.
  * @param n      Number of elements to process.
+ * @param store_mode  regular, streaming (non-temporal) or automatic (by output size) stores.
+ * @param mp_cores  Number of threads. The array is split into cache line aligned chunks,
+ *                  at least parallel_min_bytes_per_thread per thread.
  */
 template<std::floating_point T>
-void fma_dispatch(T* out, const T* x, T slope, T base, size_t n);
+void fma_dispatch(T*           out,
+                  const T*     x,
+                  T            slope,
+                  T            base,
+                  size_t       n,
+                  t_store_mode store_mode = t_store_mode::automatic,
+                  int          mp_cores   = 1);
 
 /**
  * @brief Compute out[i] = x[i] * slope + base  using xt::fma
@@ -168,12 +355,19 @@ void fma_xtensor(T* out, const T* x, T slope, T base, size_t n);
 struct fmab_dispatch_kernel
 {
     template <class Arch, std::floating_point T>
-    void operator()(Arch, T* out, const T* x, T slope, const T* base, size_t n) const noexcept;
+    void operator()(Arch,
+                    T*       out,
+                    const T* x,
+                    T        slope,
+                    const T* base,
+                    size_t   n,
+                    bool     streaming = false) const noexcept;
 };
 
 // Out-of-class definition
 template <class Arch, std::floating_point T>
-void fmab_dispatch_kernel::operator()(Arch, T* out, const T* x, T slope, const T* base, size_t n) const noexcept
+void fmab_dispatch_kernel::operator()(
+    Arch, T* out, const T* x, T slope, const T* base, size_t n, bool streaming) const noexcept
 {
     using batch_t              = xsimd::batch<T, Arch>;
     constexpr size_t simd_size = batch_t::size;
@@ -181,13 +375,37 @@ void fmab_dispatch_kernel::operator()(Arch, T* out, const T* x, T slope, const T
     const batch_t vslope = batch_t::broadcast(slope);
 
     size_t i = 0;
-    for (; i + simd_size <= n; i += simd_size)
-    {
-        auto vx    = batch_t::load_unaligned(x + i);
-        auto vbase = batch_t::load_unaligned(base + i);
-        auto vr    = xsimd::fma(vx, vslope, vbase);
-        vr.store_unaligned(out + i);
-    }
+    // peel loop: scalar until out is aligned (no-op for aligned_xtensor/aligned_vector buffers)
+    for (; i < n && !is_aligned(out + i, Arch::alignment()); ++i)
+        out[i] = std::fma(x[i], slope, base[i]);
+
+    const bool aligned_loads =
+        is_aligned(x + i, Arch::alignment()) && is_aligned(base + i, Arch::alignment());
+
+    with_simd_modes(aligned_loads, streaming, [&](auto load_mode, auto stream) {
+        constexpr size_t prefetch_distance = streaming_prefetch_distance / sizeof(T);
+        for (; i + simd_size <= n; i += simd_size)
+        {
+            if constexpr (decltype(stream)::value)
+                if (i + prefetch_distance < n)
+                {
+                    prefetch_read(x + i + prefetch_distance);
+                    prefetch_read(base + i + prefetch_distance);
+                }
+
+            auto vx    = batch_t::load(x + i, load_mode);
+            auto vbase = batch_t::load(base + i, load_mode);
+            auto vr    = xsimd::fma(vx, vslope, vbase);
+
+            if constexpr (decltype(stream)::value)
+                store_stream(out + i, vr);
+            else
+                vr.store(out + i, xsimd::aligned_mode{});
+        }
+    });
+    if (streaming)
+        stream_fence();
+
     // scalar tail
     for (; i < n; ++i)
         out[i] = std::fma(x[i], slope, base[i]);
@@ -196,21 +414,21 @@ void fmab_dispatch_kernel::operator()(Arch, T* out, const T* x, T slope, const T
 // Suppress implicit instantiation — provided by per-arch .cpp files
 #if defined(TOOLS_SIMD_X86_64)
 // x86-64-v4 (avx512bw)
-extern template void fmab_dispatch_kernel::operator()<xsimd::avx512bw, float>(xsimd::avx512bw, float*, const float*, float, const float*, size_t) const noexcept;
-extern template void fmab_dispatch_kernel::operator()<xsimd::avx512bw, double>(xsimd::avx512bw, double*, const double*, double, const double*, size_t) const noexcept;
+extern template void fmab_dispatch_kernel::operator()<xsimd::avx512bw, float>(xsimd::avx512bw, float*, const float*, float, const float*, size_t, bool) const noexcept;
+extern template void fmab_dispatch_kernel::operator()<xsimd::avx512bw, double>(xsimd::avx512bw, double*, const double*, double, const double*, size_t, bool) const noexcept;
 // x86-64-v3 (fma3<avx2>)
-extern template void fmab_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, float>(xsimd::fma3<xsimd::avx2>, float*, const float*, float, const float*, size_t) const noexcept;
-extern template void fmab_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, double>(xsimd::fma3<xsimd::avx2>, double*, const double*, double, const double*, size_t) const noexcept;
+extern template void fmab_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, float>(xsimd::fma3<xsimd::avx2>, float*, const float*, float, const float*, size_t, bool) const noexcept;
+extern template void fmab_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, double>(xsimd::fma3<xsimd::avx2>, double*, const double*, double, const double*, size_t, bool) const noexcept;
 // x86-64-v2 (sse4_2)
-extern template void fmab_dispatch_kernel::operator()<xsimd::sse4_2, float>(xsimd::sse4_2, float*, const float*, float, const float*, size_t) const noexcept;
-extern template void fmab_dispatch_kernel::operator()<xsimd::sse4_2, double>(xsimd::sse4_2, double*, const double*, double, const double*, size_t) const noexcept;
+extern template void fmab_dispatch_kernel::operator()<xsimd::sse4_2, float>(xsimd::sse4_2, float*, const float*, float, const float*, size_t, bool) const noexcept;
+extern template void fmab_dispatch_kernel::operator()<xsimd::sse4_2, double>(xsimd::sse4_2, double*, const double*, double, const double*, size_t, bool) const noexcept;
 // x86-64-v1 (sse2)
-extern template void fmab_dispatch_kernel::operator()<xsimd::sse2, float>(xsimd::sse2, float*, const float*, float, const float*, size_t) const noexcept;
-extern template void fmab_dispatch_kernel::operator()<xsimd::sse2, double>(xsimd::sse2, double*, const double*, double, const double*, size_t) const noexcept;
+extern template void fmab_dispatch_kernel::operator()<xsimd::sse2, float>(xsimd::sse2, float*, const float*, float, const float*, size_t, bool) const noexcept;
+extern template void fmab_dispatch_kernel::operator()<xsimd::sse2, double>(xsimd::sse2, double*, const double*, double, const double*, size_t, bool) const noexcept;
 #elif defined(TOOLS_SIMD_AARCH64)
 // AArch64 (neon64)
-extern template void fmab_dispatch_kernel::operator()<xsimd::neon64, float>(xsimd::neon64, float*, const float*, float, const float*, size_t) const noexcept;
-extern template void fmab_dispatch_kernel::operator()<xsimd::neon64, double>(xsimd::neon64, double*, const double*, double, const double*, size_t) const noexcept;
+extern template void fmab_dispatch_kernel::operator()<xsimd::neon64, float>(xsimd::neon64, float*, const float*, float, const float*, size_t, bool) const noexcept;
+extern template void fmab_dispatch_kernel::operator()<xsimd::neon64, double>(xsimd::neon64, double*, const double*, double, const double*, size_t, bool) const noexcept;
 #else
 #error "Unsupported architecture for SIMD dispatch"
 #endif
@@ -230,9 +448,460 @@ extern template void fmab_dispatch_kernel::operator()<xsimd::neon64, double>(xsi
  * @param slope  Scalar multiplier.
  * @param base   Per-element addend array, must hold at least @p n elements.
  * @param n      Number of elements to process.
+ * @param store_mode  regular, streaming (non-temporal) or automatic (by output size) stores.
+ * @param mp_cores  Number of threads. The array is split into cache line aligned chunks,
+ *                  at least parallel_min_bytes_per_thread per thread.
  */
 template<std::floating_point T>
-void fmab_dispatch(T* out, const T* x, T slope, const T* base, size_t n);
+void fmab_dispatch(T*           out,
+                   const T*     x,
+                   T            slope,
+                   const T*     base,
+                   size_t       n,
+                   t_store_mode store_mode = t_store_mode::automatic,
+                   int          mp_cores   = 1);
+
+// ---------------------------------------------------------------------------
+// fma_convert_dispatch kernel — mixed precision: out[i] = TOut(x[i]) * slope + base
+// ---------------------------------------------------------------------------
+
+/// Input types supported by fma_convert_dispatch for a given output type.
+/// int16/uint16 raw counts -> float/double, float storage -> double.
+template<typename TIn, typename TOut>
+concept c_convertible_input =
+    std::floating_point<TOut> &&
+    (std::is_same_v<TIn, int16_t> || std::is_same_v<TIn, uint16_t> ||
+     (std::is_same_v<TIn, float> && std::is_same_v<TOut, double>));
+
+struct fma_convert_dispatch_kernel
+{
+    template<class Arch, std::floating_point TOut, typename TIn>
+    void operator()(Arch, TOut* out, const TIn* x, TOut slope, TOut base, size_t n) const noexcept;
+};
+
+// Out-of-class definition
+template<class Arch, std::floating_point TOut, typename TIn>
+void fma_convert_dispatch_kernel::operator()(Arch,
+                                             TOut*       out,
+                                             const TIn*  x,
+                                             TOut        slope,
+                                             TOut        base,
+                                             size_t      n) const noexcept
+{
+    using batch_t              = xsimd::batch<TOut, Arch>;
+    constexpr size_t simd_size = batch_t::size;
+
+    const batch_t vslope = batch_t::broadcast(slope);
+    const batch_t vbase  = batch_t::broadcast(base);
+
+    size_t i = 0;
+    for (; i + simd_size <= n; i += simd_size)
+    {
+        auto vx = batch_t::load_unaligned(x + i); // converting load TIn -> TOut
+        auto vr = xsimd::fma(vx, vslope, vbase);
+        vr.store_unaligned(out + i);
+    }
+    // scalar tail
+    for (; i < n; ++i)
+        out[i] = std::fma(static_cast<TOut>(x[i]), slope, base);
+}
+
+// ---------------------------------------------------------------------------
+// fmab_convert_dispatch kernel — out[i] = double(x[i]) * slope + base[i]
+// ---------------------------------------------------------------------------
+
+struct fmab_convert_dispatch_kernel
+{
+    template<class Arch>
+    void operator()(Arch, double* out, const float* x, double slope, const double* base, size_t n)
+        const noexcept;
+};
+
+// Out-of-class definition
+template<class Arch>
+void fmab_convert_dispatch_kernel::operator()(
+    Arch, double* out, const float* x, double slope, const double* base, size_t n) const noexcept
+{
+    using batch_t              = xsimd::batch<double, Arch>;
+    constexpr size_t simd_size = batch_t::size;
+
+    const batch_t vslope = batch_t::broadcast(slope);
+
+    size_t i = 0;
+    for (; i + simd_size <= n; i += simd_size)
+    {
+        auto vx    = batch_t::load_unaligned(x + i); // converting load float -> double
+        auto vbase = batch_t::load_unaligned(base + i);
+        auto vr    = xsimd::fma(vx, vslope, vbase);
+        vr.store_unaligned(out + i);
+    }
+    // scalar tail
+    for (; i < n; ++i)
+        out[i] = std::fma(static_cast<double>(x[i]), slope, base[i]);
+}
+
+// ---------------------------------------------------------------------------
+// float <-> half (IEEE 754 binary16) conversion
+// The bit manipulation follows F. Giesen's branchless conversions
+// (round-to-nearest-even, denormals preserved, NaN -> quiet NaN).
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Convert a float to the bit pattern of the nearest IEEE 754 half value
+ * (round to nearest even). Values above the half range become +-inf, NaN becomes quiet NaN.
+ */
+inline uint16_t float_to_half(float value) noexcept
+{
+    constexpr uint32_t f32infty     = 255u << 23;
+    constexpr uint32_t f16max       = (127u + 16u) << 23;
+    constexpr uint32_t f16min       = 113u << 23; // smallest normal half
+    constexpr uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+    uint32_t       x    = std::bit_cast<uint32_t>(value);
+    const uint32_t sign = x & 0x80000000u;
+    x ^= sign;
+
+    uint32_t o;
+    if (x >= f16max) // inf or NaN (or too large)
+        o = (x > f32infty) ? 0x7e00u : 0x7c00u;
+    else if (x < f16min) // half denormal or zero: align the mantissa using a magic add
+        o = std::bit_cast<uint32_t>(std::bit_cast<float>(x) + std::bit_cast<float>(denorm_magic)) -
+            denorm_magic;
+    else
+    {
+        const uint32_t mant_odd = (x >> 13) & 1u;
+        x += (uint32_t(15 - 127) << 23) + 0xfffu; // rebias exponent + rounding bias part 1
+        x += mant_odd;                            // rounding bias part 2 (ties to even)
+        o = x >> 13;
+    }
+
+    return static_cast<uint16_t>(o | (sign >> 16));
+}
+
+/**
+ * @brief Convert the bit pattern of an IEEE 754 half value to float (exact)
+ */
+inline float half_to_float(uint16_t value) noexcept
+{
+    constexpr uint32_t shifted_exp = 0x7c00u << 13;
+    constexpr uint32_t magic       = 113u << 23;
+
+    uint32_t       o   = (uint32_t(value) & 0x7fffu) << 13;
+    const uint32_t exp = o & shifted_exp;
+    o += (127u - 15u) << 23;
+
+    if (exp == shifted_exp) // inf or NaN
+        o += (128u - 16u) << 23;
+    else if (exp == 0) // zero or denormal: renormalize
+        o = std::bit_cast<uint32_t>(std::bit_cast<float>(o + (1u << 23)) -
+                                    std::bit_cast<float>(magic));
+
+    return std::bit_cast<float>(o | ((uint32_t(value) & 0x8000u) << 16));
+}
+
+struct float_to_half_dispatch_kernel
+{
+    template<class Arch>
+    void operator()(Arch, uint16_t* out, const float* x, size_t n) const noexcept;
+};
+
+// Out-of-class definition
+template<class Arch>
+void float_to_half_dispatch_kernel::operator()(Arch, uint16_t* out, const float* x, size_t n) const noexcept
+{
+    // integer part is done in int32 lanes: after removing the sign all values are < 2^31
+    using fbatch_t             = xsimd::batch<float, Arch>;
+    using ibatch_t             = xsimd::batch<int32_t, Arch>;
+    constexpr size_t simd_size = fbatch_t::size;
+
+    const ibatch_t f32infty(int32_t(255 << 23));
+    const ibatch_t f16max(int32_t((127 + 16) << 23));
+    const ibatch_t f16min(int32_t(113 << 23));
+    const ibatch_t denorm_magic(int32_t(((127 - 15) + (23 - 10) + 1) << 23));
+    const ibatch_t rebias(int32_t(((15 - 127) << 23) + 0xfff));
+    const ibatch_t sign_mask(std::bit_cast<int32_t>(0x80000000u));
+    const ibatch_t one(1), qnan(0x7e00), inf(0x7c00), sign_bit16(0x8000);
+
+    size_t i = 0;
+    for (; i + simd_size <= n; i += simd_size)
+    {
+        ibatch_t       v    = xsimd::bitwise_cast<int32_t>(fbatch_t::load_unaligned(x + i));
+        const ibatch_t sign = v & sign_mask;
+        v                   = v ^ sign;
+
+        const ibatch_t o_infnan = xsimd::select(v > f32infty, qnan, inf);
+        const ibatch_t o_denorm =
+            xsimd::bitwise_cast<int32_t>(xsimd::bitwise_cast<float>(v) +
+                                         xsimd::bitwise_cast<float>(denorm_magic)) -
+            denorm_magic;
+        const ibatch_t o_normal = (v + rebias + ((v >> 13) & one)) >> 13;
+
+        ibatch_t o = xsimd::select(v < f16min, o_denorm, o_normal);
+        o          = xsimd::select(v >= f16max, o_infnan, o);
+        o          = o | ((sign >> 16) & sign_bit16);
+
+        o.store_unaligned(out + i); // converting store int32 -> uint16
+    }
+    // scalar tail
+    for (; i < n; ++i)
+        out[i] = float_to_half(x[i]);
+}
+
+struct half_to_float_dispatch_kernel
+{
+    template<class Arch>
+    void operator()(Arch, float* out, const uint16_t* x, size_t n) const noexcept;
+};
+
+// Out-of-class definition
+template<class Arch>
+void half_to_float_dispatch_kernel::operator()(Arch, float* out, const uint16_t* x, size_t n) const noexcept
+{
+    using fbatch_t             = xsimd::batch<float, Arch>;
+    using ibatch_t             = xsimd::batch<int32_t, Arch>;
+    constexpr size_t simd_size = fbatch_t::size;
+
+    const ibatch_t shifted_exp(int32_t(0x7c00 << 13));
+    const ibatch_t magic(int32_t(113 << 23));
+    const ibatch_t zero(0), exp_adjust(int32_t((127 - 15) << 23));
+    const ibatch_t infnan_adjust(int32_t((128 - 16) << 23)), denorm_adjust(int32_t(1 << 23));
+    const ibatch_t abs_mask(0x7fff), sign_mask(0x8000);
+
+    size_t i = 0;
+    for (; i + simd_size <= n; i += simd_size)
+    {
+        const ibatch_t h   = ibatch_t::load_unaligned(x + i); // converting load uint16 -> int32
+        ibatch_t       o   = (h & abs_mask) << 13;
+        const ibatch_t exp = o & shifted_exp;
+        o                  = o + exp_adjust;
+
+        const ibatch_t o_infnan = o + infnan_adjust;
+        const ibatch_t o_denorm = xsimd::bitwise_cast<int32_t>(
+            xsimd::bitwise_cast<float>(o + denorm_adjust) - xsimd::bitwise_cast<float>(magic));
+
+        o = xsimd::select(exp == shifted_exp, o_infnan, xsimd::select(exp == zero, o_denorm, o));
+        o = o | ((h & sign_mask) << 16);
+
+        xsimd::bitwise_cast<float>(o).store_unaligned(out + i);
+    }
+    // scalar tail
+    for (; i < n; ++i)
+        out[i] = half_to_float(x[i]);
+}
+
+// Suppress implicit instantiation — provided by per-arch .cpp files
+#if defined(TOOLS_SIMD_X86_64)
+// x86-64-v4 (avx512bw)
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::avx512bw, float, int16_t>(xsimd::avx512bw, float*, const int16_t*, float, float, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::avx512bw, float, uint16_t>(xsimd::avx512bw, float*, const uint16_t*, float, float, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::avx512bw, double, int16_t>(xsimd::avx512bw, double*, const int16_t*, double, double, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::avx512bw, double, uint16_t>(xsimd::avx512bw, double*, const uint16_t*, double, double, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::avx512bw, double, float>(xsimd::avx512bw, double*, const float*, double, double, size_t) const noexcept;
+extern template void fmab_convert_dispatch_kernel::operator()<xsimd::avx512bw>(xsimd::avx512bw, double*, const float*, double, const double*, size_t) const noexcept;
+extern template void float_to_half_dispatch_kernel::operator()<xsimd::avx512bw>(xsimd::avx512bw, uint16_t*, const float*, size_t) const noexcept;
+extern template void half_to_float_dispatch_kernel::operator()<xsimd::avx512bw>(xsimd::avx512bw, float*, const uint16_t*, size_t) const noexcept;
+// x86-64-v3 (fma3<avx2>)
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, float, int16_t>(xsimd::fma3<xsimd::avx2>, float*, const int16_t*, float, float, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, float, uint16_t>(xsimd::fma3<xsimd::avx2>, float*, const uint16_t*, float, float, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, double, int16_t>(xsimd::fma3<xsimd::avx2>, double*, const int16_t*, double, double, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, double, uint16_t>(xsimd::fma3<xsimd::avx2>, double*, const uint16_t*, double, double, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, double, float>(xsimd::fma3<xsimd::avx2>, double*, const float*, double, double, size_t) const noexcept;
+extern template void fmab_convert_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>>(xsimd::fma3<xsimd::avx2>, double*, const float*, double, const double*, size_t) const noexcept;
+extern template void float_to_half_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>>(xsimd::fma3<xsimd::avx2>, uint16_t*, const float*, size_t) const noexcept;
+extern template void half_to_float_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>>(xsimd::fma3<xsimd::avx2>, float*, const uint16_t*, size_t) const noexcept;
+// x86-64-v2 (sse4_2)
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::sse4_2, float, int16_t>(xsimd::sse4_2, float*, const int16_t*, float, float, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::sse4_2, float, uint16_t>(xsimd::sse4_2, float*, const uint16_t*, float, float, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::sse4_2, double, int16_t>(xsimd::sse4_2, double*, const int16_t*, double, double, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::sse4_2, double, uint16_t>(xsimd::sse4_2, double*, const uint16_t*, double, double, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::sse4_2, double, float>(xsimd::sse4_2, double*, const float*, double, double, size_t) const noexcept;
+extern template void fmab_convert_dispatch_kernel::operator()<xsimd::sse4_2>(xsimd::sse4_2, double*, const float*, double, const double*, size_t) const noexcept;
+extern template void float_to_half_dispatch_kernel::operator()<xsimd::sse4_2>(xsimd::sse4_2, uint16_t*, const float*, size_t) const noexcept;
+extern template void half_to_float_dispatch_kernel::operator()<xsimd::sse4_2>(xsimd::sse4_2, float*, const uint16_t*, size_t) const noexcept;
+// x86-64-v1 (sse2)
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::sse2, float, int16_t>(xsimd::sse2, float*, const int16_t*, float, float, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::sse2, float, uint16_t>(xsimd::sse2, float*, const uint16_t*, float, float, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::sse2, double, int16_t>(xsimd::sse2, double*, const int16_t*, double, double, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::sse2, double, uint16_t>(xsimd::sse2, double*, const uint16_t*, double, double, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::sse2, double, float>(xsimd::sse2, double*, const float*, double, double, size_t) const noexcept;
+extern template void fmab_convert_dispatch_kernel::operator()<xsimd::sse2>(xsimd::sse2, double*, const float*, double, const double*, size_t) const noexcept;
+extern template void float_to_half_dispatch_kernel::operator()<xsimd::sse2>(xsimd::sse2, uint16_t*, const float*, size_t) const noexcept;
+extern template void half_to_float_dispatch_kernel::operator()<xsimd::sse2>(xsimd::sse2, float*, const uint16_t*, size_t) const noexcept;
+#elif defined(TOOLS_SIMD_AARCH64)
+// AArch64 (neon64)
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::neon64, float, int16_t>(xsimd::neon64, float*, const int16_t*, float, float, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::neon64, float, uint16_t>(xsimd::neon64, float*, const uint16_t*, float, float, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::neon64, double, int16_t>(xsimd::neon64, double*, const int16_t*, double, double, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::neon64, double, uint16_t>(xsimd::neon64, double*, const uint16_t*, double, double, size_t) const noexcept;
+extern template void fma_convert_dispatch_kernel::operator()<xsimd::neon64, double, float>(xsimd::neon64, double*, const float*, double, double, size_t) const noexcept;
+extern template void fmab_convert_dispatch_kernel::operator()<xsimd::neon64>(xsimd::neon64, double*, const float*, double, const double*, size_t) const noexcept;
+extern template void float_to_half_dispatch_kernel::operator()<xsimd::neon64>(xsimd::neon64, uint16_t*, const float*, size_t) const noexcept;
+extern template void half_to_float_dispatch_kernel::operator()<xsimd::neon64>(xsimd::neon64, float*, const uint16_t*, size_t) const noexcept;
+#else
+#error "Unsupported architecture for SIMD dispatch"
+#endif
+
+// ---------------------------------------------------------------------------
+// mixed precision — raw pointer interface
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Compute out[i] = TOut(x[i]) * slope + base  (decode + calibrate in one pass)
+ *
+ * Converts raw samples (int16/uint16 counts, or float storage for double output)
+ * to the output precision inside the SIMD registers, so no intermediate
+ * full-size converted array is needed.
+ *
+ * @tparam TOut  Floating-point output type (float or double).
+ * @tparam TIn   Input type: int16_t, uint16_t, or float (only for double output).
+ * @param out  Output array, must hold at least @p n elements.
+ * @param x    Input array, must hold at least @p n elements.
+ * @param slope  Scalar multiplier (scale).
+ * @param base   Scalar addend (offset).
+ * @param n      Number of elements to process.
+ */
+template<std::floating_point TOut, typename TIn>
+    requires c_convertible_input<TIn, TOut>
+void fma_convert_dispatch(TOut* out, const TIn* x, TOut slope, TOut base, size_t n);
+
+/**
+ * @brief Compute out[i] = double(x[i]) * slope + base[i]  (float storage, double accumulation)
+ *
+ * With out == base this accumulates a float array into a double accumulator in-place.
+ *
+ * @param out  Output array, must hold at least @p n elements.
+ * @param x    Float input array, must hold at least @p n elements.
+ * @param slope  Scalar multiplier.
+ * @param base   Per-element double addend array, must hold at least @p n elements.
+ * @param n      Number of elements to process.
+ */
+void fmab_convert_dispatch(double* out, const float* x, double slope, const double* base, size_t n);
+
+/**
+ * @brief Convert floats to IEEE 754 half bit patterns (round to nearest even)
+ *
+ * @param out  Output array of half bit patterns, must hold at least @p n elements.
+ * @param x    Float input array, must hold at least @p n elements.
+ * @param n    Number of elements to process.
+ */
+void float_to_half_dispatch(uint16_t* out, const float* x, size_t n);
+
+/**
+ * @brief Convert IEEE 754 half bit patterns to floats
+ *
+ * @param out  Float output array, must hold at least @p n elements.
+ * @param x    Input array of half bit patterns, must hold at least @p n elements.
+ * @param n    Number of elements to process.
+ */
+void half_to_float_dispatch(float* out, const uint16_t* x, size_t n);
+
+// ---------------------------------------------------------------------------
+// find_gaps_dispatch kernel — positions i where x[i] - x[i - 1] > threshold
+// ---------------------------------------------------------------------------
+
+struct find_gaps_dispatch_kernel
+{
+    template<class Arch, std::floating_point T>
+    size_t operator()(Arch, size_t* gaps, const T* x, T threshold, size_t n) const noexcept;
+};
+
+// Out-of-class definition
+template<class Arch, std::floating_point T>
+size_t find_gaps_dispatch_kernel::operator()(
+    Arch, size_t* gaps, const T* x, T threshold, size_t n) const noexcept
+{
+    using batch_t              = xsimd::batch<T, Arch>;
+    constexpr size_t simd_size = batch_t::size;
+
+    const batch_t vthreshold = batch_t::broadcast(threshold);
+
+    size_t n_gaps = 0;
+    size_t i      = 1;
+    for (; i + simd_size <= n; i += simd_size)
+    {
+        const auto is_gap =
+            (batch_t::load_unaligned(x + i) - batch_t::load_unaligned(x + i - 1)) > vthreshold;
+
+        // gaps are rare: usually a single test of the lane mask per batch
+        for (uint64_t lanes = is_gap.mask(); lanes != 0; lanes &= lanes - 1)
+            gaps[n_gaps++] = i + size_t(std::countr_zero(lanes));
+    }
+    // scalar tail
+    for (; i < n; ++i)
+        if (x[i] - x[i - 1] > threshold)
+            gaps[n_gaps++] = i;
+
+    return n_gaps;
+}
+
+// Suppress implicit instantiation — provided by per-arch .cpp files
+#if defined(TOOLS_SIMD_X86_64)
+// x86-64-v4 (avx512bw)
+extern template size_t find_gaps_dispatch_kernel::operator()<xsimd::avx512bw, float>(xsimd::avx512bw, size_t*, const float*, float, size_t) const noexcept;
+extern template size_t find_gaps_dispatch_kernel::operator()<xsimd::avx512bw, double>(xsimd::avx512bw, size_t*, const double*, double, size_t) const noexcept;
+// x86-64-v3 (fma3<avx2>)
+extern template size_t find_gaps_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, float>(xsimd::fma3<xsimd::avx2>, size_t*, const float*, float, size_t) const noexcept;
+extern template size_t find_gaps_dispatch_kernel::operator()<xsimd::fma3<xsimd::avx2>, double>(xsimd::fma3<xsimd::avx2>, size_t*, const double*, double, size_t) const noexcept;
+// x86-64-v2 (sse4_2)
+extern template size_t find_gaps_dispatch_kernel::operator()<xsimd::sse4_2, float>(xsimd::sse4_2, size_t*, const float*, float, size_t) const noexcept;
+extern template size_t find_gaps_dispatch_kernel::operator()<xsimd::sse4_2, double>(xsimd::sse4_2, size_t*, const double*, double, size_t) const noexcept;
+// x86-64-v1 (sse2)
+extern template size_t find_gaps_dispatch_kernel::operator()<xsimd::sse2, float>(xsimd::sse2, size_t*, const float*, float, size_t) const noexcept;
+extern template size_t find_gaps_dispatch_kernel::operator()<xsimd::sse2, double>(xsimd::sse2, size_t*, const double*, double, size_t) const noexcept;
+#elif defined(TOOLS_SIMD_AARCH64)
+// AArch64 (neon64)
+extern template size_t find_gaps_dispatch_kernel::operator()<xsimd::neon64, float>(xsimd::neon64, size_t*, const float*, float, size_t) const noexcept;
+extern template size_t find_gaps_dispatch_kernel::operator()<xsimd::neon64, double>(xsimd::neon64, size_t*, const double*, double, size_t) const noexcept;
+#else
+#error "Unsupported architecture for SIMD dispatch"
+#endif
+
+/**
+ * @brief Largest T that is <= max_gap
+ *
+ * For T values a, b: (a - b) > gap_threshold<T>(max_gap)  <=>  (a - b) > max_gap,
+ * so gaps defined by a double max_gap can be detected without converting float
+ * data to double. Non finite max_gap values are returned unchanged (converted to T).
+ */
+template<std::floating_point T>
+inline T gap_threshold(double max_gap) noexcept
+{
+    if (!std::isfinite(max_gap))
+        return static_cast<T>(max_gap);
+    if (max_gap >= double(std::numeric_limits<T>::max()))
+        return std::numeric_limits<T>::max();
+    if (max_gap < double(std::numeric_limits<T>::lowest()))
+        return -std::numeric_limits<T>::infinity();
+
+    T threshold = static_cast<T>(max_gap);
+    if (double(threshold) > max_gap)
+        threshold = std::nextafter(threshold, -std::numeric_limits<T>::infinity());
+    return threshold;
+}
+
+/**
+ * @brief Find the positions of gaps in an array: all i in [1, n) with x[i] - x[i - 1] > threshold
+ *
+ * The differences are computed in T. NaN differences are never gaps.
+ * Use gap_threshold<T>(max_gap) to convert a double max_gap into an equivalent threshold.
+ *
+ * @tparam T  Floating-point element type (float or double).
+ * @param gaps  Output array of gap positions, must hold at least n - 1 elements.
+ * @param x     Input array, must hold at least @p n elements.
+ * @param threshold  A difference larger than threshold is a gap.
+ * @param n     Number of elements of x.
+ * @return number of gaps written to @p gaps
+ */
+template<std::floating_point T>
+size_t find_gaps_dispatch(size_t* gaps, const T* x, T threshold, size_t n);
+
+/**
+ * @brief Returning variant: positions i in [1, n) with x[i] - x[i - 1] > threshold
+ *
+ * Processes the array in blocks, so no n sized temporary buffer is needed.
+ */
+template<std::floating_point T>
+std::vector<size_t> find_gaps_dispatch(const T* x, T threshold, size_t n);
 
 // ---- Returning overloads (inline wrappers) --------------------------------
 
@@ -240,10 +909,10 @@ void fmab_dispatch(T* out, const T* x, T slope, const T* base, size_t n);
  * @brief Returning variant: out = fma_dispatch(x, slope, base)
  */
 template<std::floating_point T>
-inline xt::xtensor<T, 1> fma_dispatch(const T* x, T slope, T base, size_t n)
+inline aligned_xtensor<T, 1> fma_dispatch(const T* x, T slope, T base, size_t n, int mp_cores = 1)
 {
-    auto out = xt::xtensor<T, 1>::from_shape({n});
-    fma_dispatch(out.data(), x, slope, base, n);
+    auto out = make_aligned_xtensor<T>(n);
+    fma_dispatch(out.data(), x, slope, base, n, t_store_mode::automatic, mp_cores);
     return out;
 }
 
@@ -251,9 +920,9 @@ inline xt::xtensor<T, 1> fma_dispatch(const T* x, T slope, T base, size_t n)
  * @brief Returning variant: out = fma_xtensor(x, slope, base)
  */
 template<std::floating_point T>
-inline xt::xtensor<T, 1> fma_xtensor(const T* x, T slope, T base, size_t n)
+inline aligned_xtensor<T, 1> fma_xtensor(const T* x, T slope, T base, size_t n)
 {
-    auto out = xt::xtensor<T, 1>::from_shape({n});
+    auto out = make_aligned_xtensor<T>(n);
     fma_xtensor(out.data(), x, slope, base, n);
     return out;
 }
@@ -262,10 +931,56 @@ inline xt::xtensor<T, 1> fma_xtensor(const T* x, T slope, T base, size_t n)
  * @brief Returning variant: out = fmab_dispatch(x, slope, base_arr)
  */
 template<std::floating_point T>
-inline xt::xtensor<T, 1> fmab_dispatch(const T* x, T slope, const T* base, size_t n)
+inline aligned_xtensor<T, 1> fmab_dispatch(
+    const T* x, T slope, const T* base, size_t n, int mp_cores = 1)
 {
-    auto out = xt::xtensor<T, 1>::from_shape({n});
-    fmab_dispatch(out.data(), x, slope, base, n);
+    auto out = make_aligned_xtensor<T>(n);
+    fmab_dispatch(out.data(), x, slope, base, n, t_store_mode::automatic, mp_cores);
+    return out;
+}
+
+/**
+ * @brief Returning variant: out = fma_convert_dispatch(x, slope, base)
+ */
+template<std::floating_point TOut, typename TIn>
+    requires c_convertible_input<TIn, TOut>
+inline aligned_xtensor<TOut, 1> fma_convert_dispatch(const TIn* x, TOut slope, TOut base, size_t n)
+{
+    auto out = make_aligned_xtensor<TOut>(n);
+    fma_convert_dispatch(out.data(), x, slope, base, n);
+    return out;
+}
+
+/**
+ * @brief Returning variant: out = fmab_convert_dispatch(x, slope, base_arr)
+ */
+inline aligned_xtensor<double, 1> fmab_convert_dispatch(const float*  x,
+                                                       double        slope,
+                                                       const double* base,
+                                                       size_t        n)
+{
+    auto out = make_aligned_xtensor<double>(n);
+    fmab_convert_dispatch(out.data(), x, slope, base, n);
+    return out;
+}
+
+/**
+ * @brief Returning variant: out = float_to_half_dispatch(x)
+ */
+inline aligned_xtensor<uint16_t, 1> float_to_half_dispatch(const float* x, size_t n)
+{
+    auto out = make_aligned_xtensor<uint16_t>(n);
+    float_to_half_dispatch(out.data(), x, n);
+    return out;
+}
+
+/**
+ * @brief Returning variant: out = half_to_float_dispatch(x)
+ */
+inline aligned_xtensor<float, 1> half_to_float_dispatch(const uint16_t* x, size_t n)
+{
+    auto out = make_aligned_xtensor<float>(n);
+    half_to_float_dispatch(out.data(), x, n);
     return out;
 }
 
@@ -301,6 +1016,16 @@ inline void fmab_dispatch(t_xtensor_out&& out, const T* x, T slope, const T* bas
     fmab_dispatch(out.data() + out.data_offset(), x, slope, base, out.size());
 }
 
+/**
+ * @brief Write into an xtensor view/container: fma_convert_dispatch(view, x, slope, base)
+ */
+template<typename t_xtensor_out, std::floating_point TOut, typename TIn>
+    requires c_convertible_input<TIn, TOut>
+inline void fma_convert_dispatch(t_xtensor_out&& out, const TIn* x, TOut slope, TOut base)
+{
+    fma_convert_dispatch(out.data() + out.data_offset(), x, slope, base, out.size());
+}
+
 } // namespace math
 } // namespace tools
 } // namespace themachinethatgoesping
@@ -10,11 +10,25 @@ namespace themachinethatgoesping {
 namespace tools {
 namespace math {
 
-template void fma_dispatch_kernel::operator()<xsimd::sse4_2, float>(xsimd::sse4_2, float*, const float*, float, float, size_t) const noexcept;
-template void fma_dispatch_kernel::operator()<xsimd::sse4_2, double>(xsimd::sse4_2, double*, const double*, double, double, size_t) const noexcept;
+template void fma_dispatch_kernel::operator()<xsimd::sse4_2, float>(xsimd::sse4_2, float*, const float*, float, float, size_t, bool) const noexcept;
+template void fma_dispatch_kernel::operator()<xsimd::sse4_2, double>(xsimd::sse4_2, double*, const double*, double, double, size_t, bool) const noexcept;
 
-template void fmab_dispatch_kernel::operator()<xsimd::sse4_2, float>(xsimd::sse4_2, float*, const float*, float, const float*, size_t) const noexcept;
-template void fmab_dispatch_kernel::operator()<xsimd::sse4_2, double>(xsimd::sse4_2, double*, const double*, double, const double*, size_t) const noexcept;
+template void fmab_dispatch_kernel::operator()<xsimd::sse4_2, float>(xsimd::sse4_2, float*, const float*, float, const float*, size_t, bool) const noexcept;
+template void fmab_dispatch_kernel::operator()<xsimd::sse4_2, double>(xsimd::sse4_2, double*, const double*, double, const double*, size_t, bool) const noexcept;
+
+template void fma_convert_dispatch_kernel::operator()<xsimd::sse4_2, float, int16_t>(xsimd::sse4_2, float*, const int16_t*, float, float, size_t) const noexcept;
+template void fma_convert_dispatch_kernel::operator()<xsimd::sse4_2, float, uint16_t>(xsimd::sse4_2, float*, const uint16_t*, float, float, size_t) const noexcept;
+template void fma_convert_dispatch_kernel::operator()<xsimd::sse4_2, double, int16_t>(xsimd::sse4_2, double*, const int16_t*, double, double, size_t) const noexcept;
+template void fma_convert_dispatch_kernel::operator()<xsimd::sse4_2, double, uint16_t>(xsimd::sse4_2, double*, const uint16_t*, double, double, size_t) const noexcept;
+template void fma_convert_dispatch_kernel::operator()<xsimd::sse4_2, double, float>(xsimd::sse4_2, double*, const float*, double, double, size_t) const noexcept;
+
+template void fmab_convert_dispatch_kernel::operator()<xsimd::sse4_2>(xsimd::sse4_2, double*, const float*, double, const double*, size_t) const noexcept;
+
+template void float_to_half_dispatch_kernel::operator()<xsimd::sse4_2>(xsimd::sse4_2, uint16_t*, const float*, size_t) const noexcept;
+template void half_to_float_dispatch_kernel::operator()<xsimd::sse4_2>(xsimd::sse4_2, float*, const uint16_t*, size_t) const noexcept;
+
+template size_t find_gaps_dispatch_kernel::operator()<xsimd::sse4_2, float>(xsimd::sse4_2, size_t*, const float*, float, size_t) const noexcept;
+template size_t find_gaps_dispatch_kernel::operator()<xsimd::sse4_2, double>(xsimd::sse4_2, size_t*, const double*, double, size_t) const noexcept;
 
 } // namespace math
 } // namespace tools
@@ -10,11 +10,25 @@ namespace themachinethatgoesping {
 namespace tools {
 namespace math {
 
-template void fma_dispatch_kernel::operator()<xsimd::avx512bw, float>(xsimd::avx512bw, float*, const float*, float, float, size_t) const noexcept;
-template void fma_dispatch_kernel::operator()<xsimd::avx512bw, double>(xsimd::avx512bw, double*, const double*, double, double, size_t) const noexcept;
+template void fma_dispatch_kernel::operator()<xsimd::avx512bw, float>(xsimd::avx512bw, float*, const float*, float, float, size_t, bool) const noexcept;
+template void fma_dispatch_kernel::operator()<xsimd::avx512bw, double>(xsimd::avx512bw, double*, const double*, double, double, size_t, bool) const noexcept;
 
-template void fmab_dispatch_kernel::operator()<xsimd::avx512bw, float>(xsimd::avx512bw, float*, const float*, float, const float*, size_t) const noexcept;
-template void fmab_dispatch_kernel::operator()<xsimd::avx512bw, double>(xsimd::avx512bw, double*, const double*, double, const double*, size_t) const noexcept;
+template void fmab_dispatch_kernel::operator()<xsimd::avx512bw, float>(xsimd::avx512bw, float*, const float*, float, const float*, size_t, bool) const noexcept;
+template void fmab_dispatch_kernel::operator()<xsimd::avx512bw, double>(xsimd::avx512bw, double*, const double*, double, const double*, size_t, bool) const noexcept;
+
+template void fma_convert_dispatch_kernel::operator()<xsimd::avx512bw, float, int16_t>(xsimd::avx512bw, float*, const int16_t*, float, float, size_t) const noexcept;
+template void fma_convert_dispatch_kernel::operator()<xsimd::avx512bw, float, uint16_t>(xsimd::avx512bw, float*, const uint16_t*, float, float, size_t) const noexcept;
+template void fma_convert_dispatch_kernel::operator()<xsimd::avx512bw, double, int16_t>(xsimd::avx512bw, double*, const int16_t*, double, double, size_t) const noexcept;
+template void fma_convert_dispatch_kernel::operator()<xsimd::avx512bw, double, uint16_t>(xsimd::avx512bw, double*, const uint16_t*, double, double, size_t) const noexcept;
+template void fma_convert_dispatch_kernel::operator()<xsimd::avx512bw, double, float>(xsimd::avx512bw, double*, const float*, double, double, size_t) const noexcept;
+
+template void fmab_convert_dispatch_kernel::operator()<xsimd::avx512bw>(xsimd::avx512bw, double*, const float*, double, const double*, size_t) const noexcept;
+
+template void float_to_half_dispatch_kernel::operator()<xsimd::avx512bw>(xsimd::avx512bw, uint16_t*, const float*, size_t) const noexcept;
+template void half_to_float_dispatch_kernel::operator()<xsimd::avx512bw>(xsimd::avx512bw, float*, const uint16_t*, size_t) const noexcept;
+
+template size_t find_gaps_dispatch_kernel::operator()<xsimd::avx512bw, float>(xsimd::avx512bw, size_t*, const float*, float, size_t) const noexcept;
+template size_t find_gaps_dispatch_kernel::operator()<xsimd::avx512bw, double>(xsimd::avx512bw, size_t*, const double*, double, size_t) const noexcept;
 
 } // namespace math
 } // namespace tools
@@ -1,4 +1,4 @@
-//sourcehash: 2b69c4658a32723cc90daac4bd4b1e6b9de33fdd7e9fbdd718a009ae7e387eb2
+//sourcehash: 0f920143c1e8fd5987328947774bc8fbdcd389274cc4d42128724630a07cd194
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -34,11 +34,6 @@ PyIndexer::Slice PyIndexer::Slice::from_stream(std::istream& is)
     return slice;
 }
 
-void PyIndexer::Slice::to_stream(std::ostream& os) const
-{
-    os.write(reinterpret_cast<const char*>(&start), sizeof(PyIndexer::Slice));
-}
-
 // PyIndexer implementations
 PyIndexer::Slice PyIndexer::to_slice() const
 {
@@ -326,11 +321,6 @@ PyIndexer PyIndexer::from_stream(std::istream& is)
     return indexer;
 }
 
-void PyIndexer::to_stream(std::ostream& os) const
-{
-    os.write(reinterpret_cast<const char*>(&_vector_size), sizeof(PyIndexer));
-}
-
 classhelper::ObjectPrinter PyIndexer::__printer__(unsigned int float_precision, bool superscript_exponents) const
 {
     classhelper::ObjectPrinter printer("PyIndexer", float_precision, superscript_exponents);
@@ -70,7 +70,13 @@ class PyIndexer
         classhelper::ObjectPrinter __printer__(unsigned int float_precision, bool superscript_exponents) const;
 
         static PyIndexer::Slice from_stream(std::istream& is);
-        void to_stream(std::ostream& os) const;
+
+        template<typename T_ostream>
+        void to_stream(T_ostream& os) const
+        {
+            classhelper::stream::StreamWriter<T_ostream>(os).write(&start,
+                                                                   sizeof(PyIndexer::Slice));
+        }
 
         // -- class helper function macros --
         // define to_binary and from_binary functions (needs to_stream and from_stream)
@@ -227,7 +233,11 @@ class PyIndexer
      *
      * @param os output stream
      */
-    void to_stream(std::ostream& os) const;
+    template<typename T_ostream>
+    void to_stream(T_ostream& os) const
+    {
+        classhelper::stream::StreamWriter<T_ostream>(os).write(&_vector_size, sizeof(PyIndexer));
+    }
 
     // ----- printing -----
     /**
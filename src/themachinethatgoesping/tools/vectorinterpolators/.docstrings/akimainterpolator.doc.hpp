@@ -1,4 +1,4 @@
-//sourcehash: 6a14ebbd144f99c667289c29b20486d77b1dec17eb5a7902a5fe4e5e7be039ed
+//sourcehash: 948d5f05087b4020f2746d576d9ad72315a4a1abc9d49c4f4a1bb29de20d2473
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -78,26 +78,39 @@ R"doc(compute a 64 bit hash of the object using xxhash and the       \
 to_binary function. This  function is called binary because the
 \ to_binary  function of the object is used)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_AkimaInterpolator_binary_size =
+R"doc(Number of bytes to_stream writes with the raw encoding (used by to_binary
+to allocate the result once))doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_AkimaInterpolator_class_name = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_AkimaInterpolator_empty = R"doc(check if the interpolator contains data)doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_AkimaInterpolator_from_binary =
-R"doc(convert object to vector of bytes
-\
-                                                                                            \
+R"doc(create object from a buffer written with to_binary
+
+If T_CLASS implements from_cursor(ByteCursor&), the buffer is read
+without an istream (containers are copied with a single memcpy),
+otherwise from_stream is used.
+
 Args:
-    check_buffer_is_read_completely: variable for interface
-                                     compatibility, does not do    \
-                                     anything
-                                     \ \
+    check_buffer_is_read_completely: throw if the buffer has trailing
+                                     bytes (only supported for classes
+                                     that implement from_cursor)
 
 Returns:
-    vector of bytes
-    \)doc";
+    T_CLASS)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_AkimaInterpolator_from_cursor =
+R"doc(Same as from_stream, but reads directly from a buffer (used by
+from_binary))doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_AkimaInterpolator_get_y = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_AkimaInterpolator_hash_to =
+R"doc(Feed the same bytes as to_stream (raw encoding) into a hasher (used by
+binary_hash))doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_AkimaInterpolator_info_string =
 R"doc(                                                                                           \
 return an info string using the class __printer__ object
@@ -154,6 +167,27 @@ Args:
     superscript_exponents: print exponents in superscript
                            \)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_AkimaInterpolator_to_stream =
+R"doc(Write the interpolator to a stream
+
+Template parameter ``T_ostream``:
+    static stream type (helper::osstream / helper::ospanstream, as
+    used by to_binary / to_binary_into, are written without the
+    std::streambuf interface)
+
+Args:
+    os: output stream
+    encoding: raw (default, version header "AkimaInterpolator_V2"
+              followed by tagged fields) or compressed X/Y payloads
+              (version header "AkimaInterpolator_C1"), from_stream
+              detects the layout
+    mp_cores: Number of cores to use for parallelization (compressed
+              encoding of large containers, see
+              classhelper::stream::chunked_container_to_stream))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_AkimaInterpolator_versions =
+R"doc(version headers of the binary layouts (see I_Interpolator::_XY_to_stream))doc";
+
 #if defined(__GNUG__)
 #pragma GCC diagnostic pop
 #endif
@@ -1,4 +1,4 @@
-//sourcehash: d8bb7c09c6e5445b58ff7aa6013d136c0ac76b4cdf7af07696b2962a005979d4
+//sourcehash: 31d85e33694c60af7c0c7dc7e0912d16e05a7a886557e3fa5cfae449be904df0
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -1,4 +1,4 @@
-//sourcehash: 1047b093c516e5786754fb9e973c309a2afc038237505969871d04214836e715
+//sourcehash: 175ab02ea27a4df03f2276f95eb90f75b7419b84fee9b79ffc3a5093633c2dc0
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -61,6 +61,39 @@ usage: interpolated_y_value = interpolator.interpolate(x_value)
 Args:
     extrapolation_mode: extrapolation mode (nearest or fail))doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_XY_binary_size =
+R"doc(Number of bytes of the raw X / Y layout)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_XY_from_cursor =
+R"doc(Same as _XY_from_stream, but reads directly from a buffer (used by
+from_binary))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_XY_from_fields = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_XY_from_stream =
+R"doc(Read the X / Y layout (raw, compressed or legacy) from a stream
+
+Returns:
+    the extrapolation mode)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_XY_hash_to =
+R"doc(Feed the bytes of the raw X / Y layout into a hasher)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_XY_to_stream =
+R"doc(Write the X / Y layout (raw or compressed) to a stream
+
+The compressed encoding hashes the raw layout while writing the payload
+(same bytes as _XY_hash_to), so binary_hash is known without a second
+pass.
+
+Template parameter ``T_ostream``:
+    static stream type (passed through from to_stream, so to_binary
+    writes through helper::osstream::write_direct))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_XY_visit_fields =
+R"doc(write the raw layout fields to a TaggedFieldWriter, TaggedFieldHasher or
+TaggedFieldSizer)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_append =
 R"doc(append an x- and the corresponding y value to the interpolator data.
 Exception: raises domain error, strong exception guarantee
@@ -69,6 +102,10 @@ Args:
     x: value, must be > than all existing x values
     y: corresponding y value)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_binary_hash_cache =
+R"doc(memoized binary_hash, reset whenever the data or the extrapolation mode
+changes)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_check_XY = R"doc(check if input data is valid (e.g. sorted, no duplicated x values))doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_class_name =
@@ -89,6 +126,10 @@ Args:
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_extr_mode = R"doc(extrapolation mode)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_get_binary_hash_cache =
+R"doc(Memoized binary_hash (used by binary_hash of interpolators that
+implement hash_to))doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_get_data_X =
 R"doc(return the x component of the internal data vector
 
@@ -128,7 +169,68 @@ Returns:
 @note The returned values are actual x values from the data, not
 interpolated positions.
       Use these values with the interpolator to get corresponding y
-      values.)doc";
+      values.
+
+@note If a sampling pyramid is enabled (set_sampling_pyramid), the
+result is computed from the cached pyramid (same values, but in time
+proportional to the output size).
+      The pyramid is built by the first call (concurrent calls are
+      thread safe).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_get_sampled_XY =
+R"doc(Fused downsampling and interpolation: indices, x and y values of
+sampled knots
+
+Same as get_sampled_indices followed by gathering x and y at these
+indices. Because the selected x values are knots of the interpolator,
+the y values are copied directly (no search and no interpolation,
+unlike interpolator(get_sampled_X(...))).
+
+Args:
+    downsample_interval: Minimum interval between consecutive selected
+                         x values
+    max_gap: Maximum allowed gap between consecutive x values. If the
+             gap between consecutive x values exceeds this, a new
+             sampling segment is started.
+    mp_cores: Number of threads (gap separated segments are sampled in
+              parallel)
+
+Returns:
+    std::tuple of the indices, the x values and the y values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_get_sampled_channel =
+R"doc(Gather additional channel data at sampled indices (e.g. from
+get_sampled_XY)
+
+Template Args:
+    t_channel: std::vector or contiguous, row major xtensor
+
+Args:
+    channel: data with one entry (or row) per x value of the
+             interpolator
+    indices: indices returned by get_sampled_indices / get_sampled_XY
+
+Returns:
+    xt::xtensor with the gathered entries (rows))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_get_sampled_indices =
+R"doc(Get the indices of the x values (knots) selected by
+helper::get_index_downsampling
+
+Args:
+    downsample_interval: Minimum interval between consecutive selected
+                         x values
+    max_gap: Maximum allowed gap between consecutive x values. If the
+             gap between consecutive x values exceeds this, a new
+             sampling segment is started.
+    mp_cores: Number of threads (gap separated segments are sampled in
+              parallel)
+
+Returns:
+    xt::xtensor<size_t, 1> indices into get_data_X() / get_data_Y())doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_get_sampling_pyramid_base_interval =
+R"doc(Base interval of the sampling pyramid (NaN if disabled))doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_info_string =
 R"doc(                                                                                           \
@@ -157,6 +259,12 @@ Args:
     is_sorted: this indicates that X is already sorted in ascending
                order. (default: false))doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_invalidate_caches =
+R"doc(Drop all cached values (must be called whenever the data changes))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_invalidate_sampling_pyramid =
+R"doc(Drop the cached sampling pyramid)doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_operator_call =
 R"doc(get the interpolated y value for given x target
 
@@ -227,6 +335,13 @@ Args:
 Returns:
     classhelper::ObjectPrinter)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_sampling_pyramid =
+R"doc(built on demand by get_sampled_X, reset whenever the x data changes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_sampling_pyramid_base_interval = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_sampling_pyramid_levels = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_set_data_XY =
 R"doc(change the input data to these X and Y vectors
 
@@ -244,6 +359,20 @@ Args:
                         object (enumerator) that describes the
                         extrapolation mode)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_t_XY_field =
+R"doc(field tags of the raw layout (never reuse a tag for a different field))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_t_XY_versions =
+R"doc(version headers of the binary layouts of an interpolator class (raw and
+compressed must have the same length))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_t_XY_versions_class_name =
+R"doc(< used in error messages)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_t_XY_versions_compressed = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_t_XY_versions_raw = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_t_extr_mode = R"doc(extrapolation mode type.)doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_t_extr_mode_extrapolate = R"doc(interpolate using the closest value pair in the internal x vector)doc";
@@ -258,6 +387,20 @@ floating point types))doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_t_extr_mode_nearest = R"doc(return nearest value in the vector.)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_I_Interpolator_set_sampling_pyramid =
+R"doc(Enable a cached sampling pyramid for get_sampled_X
+
+Useful for repeated get_sampled_X calls with different intervals (e.g.
+zooming in a plot). The pyramid stores the gap positions for the
+intervals base_interval * 2^k and is built on the first get_sampled_X
+call. It is dropped whenever the data changes (set_data_XY, append,
+extend, insert).
+
+Args:
+    base_interval: finest interval of the pyramid. Use 0, negative, or
+                   NaN to disable the pyramid.
+    n_levels: number of pyramid levels (1 to 64))doc";
+
 #if defined(__GNUG__)
 #pragma GCC diagnostic pop
 #endif
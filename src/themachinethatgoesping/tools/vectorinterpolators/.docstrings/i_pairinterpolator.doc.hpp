@@ -1,4 +1,4 @@
-//sourcehash: 87ac5cea64cdea7a28f52e4e9b386d03023f7e1fb645c86e6640db5a3c7b8d94
+//sourcehash: d5975caf4708f108e27a9e4c53251ddd91eb1904bca867f7c25795a9519effb4
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -1,4 +1,4 @@
-//sourcehash: 6539fbcec57645b0047b912433991b27d7afe3f77cdf19713091643de35e2a36
+//sourcehash: 97036afde5d4aff11601ae06d8455b1a1089c335820da8a8606de2d2d5887f8e
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -57,24 +57,37 @@ R"doc(compute a 64 bit hash of the object using xxhash and the       \
 to_binary function. This  function is called binary because the
 \ to_binary  function of the object is used)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_LinearInterpolator_binary_size =
+R"doc(Number of bytes to_stream writes with the raw encoding (used by to_binary
+to allocate the result once))doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_LinearInterpolator_class_name = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_LinearInterpolator_from_binary =
-R"doc(convert object to vector of bytes
-\
-                                                                                            \
+R"doc(create object from a buffer written with to_binary
+
+If T_CLASS implements from_cursor(ByteCursor&), the buffer is read
+without an istream (containers are copied with a single memcpy),
+otherwise from_stream is used.
+
 Args:
-    check_buffer_is_read_completely: variable for interface
-                                     compatibility, does not do    \
-                                     anything
-                                     \ \
+    check_buffer_is_read_completely: throw if the buffer has trailing
+                                     bytes (only supported for classes
+                                     that implement from_cursor)
 
 Returns:
-    vector of bytes
-    \)doc";
+    T_CLASS)doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_LinearInterpolator_from_cursor =
+R"doc(Same as from_stream, but reads directly from a buffer (used by
+from_binary))doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_LinearInterpolator_from_stream = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_LinearInterpolator_hash_to =
+R"doc(Feed the same bytes as to_stream (raw encoding) into a hasher (used by
+binary_hash))doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_LinearInterpolator_info_string =
 R"doc(                                                                                           \
 return an info string using the class __printer__ object
@@ -130,7 +143,26 @@ Returns:
     vector of bytes
     \)doc";
 
-static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_LinearInterpolator_to_stream = R"doc()doc";
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_LinearInterpolator_to_stream =
+R"doc(Write the interpolator to a stream
+
+Template parameter ``T_ostream``:
+    static stream type (helper::osstream / helper::ospanstream, as
+    used by to_binary / to_binary_into, are written without the
+    std::streambuf interface)
+
+Args:
+    os: output stream
+    encoding: raw (default, version header "LinearInterpolator_V2"
+              followed by tagged fields) or compressed X/Y payloads
+              (version header "LinearInterpolator_C1"), from_stream
+              detects the layout
+    mp_cores: Number of cores to use for parallelization (compressed
+              encoding of large containers, see
+              classhelper::stream::chunked_container_to_stream))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_LinearInterpolator_versions =
+R"doc(version headers of the binary layouts (see I_Interpolator::_XY_to_stream))doc";
 
 #if defined(__GNUG__)
 #pragma GCC diagnostic pop
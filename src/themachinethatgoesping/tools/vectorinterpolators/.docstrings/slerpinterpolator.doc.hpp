@@ -1,4 +1,4 @@
-//sourcehash: 9829c8c262c86e040746d868fd7ac7805813c20796cfbc0bbc0ea34613fe75ff
+//sourcehash: b76ae10b04610dde7bb659af4d2981995cba74852b8016c2526e4616faf336bc
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -114,6 +114,10 @@ R"doc(compute a 64 bit hash of the object using xxhash and the       \
 to_binary function. This  function is called binary because the
 \ to_binary  function of the object is used)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_SlerpInterpolator_binary_size =
+R"doc(Number of bytes to_stream writes with the raw encoding (used by to_binary
+to allocate the result once))doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_SlerpInterpolator_class_name = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_SlerpInterpolator_extend =
@@ -166,6 +170,10 @@ Args:
 Returns:
     std::vector<std::array<3, YType>> YPR)doc";
 
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_SlerpInterpolator_hash_to =
+R"doc(Feed the same bytes as to_stream (raw encoding) into a hasher (used by
+binary_hash))doc";
+
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_SlerpInterpolator_info_string =
 R"doc(                                                                                           \
 return an info string using the class __printer__ object
@@ -275,7 +283,26 @@ Returns:
     vector of bytes
     \)doc";
 
-static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_SlerpInterpolator_to_stream = R"doc()doc";
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_SlerpInterpolator_to_stream =
+R"doc(Write the interpolator to a stream
+
+Template parameter ``T_ostream``:
+    static stream type (helper::osstream / helper::ospanstream, as
+    used by to_binary / to_binary_into, are written without the
+    std::streambuf interface)
+
+Args:
+    os: output stream
+    encoding: raw (default, version header "SlerpInterpolator_V2"
+              followed by tagged fields) or compressed X/Y payloads
+              (version header "SlerpInterpolator_C1"), from_stream
+              detects the layout
+    mp_cores: Number of cores to use for parallelization (compressed
+              encoding of large containers, see
+              classhelper::stream::chunked_container_to_stream))doc";
+
+static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_SlerpInterpolator_versions =
+R"doc(version headers of the binary layouts (see I_Interpolator::_XY_to_stream))doc";
 
 static const char *mkd_doc_themachinethatgoesping_tools_vectorinterpolators_SlerpInterpolator_ypr =
 R"doc(get the interpolated yaw, pitch and roll values for given x target
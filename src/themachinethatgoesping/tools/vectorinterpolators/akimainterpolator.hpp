@@ -28,6 +28,7 @@
 #include "i_interpolator.hpp"
 #include "linearinterpolator.hpp"
 
+#include "../classhelper/compression.hpp"
 #include "../classhelper/objectprinter.hpp"
 #include "../classhelper/stream.hpp"
 #include "../helper/approx.hpp"
@@ -62,6 +63,11 @@ class AkimaInterpolator : public I_Interpolator<XYType, XYType>
     boost::math::interpolators::makima<std::vector<XYType>> _akima_spline =
         boost::math::interpolators::makima<std::vector<XYType>>({ 0, 1, 2, 3 }, { 0, 0, 0, 0 });
 
+    /// version headers of the binary layouts (see I_Interpolator::_XY_to_stream)
+    static constexpr typename AkimaInterpolator::t_XY_versions _versions = {
+        "AkimaInterpolator_V2", "AkimaInterpolator_C1", "AkimaInterpolator"
+    };
+
   public:
     /**
      * @brief Construct a new (uninitialized) Akima Interpolator object
@@ -241,6 +247,7 @@ class AkimaInterpolator : public I_Interpolator<XYType, XYType>
         I_Interpolator<XYType, XYType>::_check_XY(X, Y);
 
         // copy data to allow get_X and get_Y functions
+        this->_invalidate_caches();
         _X = X;
         _Y = Y;
 
@@ -274,6 +281,7 @@ class AkimaInterpolator : public I_Interpolator<XYType, XYType>
                 "ERROR[Interpolator::append]: Y contains NAN or INFINITE values!"));
 
         // copy data to allow get_X and get_Y functions
+        this->_invalidate_caches();
         _X.push_back(x);
         _Y.push_back(y);
 
@@ -294,6 +302,7 @@ class AkimaInterpolator : public I_Interpolator<XYType, XYType>
             throw(std::invalid_argument("ERROR[Interpolator::extend]: list sizes do not match"));
 
         size_t orig_size = _X.size();
+        this->_invalidate_caches();
 
         try
         {
@@ -402,6 +411,7 @@ class AkimaInterpolator : public I_Interpolator<XYType, XYType>
      */
     void extend_unsorted(const std::vector<XYType>& X, const std::vector<XYType>& Y)
     {
+        this->_invalidate_caches();
         _X.insert(_X.end(), X.begin(), X.end());
         _Y.insert(_Y.end(), Y.begin(), Y.end());
     }
@@ -484,28 +494,62 @@ class AkimaInterpolator : public I_Interpolator<XYType, XYType>
     }
 
   public:
-    static AkimaInterpolator from_stream(std::istream& is)
+    static AkimaInterpolator from_stream(std::istream& is, int mp_cores = 1)
     {
-        using tools::classhelper::stream::container_from_stream;
+        std::vector<XYType> x, y;
+        const auto          extr_mode = AkimaInterpolator::_XY_from_stream(
+            is, _versions, x, y, mp_cores);
 
-        t_extr_mode extr_mode;
+        return AkimaInterpolator(std::move(x), std::move(y), extr_mode);
+    }
 
-        is.read(reinterpret_cast<char*>(&(extr_mode)), sizeof(extr_mode));
-        auto x = container_from_stream<std::vector<XYType>>(is);
-        auto y = container_from_stream<std::vector<XYType>>(is);
+    /**
+     * @brief Same as from_stream, but reads directly from a buffer (used by from_binary)
+     */
+    static AkimaInterpolator from_cursor(classhelper::ByteCursor& cursor, int mp_cores = 1)
+    {
+        std::vector<XYType> x, y;
+        const auto          extr_mode = AkimaInterpolator::_XY_from_cursor(
+            cursor, _versions, x, y, mp_cores);
 
         return AkimaInterpolator(std::move(x), std::move(y), extr_mode);
     }
 
-    void to_stream(std::ostream& os) const
+    /**
+     * @brief Write the interpolator to a stream
+     *
+     * @tparam T_ostream static stream type (helper::osstream / helper::ospanstream, as used by
+     * to_binary / to_binary_into, are written without the std::streambuf interface)
+     * @param os output stream
+     * @param encoding raw (default, version header "AkimaInterpolator_V2" followed by tagged
+     * fields) or compressed X/Y payloads (version header "AkimaInterpolator_C1"), from_stream
+     * detects the layout
+     * @param mp_cores Number of cores to use for parallelization (compressed encoding of large
+     * containers, see classhelper::stream::chunked_container_to_stream)
+     */
+    template<typename T_ostream>
+    void to_stream(
+        T_ostream&                     os,
+        classhelper::o_binary_encoding encoding = classhelper::t_binary_encoding::raw,
+        int                            mp_cores = 1) const
     {
-        using tools::classhelper::stream::container_to_stream;
+        this->_XY_to_stream(os, _versions, _X, _Y, encoding, mp_cores);
+    }
 
-        os.write(reinterpret_cast<const char*>(&(this->_extr_mode)), sizeof(this->_extr_mode));
-        container_to_stream(os, this->_X);
-        container_to_stream(os, this->_Y);
+    /**
+     * @brief Feed the same bytes as to_stream (raw encoding) into a hasher (used by binary_hash)
+     */
+    void hash_to(classhelper::BinaryHasher& hasher) const
+    {
+        this->_XY_hash_to(hasher, _versions, _X, _Y);
     }
 
+    /**
+     * @brief Number of bytes to_stream writes with the raw encoding (used by to_binary to
+     * allocate the result once)
+     */
+    size_t binary_size() const { return this->_XY_binary_size(_versions, _X, _Y); }
+
     classhelper::ObjectPrinter __printer__(unsigned int float_precision,
                                            bool         superscript_exponents) const override
     {
@@ -523,7 +567,7 @@ class AkimaInterpolator : public I_Interpolator<XYType, XYType>
   public:
     // -- class helper function macros --
     // define to_binary and from_binary functions (based on to/from stream)
-    __STREAM_DEFAULT_TOFROM_BINARY_FUNCTIONS__(AkimaInterpolator)
+    __STREAM_ENCODED_TOFROM_BINARY_FUNCTIONS__(AkimaInterpolator)
     // define info_string and print functions (needs the __printer__ function)
     __CLASSHELPER_DEFAULT_PRINTING_FUNCTIONS__
 };
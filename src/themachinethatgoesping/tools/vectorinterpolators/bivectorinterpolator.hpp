@@ -300,12 +300,14 @@ class BiVectorInterpolator
         return interpolator;
     }
 
-    void to_stream(std::ostream& os) const
+    template<typename T_ostream>
+    void to_stream(T_ostream& os) const
     {
-        using tools::classhelper::stream::container_to_stream;
-
-        os.write(reinterpret_cast<const char*>(&(this->_extr_mode)), sizeof(this->_extr_mode));
-        container_to_stream(os, this->_row_coordinates);
+        {
+            tools::classhelper::stream::StreamWriter<T_ostream> writer(os);
+            writer.write_value(this->_extr_mode);
+            writer.write_container(this->_row_coordinates);
+        }
         for (const auto& row : _col_interpolator_per_row)
             row.to_stream(os);
     }
@@ -21,12 +21,23 @@
 #include <concepts>
 #include <omp.h>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 #include <xtensor/containers/xtensor.hpp>
 
+#include "../classhelper/bytecursor.hpp"
+#include "../classhelper/classversion.hpp"
+#include "../classhelper/compression.hpp"
 #include "../classhelper/objectprinter.hpp"
 #include "../classhelper/option.hpp"
+#include "../classhelper/stream.hpp"
+#include "../classhelper/taggedfields.hpp"
+#include "../classhelper/xxhashhelper.hpp"
 #include "../helper/downsampling.hpp"
+#include "../helper/downsampling_pyramid.hpp"
 #include "../helper/xtensor.hpp"
 
 namespace themachinethatgoesping {
@@ -68,6 +79,222 @@ class I_Interpolator
   protected:
     o_extr_mode _extr_mode; ///< extrapolation mode
 
+    double _sampling_pyramid_base_interval = std::numeric_limits<double>::quiet_NaN();
+    size_t _sampling_pyramid_levels        = 16;
+
+    /// built on demand by get_sampled_X, reset whenever the x data changes
+    helper::DownsamplingPyramidCache<XType> _sampling_pyramid;
+
+    /// memoized binary_hash, reset whenever the data or the extrapolation mode changes
+    classhelper::HashCache _binary_hash_cache;
+
+    /**
+     * @brief Drop the cached sampling pyramid
+     */
+    void _invalidate_sampling_pyramid() { _sampling_pyramid.invalidate(); }
+
+    /**
+     * @brief Drop all cached values (must be called whenever the data changes)
+     */
+    void _invalidate_caches()
+    {
+        _invalidate_sampling_pyramid();
+        _binary_hash_cache.invalidate();
+    }
+
+    // ----- X / Y serialization shared by the interpolators -----
+    // raw:        version header versions.raw (e.g. "LinearInterpolator_V2"), then the tagged
+    //             fields (classhelper::TaggedFieldWriter) extr_mode, X and Y
+    // compressed: version header versions.compressed (e.g. "LinearInterpolator_C1"), extr_mode,
+    //             X and Y in the compressed_container_to_stream layout
+    // legacy:     extr_mode | X | Y in the container_to_stream layout without version header (raw
+    //             layout of older versions, still readable)
+
+    /// version headers of the binary layouts of an interpolator class (raw and compressed must
+    /// have the same length)
+    struct t_XY_versions
+    {
+        std::string_view raw;
+        std::string_view compressed;
+        std::string_view class_name; ///< used in error messages
+    };
+
+    /// field tags of the raw layout (never reuse a tag for a different field)
+    enum t_XY_field : classhelper::t_field_tag
+    {
+        _XY_field_extr_mode = 1,
+        _XY_field_X         = 2,
+        _XY_field_Y         = 3
+    };
+
+    /**
+     * @brief Read the X / Y layout (raw, compressed or legacy) from a stream
+     *
+     * @return the extrapolation mode
+     */
+    template<typename T_X, typename T_Y>
+    static t_extr_mode _XY_from_stream(std::istream&        is,
+                                       const t_XY_versions& versions,
+                                       std::vector<T_X>&    X,
+                                       std::vector<T_Y>&    Y,
+                                       int                  mp_cores)
+    {
+        using classhelper::stream::compressed_container_from_stream;
+        using classhelper::stream::container_from_stream;
+
+        const auto version = classhelper::try_read_any_version(
+            is, { versions.raw, versions.compressed }, versions.class_name);
+
+        if (version == 0)
+            return _XY_from_fields(classhelper::TaggedFields::from_stream(is), X, Y);
+
+        t_extr_mode extr_mode;
+        is.read(reinterpret_cast<char*>(&extr_mode), sizeof(extr_mode));
+
+        if (version == 1)
+        {
+            X = compressed_container_from_stream<std::vector<T_X>>(is, mp_cores);
+            Y = compressed_container_from_stream<std::vector<T_Y>>(is, mp_cores);
+        }
+        else
+        {
+            X = container_from_stream<std::vector<T_X>>(is);
+            Y = container_from_stream<std::vector<T_Y>>(is);
+        }
+
+        return extr_mode;
+    }
+
+    /**
+     * @brief Same as _XY_from_stream, but reads directly from a buffer (used by from_binary)
+     */
+    template<typename T_X, typename T_Y>
+    static t_extr_mode _XY_from_cursor(classhelper::ByteCursor& cursor,
+                                       const t_XY_versions&     versions,
+                                       std::vector<T_X>&        X,
+                                       std::vector<T_Y>&        Y,
+                                       int                      mp_cores)
+    {
+        using classhelper::stream::compressed_container_from_cursor;
+
+        const auto version =
+            cursor.try_read_any_version({ versions.raw, versions.compressed }, versions.class_name);
+
+        if (version == 0)
+            return _XY_from_fields(classhelper::TaggedFields::from_cursor(cursor), X, Y);
+
+        const auto extr_mode = cursor.read<t_extr_mode>();
+        if (version == 1)
+        {
+            X = compressed_container_from_cursor<std::vector<T_X>>(cursor, mp_cores);
+            Y = compressed_container_from_cursor<std::vector<T_Y>>(cursor, mp_cores);
+        }
+        else
+        {
+            X = cursor.read_container<std::vector<T_X>>();
+            Y = cursor.read_container<std::vector<T_Y>>();
+        }
+
+        return extr_mode;
+    }
+
+    template<typename T_X, typename T_Y>
+    static t_extr_mode _XY_from_fields(const classhelper::TaggedFields& fields,
+                                       std::vector<T_X>&                X,
+                                       std::vector<T_Y>&                Y)
+    {
+        X = fields.read_container<std::vector<T_X>>(_XY_field_X);
+        Y = fields.read_container<std::vector<T_Y>>(_XY_field_Y);
+        return fields.read_value<t_extr_mode>(_XY_field_extr_mode);
+    }
+
+    /**
+     * @brief Write the X / Y layout (raw or compressed) to a stream
+     *
+     * The compressed encoding hashes the raw layout while writing the payload (same bytes as
+     * _XY_hash_to), so binary_hash is known without a second pass.
+     *
+     * @tparam T_ostream static stream type (passed through from to_stream, so to_binary writes
+     * through helper::osstream::write_direct)
+     */
+    template<typename T_ostream, typename T_X, typename T_Y>
+    void _XY_to_stream(T_ostream&                     os,
+                       const t_XY_versions&           versions,
+                       const std::vector<T_X>&        X,
+                       const std::vector<T_Y>&        Y,
+                       classhelper::o_binary_encoding encoding,
+                       int                            mp_cores) const
+    {
+        using classhelper::stream::compressed_container_to_stream;
+
+        if (encoding == classhelper::t_binary_encoding::compressed)
+        {
+            classhelper::write_version(os, versions.compressed);
+            classhelper::stream::StreamWriter<T_ostream>(os).write_value(_extr_mode.value);
+
+            // hash while writing, unless the hash is already memoized (saves a pass over X / Y)
+            classhelper::BinaryHasher      hasher;
+            classhelper::BinaryHasher*     hash_while_writing =
+                _binary_hash_cache.is_valid() ? nullptr : &hasher;
+            classhelper::TaggedFieldHasher fields(hasher);
+            hasher.update_version(versions.raw);
+            fields.write_value(_XY_field_extr_mode, _extr_mode.value);
+            fields.write_container_header(_XY_field_X, X);
+            compressed_container_to_stream(os, X, mp_cores, hash_while_writing);
+            fields.write_container_header(_XY_field_Y, Y);
+            compressed_container_to_stream(os, Y, mp_cores, hash_while_writing);
+            fields.finish();
+
+            if (hash_while_writing)
+                _binary_hash_cache.set(hasher.digest());
+            return;
+        }
+
+        classhelper::write_version(os, versions.raw);
+        classhelper::TaggedFieldWriter<T_ostream> fields(os);
+        _XY_visit_fields(fields, X, Y);
+    }
+
+    /// write the raw layout fields to a TaggedFieldWriter, TaggedFieldHasher or TaggedFieldSizer
+    template<typename T_fields, typename T_X, typename T_Y>
+    void _XY_visit_fields(T_fields&               fields,
+                          const std::vector<T_X>& X,
+                          const std::vector<T_Y>& Y) const
+    {
+        fields.write_value(_XY_field_extr_mode, _extr_mode.value);
+        fields.write_container(_XY_field_X, X);
+        fields.write_container(_XY_field_Y, Y);
+        fields.finish();
+    }
+
+    /**
+     * @brief Feed the bytes of the raw X / Y layout into a hasher
+     */
+    template<typename T_X, typename T_Y>
+    void _XY_hash_to(classhelper::BinaryHasher& hasher,
+                     const t_XY_versions&       versions,
+                     const std::vector<T_X>&    X,
+                     const std::vector<T_Y>&    Y) const
+    {
+        hasher.update_version(versions.raw);
+
+        classhelper::TaggedFieldHasher fields(hasher);
+        _XY_visit_fields(fields, X, Y);
+    }
+
+    /**
+     * @brief Number of bytes of the raw X / Y layout
+     */
+    template<typename T_X, typename T_Y>
+    size_t _XY_binary_size(const t_XY_versions&    versions,
+                           const std::vector<T_X>& X,
+                           const std::vector<T_Y>& Y) const
+    {
+        classhelper::TaggedFieldSizer fields;
+        _XY_visit_fields(fields, X, Y);
+        return versions.raw.size() + fields.size();
+    }
+
   public:
     /**
      * @brief Construct a new Interpolator object from two vectors
@@ -126,14 +353,130 @@ class I_Interpolator
      *
      * @note The returned values are actual x values from the data, not interpolated positions.
      *       Use these values with the interpolator to get corresponding y values.
+     * @note If a sampling pyramid is enabled (set_sampling_pyramid), the result is computed from
+     *       the cached pyramid (same values, but in time proportional to the output size).
+     *       The pyramid is built by the first call (concurrent calls are thread safe).
      */
     xt::xtensor<XType, 1> get_sampled_X(
         double downsample_interval,
         double max_gap = std::numeric_limits<double>::quiet_NaN()) const
     {
-        return helper::get_value_downsampling(get_data_X(), downsample_interval, max_gap);
+        const auto& X = get_data_X();
+        if (!std::isfinite(_sampling_pyramid_base_interval))
+            return helper::get_value_downsampling(X, downsample_interval, max_gap);
+
+        const auto pyramid =
+            _sampling_pyramid.get(X, _sampling_pyramid_base_interval, _sampling_pyramid_levels);
+
+        return pyramid->get_value_downsampling(X, downsample_interval, max_gap);
+    }
+
+    /**
+     * @brief Get the indices of the x values (knots) selected by helper::get_index_downsampling
+     *
+     * @param downsample_interval Minimum interval between consecutive selected x values
+     * @param max_gap Maximum allowed gap between consecutive x values. If the gap between
+     *                consecutive x values exceeds this, a new sampling segment is started.
+     * @param mp_cores Number of threads (gap separated segments are sampled in parallel)
+     * @return xt::xtensor<size_t, 1> indices into get_data_X() / get_data_Y()
+     */
+    xt::xtensor<size_t, 1> get_sampled_indices(
+        double downsample_interval,
+        double max_gap  = std::numeric_limits<double>::quiet_NaN(),
+        int    mp_cores = 1) const
+    {
+        return helper::get_index_downsampling(
+            get_data_X(), downsample_interval, max_gap, mp_cores);
     }
 
+    /**
+     * @brief Fused downsampling and interpolation: indices, x and y values of sampled knots
+     *
+     * Same as get_sampled_indices followed by gathering x and y at these indices. Because the
+     * selected x values are knots of the interpolator, the y values are copied directly (no
+     * search and no interpolation, unlike interpolator(get_sampled_X(...))).
+     *
+     * @param downsample_interval Minimum interval between consecutive selected x values
+     * @param max_gap Maximum allowed gap between consecutive x values. If the gap between
+     *                consecutive x values exceeds this, a new sampling segment is started.
+     * @param mp_cores Number of threads (gap separated segments are sampled in parallel)
+     * @return std::tuple of the indices, the x values and the y values
+     */
+    std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<XType, 1>, xt::xtensor<YType, 1>>
+    get_sampled_XY(double downsample_interval,
+                   double max_gap  = std::numeric_limits<double>::quiet_NaN(),
+                   int    mp_cores = 1) const
+        requires std::is_scalar_v<YType>
+    {
+        auto indices = get_sampled_indices(downsample_interval, max_gap, mp_cores);
+        auto X       = helper::gather(get_data_X(), indices);
+        auto Y       = helper::gather(get_data_Y(), indices);
+
+        return { std::move(indices), std::move(X), std::move(Y) };
+    }
+
+    /**
+     * @brief Gather additional channel data at sampled indices (e.g. from get_sampled_XY)
+     *
+     * @tparam t_channel std::vector or contiguous, row major xtensor
+     * @param channel data with one entry (or row) per x value of the interpolator
+     * @param indices indices returned by get_sampled_indices / get_sampled_XY
+     * @return xt::xtensor with the gathered entries (rows)
+     */
+    template<typename t_channel>
+    auto get_sampled_channel(const t_channel&              channel,
+                             const xt::xtensor<size_t, 1>& indices) const
+    {
+        size_t channel_size;
+        if constexpr (requires { channel.shape(); })
+            channel_size = size_t(channel.shape()[0]);
+        else
+            channel_size = channel.size();
+
+        if (channel_size != get_data_X().size())
+            throw std::invalid_argument(
+                "ERROR[I_Interpolator::get_sampled_channel]: channel size (" +
+                std::to_string(channel_size) + ") does not match the number of x values (" +
+                std::to_string(get_data_X().size()) + ")");
+
+        return helper::gather(channel, indices);
+    }
+
+    /**
+     * @brief Enable a cached sampling pyramid for get_sampled_X
+     *
+     * Useful for repeated get_sampled_X calls with different intervals (e.g. zooming in a
+     * plot). The pyramid stores the gap positions for the intervals base_interval * 2^k and is
+     * built on the first get_sampled_X call. It is dropped whenever the data changes
+     * (set_data_XY, append, extend, insert).
+     *
+     * @param base_interval finest interval of the pyramid. Use 0, negative, or NaN to disable
+     *                      the pyramid.
+     * @param n_levels number of pyramid levels (1 to 64)
+     */
+    void set_sampling_pyramid(double base_interval, size_t n_levels = 16)
+    {
+        if (n_levels == 0 || n_levels > 64)
+            throw std::invalid_argument(
+                "ERROR[I_Interpolator::set_sampling_pyramid]: n_levels must be in [1, 64]");
+
+        _sampling_pyramid_base_interval = base_interval > 0 && std::isfinite(base_interval)
+                                              ? base_interval
+                                              : std::numeric_limits<double>::quiet_NaN();
+        _sampling_pyramid_levels        = n_levels;
+        _invalidate_sampling_pyramid();
+    }
+
+    /**
+     * @brief Base interval of the sampling pyramid (NaN if disabled)
+     */
+    double get_sampling_pyramid_base_interval() const { return _sampling_pyramid_base_interval; }
+
+    /**
+     * @brief Memoized binary_hash (used by binary_hash of interpolators that implement hash_to)
+     */
+    const classhelper::HashCache& get_binary_hash_cache() const { return _binary_hash_cache; }
+
     // -----------------------
     // getter setter functions
     // -----------------------
@@ -147,6 +490,7 @@ class I_Interpolator
     void set_extrapolation_mode(const o_extr_mode extrapolation_mode)
     {
         _extr_mode = extrapolation_mode;
+        _binary_hash_cache.invalidate();
     }
 
     /**
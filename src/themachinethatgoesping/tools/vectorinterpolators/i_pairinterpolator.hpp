@@ -128,6 +128,7 @@ class I_PairInterpolator : public I_Interpolator<XType, YType>
 
         I_Interpolator<XType, YType>::_check_XY(X, Y);
 
+        this->_invalidate_caches();
         _X = std::move(X);
         _Y = std::move(Y);
     }
@@ -159,6 +160,7 @@ class I_PairInterpolator : public I_Interpolator<XType, YType>
             return;
         }
 
+        this->_invalidate_caches();
         _X.push_back(x);
         _Y.push_back(y);
     }
@@ -187,6 +189,7 @@ class I_PairInterpolator : public I_Interpolator<XType, YType>
         catch (...)
         {
             // restore original size if something went wrong
+            this->_invalidate_caches();
             _X.resize(orig_size);
             _Y.resize(orig_size);
             throw;
@@ -263,6 +266,7 @@ class I_PairInterpolator : public I_Interpolator<XType, YType>
      */
     void extend_unsorted(const std::vector<XType>& X, const std::vector<YType>& Y)
     {
+        this->_invalidate_caches();
         _X.insert(_X.end(), X.begin(), X.end());
         _Y.insert(_Y.end(), Y.begin(), Y.end());
     }
@@ -22,6 +22,7 @@
 
 #include "i_pairinterpolator.hpp"
 
+#include "../classhelper/compression.hpp"
 #include "../classhelper/objectprinter.hpp"
 #include "../classhelper/stream.hpp"
 #include "../helper/approx.hpp"
@@ -39,6 +40,10 @@ namespace vectorinterpolators {
 template<std::floating_point XType, typename YType>
 class NearestInterpolator : public I_PairInterpolator<XType, YType>
 {
+    /// version headers of the binary layouts (see I_Interpolator::_XY_to_stream)
+    static constexpr typename NearestInterpolator::t_XY_versions _versions = {
+        "NearestInterpolator_V2", "NearestInterpolator_C1", "NearestInterpolator"
+    };
 
   public:
     NearestInterpolator(o_extr_mode extrapolation_mode = t_extr_mode::extrapolate)
@@ -119,30 +124,61 @@ class NearestInterpolator : public I_PairInterpolator<XType, YType>
         return y2;
     }
 
-    static NearestInterpolator<XType, YType> from_stream(std::istream& is)
+    static NearestInterpolator<XType, YType> from_stream(std::istream& is, int mp_cores = 1)
     {
-        using tools::classhelper::stream::container_from_stream;
-
         NearestInterpolator<XType, YType> obj;
-
-        is.read(reinterpret_cast<char*>(&(obj._extr_mode)), sizeof(obj._extr_mode));
-
-        obj._X = container_from_stream<std::vector<XType>>(is);
-        obj._Y = container_from_stream<std::vector<YType>>(is);
-
+        obj._extr_mode = NearestInterpolator::_XY_from_stream(
+            is, _versions, obj._X, obj._Y, mp_cores);
         return obj;
     }
 
-    void to_stream(std::ostream& os) const
+    /**
+     * @brief Same as from_stream, but reads directly from a buffer (used by from_binary)
+     */
+    static NearestInterpolator<XType, YType> from_cursor(classhelper::ByteCursor& cursor,
+                                                         int                      mp_cores = 1)
     {
-        using tools::classhelper::stream::container_to_stream;
+        NearestInterpolator<XType, YType> obj;
+        obj._extr_mode = NearestInterpolator::_XY_from_cursor(
+            cursor, _versions, obj._X, obj._Y, mp_cores);
+        return obj;
+    }
 
-        os.write(reinterpret_cast<const char*>(&(this->_extr_mode)), sizeof(this->_extr_mode));
+    /**
+     * @brief Write the interpolator to a stream
+     *
+     * @tparam T_ostream static stream type (helper::osstream / helper::ospanstream, as used by
+     * to_binary / to_binary_into, are written without the std::streambuf interface)
+     * @param os output stream
+     * @param encoding raw (default, version header "NearestInterpolator_V2" followed by tagged
+     * fields) or compressed X/Y payloads (version header "NearestInterpolator_C1"), from_stream
+     * detects the layout
+     * @param mp_cores Number of cores to use for parallelization (compressed encoding of large
+     * containers, see classhelper::stream::chunked_container_to_stream)
+     */
+    template<typename T_ostream>
+    void to_stream(
+        T_ostream&                     os,
+        classhelper::o_binary_encoding encoding = classhelper::t_binary_encoding::raw,
+        int                            mp_cores = 1) const
+    {
+        this->_XY_to_stream(os, _versions, this->_X, this->_Y, encoding, mp_cores);
+    }
 
-        container_to_stream(os, this->_X);
-        container_to_stream(os, this->_Y);
+    /**
+     * @brief Feed the same bytes as to_stream (raw encoding) into a hasher (used by binary_hash)
+     */
+    void hash_to(classhelper::BinaryHasher& hasher) const
+    {
+        this->_XY_hash_to(hasher, _versions, this->_X, this->_Y);
     }
 
+    /**
+     * @brief Number of bytes to_stream writes with the raw encoding (used by to_binary to
+     * allocate the result once)
+     */
+    size_t binary_size() const { return this->_XY_binary_size(_versions, this->_X, this->_Y); }
+
   public:
     classhelper::ObjectPrinter __printer__(unsigned int float_precision, bool superscript_exponents) const override
     {
@@ -163,7 +199,7 @@ class NearestInterpolator : public I_PairInterpolator<XType, YType>
   public:
     // -- class helper function macros --
     // define to_binary and from_binary functions (needs to/from stream function)
-    __STREAM_DEFAULT_TOFROM_BINARY_FUNCTIONS__(NearestInterpolator)
+    __STREAM_ENCODED_TOFROM_BINARY_FUNCTIONS__(NearestInterpolator)
     // define info_string and print functions (needs the __printer__ function)
     __CLASSHELPER_DEFAULT_PRINTING_FUNCTIONS__
 };